@@ -0,0 +1,95 @@
+#ifndef OTTERENGINE_BENCHMARK_H
+#define OTTERENGINE_BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "Core/BaseTypes.h"
+
+namespace Otter::Benchmarks
+{
+    /**
+     * @brief A benchmark that is run by the benchmark executable.
+     */
+    struct Benchmark final
+    {
+        const char* Name;
+        void (* Callback)();
+    };
+
+    /**
+     * @brief Gets every benchmark that has been registered.
+     *
+     * @return The benchmarks, in registration order.
+     */
+    inline std::vector<Benchmark>& GetBenchmarks()
+    {
+        static std::vector<Benchmark> s_Benchmarks;
+        return s_Benchmarks;
+    }
+
+    /**
+     * @brief Registers a benchmark when a static instance of it is constructed.
+     */
+    struct BenchmarkRegistration final
+    {
+        /**
+         * @brief Constructor.
+         *
+         * @param name The name of the benchmark.
+         * @param callback The function that runs the benchmark.
+         */
+        BenchmarkRegistration(const char* const name, void (* const callback)())
+        {
+            GetBenchmarks().push_back({ name, callback });
+        }
+    };
+
+    /**
+     * @brief Measures how long a callback takes to run.
+     *
+     * @tparam TCallback The type of the callback.
+     *
+     * @param callback The callback to measure.
+     *
+     * @return The elapsed time in seconds.
+     */
+    template<typename TCallback>
+    double Measure(TCallback&& callback)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        callback();
+        const auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    /**
+     * @brief Prints the result of a measurement.
+     *
+     * @param label The label of the measurement.
+     * @param itemCount The number of items that the measurement processed.
+     * @param seconds The elapsed time in seconds.
+     */
+    inline void Report(const char* const label, const UInt64 itemCount, const double seconds)
+    {
+        std::printf("  %-48s %12llu items %10.2f ms %10.2f ns/item\n",
+                    label,
+                    (unsigned long long) itemCount,
+                    seconds * 1000.0,
+                    itemCount > 0 ? seconds * 1e9 / (double) itemCount : 0.0);
+    }
+}
+
+/**
+ * @brief Defines a benchmark and registers it with the benchmark executable.
+ *
+ * @param name The name of the benchmark.
+ */
+#define OTR_BENCHMARK(name)                                                                     \
+    static void name();                                                                         \
+    static const Otter::Benchmarks::BenchmarkRegistration g_##name##Registration(#name, &name); \
+    static void name()
+
+#endif //OTTERENGINE_BENCHMARK_H
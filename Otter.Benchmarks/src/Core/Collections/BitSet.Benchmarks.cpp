@@ -0,0 +1,65 @@
+#include "Benchmark.h"
+#include "Core/Collections/BitSet.h"
+
+using namespace Otter;
+
+namespace
+{
+    constexpr UInt64 k_BitCount  = 4096;
+    constexpr UInt64 k_PassCount = 20'000;
+}
+
+OTR_BENCHMARK(BitSet_SetBits)
+{
+    // A sparse set, like the fingerprint of an archetype among many registered components
+    BitSet bitset;
+    bitset.Reserve(k_BitCount);
+    for (UInt64 i = 0; i < k_BitCount; i += 97)
+        bitset.Set(i, true);
+
+    UInt64 sum = 0;
+    Benchmarks::Report("Get, every bit",
+                       k_BitCount * k_PassCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 pass = 0; pass < k_PassCount; pass++)
+                                                   for (UInt64 i = 0; i < bitset.GetBitsSize(); i++)
+                                                       if (bitset.Get(i))
+                                                           sum += i;
+                                           }));
+
+    Benchmarks::Report("ForEachSetBit",
+                       k_BitCount * k_PassCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 pass = 0; pass < k_PassCount; pass++)
+                                                   bitset.ForEachSetBit([&](const UInt64 index) { sum += index; });
+                                           }));
+
+    Benchmarks::Report("FindNextSet",
+                       k_BitCount * k_PassCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 pass = 0; pass < k_PassCount; pass++)
+                                                   for (UInt64 i = bitset.FindFirstSet();
+                                                        i < bitset.GetBitsSize();
+                                                        i = bitset.FindNextSet(i + 1))
+                                                       sum += i;
+                                           }));
+
+    // The query only has a bit near the end, so that every word is compared before it matches
+    BitSet query;
+    query.Reserve(k_BitCount);
+    query.Set(k_BitCount / 97 * 97, true);
+
+    UInt64 matches = 0;
+    Benchmarks::Report("Includes",
+                       k_BitCount * k_PassCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 pass = 0; pass < k_PassCount; pass++)
+                                                   matches += bitset.Includes(query);
+                                           }));
+
+    std::printf("  sum %llu, matches %llu\n", (unsigned long long) sum, (unsigned long long) matches);
+}
@@ -0,0 +1,168 @@
+#include "Benchmark.h"
+#include "Core/Collections/Dictionary.h"
+#include "Core/Collections/HashSet.h"
+#include "Core/Collections/List.h"
+
+using namespace Otter;
+
+namespace
+{
+    constexpr UInt64 k_KeyCount = 10'000'000;
+
+    /**
+     * @brief Spreads consecutive indices over the whole key space, so that keys are not inserted in hash order.
+     */
+    UInt64 ScatterKey(const UInt64 index) { return index * 0x9E3779B97F4A7C15ull; }
+}
+
+OTR_BENCHMARK(Dictionary_Insert10M)
+{
+    Dictionary<UInt64, UInt64> sequential;
+    Benchmarks::Report("TryAdd, sequential keys",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = 0; i < k_KeyCount; i++)
+                                                   sequential.TryAdd(i, i);
+                                           }));
+
+    Dictionary<UInt64, UInt64> scattered;
+    Benchmarks::Report("TryAdd, scattered keys",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = 0; i < k_KeyCount; i++)
+                                                   scattered.TryAdd(ScatterKey(i), i);
+                                           }));
+
+    UInt64 found = 0;
+    Benchmarks::Report("ContainsKey, every key",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = 0; i < k_KeyCount; i++)
+                                                   found += scattered.ContainsKey(ScatterKey(i));
+                                           }));
+
+    Benchmarks::Report("ContainsKey, missing keys",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = k_KeyCount; i < 2 * k_KeyCount; i++)
+                                                   found += scattered.ContainsKey(ScatterKey(i));
+                                           }));
+
+    std::printf("  count %llu, capacity %llu, found %llu\n",
+                (unsigned long long) scattered.GetCount(),
+                (unsigned long long) scattered.GetCapacity(),
+                (unsigned long long) found);
+}
+
+OTR_BENCHMARK(Dictionary_Spawn50K)
+{
+    constexpr UInt64 k_SpawnCount = 50'000;
+    constexpr UInt64 k_FrameCount = 20;
+
+    List<KeyValuePair<UInt64, UInt64>> pairs;
+    for (UInt64 i = 0; i < k_SpawnCount; i++)
+        pairs.Add({ ScatterKey(i), i });
+
+    Benchmarks::Report("TryAdd, one by one",
+                       k_SpawnCount * k_FrameCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 frame = 0; frame < k_FrameCount; frame++)
+                                               {
+                                                   Dictionary<UInt64, UInt64> dictionary;
+                                                   for (const auto& pair: pairs)
+                                                       dictionary.TryAdd(pair.Key, pair.Value);
+                                               }
+                                           }));
+
+    Benchmarks::Report("Reserve, then TryAdd one by one",
+                       k_SpawnCount * k_FrameCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 frame = 0; frame < k_FrameCount; frame++)
+                                               {
+                                                   Dictionary<UInt64, UInt64> dictionary;
+                                                   dictionary.Reserve(k_SpawnCount);
+
+                                                   for (const auto& pair: pairs)
+                                                       dictionary.TryAdd(pair.Key, pair.Value);
+                                               }
+                                           }));
+
+    Benchmarks::Report("TryAddRange",
+                       k_SpawnCount * k_FrameCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 frame = 0; frame < k_FrameCount; frame++)
+                                               {
+                                                   Dictionary<UInt64, UInt64> dictionary;
+                                                   dictionary.TryAddRange(pairs);
+                                               }
+                                           }));
+}
+
+OTR_BENCHMARK(HashSet_Insert10M)
+{
+    HashSet<UInt64> hashSet;
+    Benchmarks::Report("TryAdd, scattered items",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = 0; i < k_KeyCount; i++)
+                                                   hashSet.TryAdd(ScatterKey(i));
+                                           }));
+
+    Benchmarks::Report("TryRemove, every item",
+                       k_KeyCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               for (UInt64 i = 0; i < k_KeyCount; i++)
+                                                   hashSet.TryRemove(ScatterKey(i));
+                                           }));
+}
+
+OTR_BENCHMARK(Dictionary_Iterate)
+{
+    constexpr UInt64 k_SlotCount   = 500'000;
+    constexpr UInt64 k_PassCount   = 20;
+    constexpr UInt64 k_Densities[] = { 1, 10, 100 };
+
+    for (const UInt64 density: k_Densities)
+    {
+        Dictionary<UInt64, UInt64> dictionary;
+        dictionary.Reserve(k_SlotCount);
+
+        const UInt64 entryCount = k_SlotCount / density;
+        for (UInt64 i = 0; i < entryCount; i++)
+            dictionary.TryAdd(ScatterKey(i), i);
+
+        const UInt64 allocationCount = MemorySystem::GetMemoryTagStats(MemoryTag::Collections).TotalAllocationCount;
+
+        UInt64 sum = 0;
+        const double seconds = Benchmarks::Measure([&]()
+                                                   {
+                                                       for (UInt64 pass = 0; pass < k_PassCount; pass++)
+                                                           for (const auto& [key, value]: dictionary)
+                                                               sum += value;
+                                                   });
+
+        const UInt64 allocations = MemorySystem::GetMemoryTagStats(MemoryTag::Collections).TotalAllocationCount
+                                   - allocationCount;
+
+        char label[64];
+        std::snprintf(label,
+                      sizeof(label),
+                      "Iterate, %llu of %llu slots full",
+                      (unsigned long long) entryCount,
+                      (unsigned long long) dictionary.GetCapacity());
+        Benchmarks::Report(label, entryCount * k_PassCount, seconds);
+
+        std::printf("  allocations while iterating %llu, sum %llu\n",
+                    (unsigned long long) allocations,
+                    (unsigned long long) sum);
+    }
+}
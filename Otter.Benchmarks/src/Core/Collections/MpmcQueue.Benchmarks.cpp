@@ -0,0 +1,125 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Core/Collections/MpmcQueue.h"
+#include "Core/Collections/Queue.h"
+
+using namespace Otter;
+
+namespace
+{
+    constexpr UInt64 k_ItemCount        = 16'000'000;
+    constexpr UInt64 k_ProducerCounts[] = { 1, 4, 8, 16 };
+
+    MpmcQueue<UInt64, 4096> g_Queue;
+
+    Queue<UInt64> g_LockedQueue;
+    std::mutex    g_LockedQueueMutex;
+
+    /**
+     * @brief Enqueues a share of the items into the lock-free queue, and yields whenever it is full.
+     *
+     * @param itemCount The number of items to enqueue.
+     */
+    void Produce(const UInt64 itemCount)
+    {
+        for (UInt64 i = 0; i < itemCount; i++)
+            while (!g_Queue.TryEnqueue(i))
+                std::this_thread::yield();
+    }
+
+    /**
+     * @brief Enqueues a share of the items into the queue that is guarded by a mutex.
+     *
+     * @param itemCount The number of items to enqueue.
+     */
+    void ProduceLocked(const UInt64 itemCount)
+    {
+        for (UInt64 i = 0; i < itemCount; i++)
+        {
+            std::lock_guard lock(g_LockedQueueMutex);
+            g_LockedQueue.TryEnqueue(i);
+        }
+    }
+
+    /**
+     * @brief Runs a number of producers that fan in to a single consumer on the calling thread.
+     *
+     * @param producerCount The number of producer threads.
+     * @param produce The function that each producer runs.
+     * @param tryDequeue The function that the consumer calls to take an item.
+     *
+     * @return The sum of the items, so that the consumer's work is not optimised away.
+     */
+    template<typename TTryDequeue>
+    UInt64 FanIn(const UInt64 producerCount, void (* const produce)(UInt64), TTryDequeue&& tryDequeue)
+    {
+        std::vector<std::thread> producers;
+        for (UInt64 i = 0; i < producerCount; i++)
+            producers.emplace_back(produce, k_ItemCount / producerCount);
+
+        UInt64 sum = 0;
+        UInt64 value;
+        for (UInt64 received = 0; received < k_ItemCount;)
+        {
+            if (!tryDequeue(&value))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            sum += value;
+            received++;
+        }
+
+        for (auto& producer: producers)
+            producer.join();
+
+        return sum;
+    }
+}
+
+OTR_BENCHMARK(MpmcQueue_FanIn)
+{
+    char label[64];
+    UInt64 sum = 0;
+
+    for (const UInt64 producerCount: k_ProducerCounts)
+    {
+        std::snprintf(label, sizeof(label), "MpmcQueue, %llu producers", (unsigned long long) producerCount);
+        Benchmarks::Report(label,
+                           k_ItemCount,
+                           Benchmarks::Measure([&]()
+                                               {
+                                                   sum += FanIn(producerCount,
+                                                                &Produce,
+                                                                [](UInt64* outItem)
+                                                                {
+                                                                    return g_Queue.TryDequeue(outItem);
+                                                                });
+                                               }));
+    }
+
+    for (const UInt64 producerCount: k_ProducerCounts)
+    {
+        std::snprintf(label, sizeof(label), "Queue with a mutex, %llu producers", (unsigned long long) producerCount);
+        Benchmarks::Report(label,
+                           k_ItemCount,
+                           Benchmarks::Measure([&]()
+                                               {
+                                                   sum += FanIn(producerCount,
+                                                                &ProduceLocked,
+                                                                [](UInt64* outItem)
+                                                                {
+                                                                    std::lock_guard lock(g_LockedQueueMutex);
+                                                                    return g_LockedQueue.TryDequeue(outItem);
+                                                                });
+                                               }));
+    }
+
+    g_LockedQueue.ClearDestructive();
+
+    std::printf("  sum %llu\n", (unsigned long long) sum);
+}
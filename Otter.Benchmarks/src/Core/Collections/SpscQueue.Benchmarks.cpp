@@ -0,0 +1,132 @@
+#include <thread>
+
+#include "Benchmark.h"
+#include "Core/Collections/SpscQueue.h"
+
+using namespace Otter;
+
+namespace
+{
+    constexpr UInt64 k_ItemCount      = 50'000'000;
+    constexpr UInt64 k_RoundTripCount = 1'000'000;
+    constexpr UInt64 k_BatchSize      = 64;
+
+    SpscQueue<UInt64, 4096> g_Requests;
+    SpscQueue<UInt64, 4096> g_Replies;
+
+    /**
+     * @brief Enqueues every item on its own, and yields whenever the queue is full.
+     */
+    void ProduceOneByOne()
+    {
+        for (UInt64 i = 0; i < k_ItemCount; i++)
+            while (!g_Requests.TryEnqueue(i))
+                std::this_thread::yield();
+    }
+
+    /**
+     * @brief Enqueues the items in batches, and yields whenever the queue is full.
+     */
+    void ProduceBatches()
+    {
+        UInt64 batch[k_BatchSize];
+        for (UInt64 i = 0; i < k_ItemCount; i += k_BatchSize)
+        {
+            for (UInt64 j = 0; j < k_BatchSize; j++)
+                batch[j] = i + j;
+
+            UInt64 sent = g_Requests.TryEnqueueRange(batch, k_BatchSize);
+            while (sent < k_BatchSize)
+            {
+                std::this_thread::yield();
+                sent += g_Requests.TryEnqueueRange(batch + sent, k_BatchSize - sent);
+            }
+        }
+    }
+
+    /**
+     * @brief Sends every request back as a reply.
+     */
+    void Echo()
+    {
+        UInt64 value;
+        for (UInt64 i = 0; i < k_RoundTripCount; i++)
+        {
+            while (!g_Requests.TryDequeue(&value))
+                std::this_thread::yield();
+
+            while (!g_Replies.TryEnqueue(value))
+                std::this_thread::yield();
+        }
+    }
+}
+
+OTR_BENCHMARK(SpscQueue_Throughput)
+{
+    UInt64 sum = 0;
+    Benchmarks::Report("TryEnqueue/TryDequeue, one at a time",
+                       k_ItemCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               std::thread producer(&ProduceOneByOne);
+
+                                               UInt64 value;
+                                               for (UInt64 i = 0; i < k_ItemCount; i++)
+                                               {
+                                                   while (!g_Requests.TryDequeue(&value))
+                                                       std::this_thread::yield();
+
+                                                   sum += value;
+                                               }
+
+                                               producer.join();
+                                           }));
+
+    Benchmarks::Report("TryEnqueueRange/TryDequeueRange, batches of 64",
+                       k_ItemCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               std::thread producer(&ProduceBatches);
+
+                                               UInt64 batch[k_BatchSize];
+                                               for (UInt64 received = 0; received < k_ItemCount;)
+                                               {
+                                                   const UInt64 count = g_Requests.TryDequeueRange(batch,
+                                                                                                   k_BatchSize);
+                                                   if (count == 0)
+                                                       std::this_thread::yield();
+
+                                                   for (UInt64 j = 0; j < count; j++)
+                                                       sum += batch[j];
+
+                                                   received += count;
+                                               }
+
+                                               producer.join();
+                                           }));
+
+    std::printf("  sum %llu\n", (unsigned long long) sum);
+}
+
+OTR_BENCHMARK(SpscQueue_Latency)
+{
+    // Each item is sent to another thread and echoed back, so the time per item is one round trip
+    Benchmarks::Report("Round trip, one item in flight",
+                       k_RoundTripCount,
+                       Benchmarks::Measure([&]()
+                                           {
+                                               std::thread echo(&Echo);
+
+                                               UInt64 value;
+                                               for (UInt64 i = 0; i < k_RoundTripCount; i++)
+                                               {
+                                                   while (!g_Requests.TryEnqueue(i))
+                                                       std::this_thread::yield();
+
+                                                   while (!g_Replies.TryDequeue(&value))
+                                                       std::this_thread::yield();
+                                               }
+
+                                               echo.join();
+                                           }));
+}
@@ -0,0 +1,28 @@
+#include <cstdio>
+#include <cstring>
+
+#include "Benchmark.h"
+#include "Core/Memory.h"
+
+using namespace Otter;
+
+int main(int argc, char** argv)
+{
+    // Runs every benchmark whose name contains the filter, or all of them without one
+    const char* const filter = argc > 1 ? argv[1] : nullptr;
+
+    MemorySystem::Initialise(64_MiB);
+
+    for (const Benchmarks::Benchmark& benchmark: Benchmarks::GetBenchmarks())
+    {
+        if (filter && !std::strstr(benchmark.Name, filter))
+            continue;
+
+        std::printf("%s\n", benchmark.Name);
+        benchmark.Callback();
+    }
+
+    MemorySystem::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include "Core/Allocators/FrameAllocator.h"
+
+using FrameAllocator = Otter::FrameAllocator;
+
+TEST(FrameAllocator, Initialisation_Valid)
+{
+    void* block = malloc(1_KiB);
+    FrameAllocator allocator(block, 1_KiB);
+
+    EXPECT_EQ(allocator.GetMemorySize(), 1_KiB);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_EQ(allocator.GetMemoryFree(), 1_KiB);
+
+    free(block);
+}
+
+TEST(FrameAllocator, SwapBuffers)
+{
+    void* block = malloc(1_KiB);
+    FrameAllocator allocator(block, 1_KiB);
+
+    void* frame1 = allocator.Allocate(64, 8);
+    EXPECT_EQ(frame1, block);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 64);
+
+    allocator.SwapBuffers();
+
+    // Memory of the previous frame is still in use
+    void* frame2 = allocator.Allocate(32, 8);
+    EXPECT_EQ((UIntPtr) frame2, (UIntPtr) block + 512);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 96);
+
+    allocator.SwapBuffers();
+    EXPECT_EQ(allocator.GetMemoryUsed(), 32);
+
+    void* frame3 = allocator.Allocate(16, 8);
+    EXPECT_EQ(frame3, frame1);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 48);
+
+    EXPECT_EQ(allocator.Allocate(1_KiB, 8), nullptr);
+
+    free(block);
+}
@@ -53,6 +53,114 @@ TEST(FreeListAllocator, Allocate_FindFirstFit)
     free(block);
 }
 
+TEST(FreeListAllocator, Allocate_SegregatedFit)
+{
+    void* block = malloc(1_KiB);
+    Otter::FreeListAllocator allocator(block, 1_KiB, Otter::FreeListAllocator::Policy::SegregatedFit);
+
+    const UInt64 alignment            = 8;
+    const UInt64 firstAllocationSize  = 64;
+    const UInt64 secondAllocationSize = 32;
+
+    void* allocation1 = allocator.Allocate(firstAllocationSize, alignment);
+    EXPECT_NE(allocation1, nullptr);
+    EXPECT_EQ(allocator.GetMemoryUsed(), firstAllocationSize + FreeListAllocator::GetAllocatorHeaderSize());
+
+    void* allocation2 = allocator.Allocate(secondAllocationSize, alignment);
+    EXPECT_NE(allocation2, nullptr);
+    EXPECT_EQ(allocator.GetMemoryUsed(), firstAllocationSize + FreeListAllocator::GetAllocatorHeaderSize()
+                                         + secondAllocationSize + FreeListAllocator::GetAllocatorHeaderSize());
+
+    auto count = 0;
+    for (auto& node: allocator)
+    {
+        EXPECT_GT(node.Size, 0);
+        count++;
+    }
+
+    EXPECT_EQ(count, 1);
+
+    allocator.Free(allocation1);
+    allocator.Free(allocation2);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    count = 0;
+    for (auto& node: allocator)
+    {
+        EXPECT_GT(node.Size, 0);
+        count++;
+    }
+
+    EXPECT_EQ(count, 1);
+
+    free(block);
+}
+
+TEST(FreeListAllocator, Allocate_SegregatedFit_Aligned)
+{
+    void* block = malloc(4_KiB);
+    Otter::FreeListAllocator allocator(block, 4_KiB, Otter::FreeListAllocator::Policy::SegregatedFit);
+
+    for (const UInt16 alignment: { 16, 32, 64, 128 })
+    {
+        void* allocation = allocator.Allocate(24, alignment);
+        EXPECT_NE(allocation, nullptr);
+        EXPECT_EQ((UIntPtr) allocation % alignment, 0);
+    }
+
+    auto count = 0;
+    for (auto& node: allocator)
+    {
+        EXPECT_GT(node.Size, 0);
+        count++;
+    }
+
+    EXPECT_GT(count, 1);
+
+    allocator.Clear();
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    free(block);
+}
+
+TEST(FreeListAllocator, Allocate_SegregatedFit_ReusesFreedBlocks)
+{
+    void* block = malloc(64_KiB);
+    Otter::FreeListAllocator allocator(block, 64_KiB, Otter::FreeListAllocator::Policy::SegregatedFit);
+
+    void* allocations[256];
+    for (UInt64 i = 0; i < 256; i++)
+    {
+        allocations[i] = allocator.Allocate(8 + (i % 16) * 8, 8);
+        EXPECT_NE(allocations[i], nullptr);
+    }
+
+    for (UInt64 i = 0; i < 256; i += 2)
+        allocator.Free(allocations[i]);
+
+    for (UInt64 i = 0; i < 256; i += 2)
+    {
+        allocations[i] = allocator.Allocate(8 + (i % 16) * 8, 8);
+        EXPECT_NE(allocations[i], nullptr);
+    }
+
+    for (UInt64 i = 0; i < 256; i++)
+        allocator.Free(allocations[i]);
+
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    auto count = 0;
+    for (auto& node: allocator)
+    {
+        EXPECT_GT(node.Size, 0);
+        count++;
+    }
+
+    EXPECT_EQ(count, 1);
+
+    free(block);
+}
+
 // TODO: Failing test, BestFit policy is not implemented correctly
 //TEST(FreeListAllocator, Allocate_FindBestFit)
 //{
@@ -163,6 +271,97 @@ TEST(FreeListAllocator, FreeMultipleAllocations)
     free(block);
 }
 
+TEST(FreeListAllocator, TryResize_InPlace)
+{
+    void* block = malloc(1_KiB);
+    Otter::FreeListAllocator allocator(block, 1_KiB);
+
+    const UInt64 headerSize = FreeListAllocator::GetAllocatorHeaderSize();
+
+    void* allocation = allocator.Allocate(64, 8);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 64 + headerSize);
+
+    EXPECT_TRUE(allocator.TryResize(allocation, 256));
+    EXPECT_EQ(allocator.GetMemoryUsed(), 256 + headerSize);
+
+    EXPECT_TRUE(allocator.TryResize(allocation, 128));
+    EXPECT_EQ(allocator.GetMemoryUsed(), 128 + headerSize);
+
+    void* blocker = allocator.Allocate(64, 8);
+    EXPECT_EQ((UIntPtr) blocker, (UIntPtr) allocation + 128 + headerSize);
+    EXPECT_FALSE(allocator.TryResize(allocation, 256));
+
+    allocator.Free(blocker);
+    allocator.Free(allocation);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    UInt64 count = 0;
+    for (auto& node: allocator)
+    {
+        EXPECT_EQ(node.Size, 1_KiB);
+        count++;
+    }
+    EXPECT_EQ(count, 1);
+
+    free(block);
+}
+
+TEST(FreeListAllocator, TryResize_SegregatedFit_InPlace)
+{
+    void* block = malloc(4_KiB);
+    Otter::FreeListAllocator allocator(block, 4_KiB, FreeListAllocator::Policy::SegregatedFit);
+
+    void* allocation = allocator.Allocate(64, 8);
+    const UInt64 usedMemory = allocator.GetMemoryUsed();
+
+    EXPECT_TRUE(allocator.TryResize(allocation, 1_KiB));
+    EXPECT_EQ(allocator.GetMemoryUsed(), usedMemory + 1_KiB - 64);
+
+    EXPECT_TRUE(allocator.TryResize(allocation, 64));
+    EXPECT_EQ(allocator.GetMemoryUsed(), usedMemory);
+
+    void* blocker = allocator.Allocate(64, 8);
+    EXPECT_FALSE(allocator.TryResize(allocation, 1_KiB));
+
+    allocator.Free(blocker);
+    allocator.Free(allocation);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    free(block);
+}
+
+TEST(FreeListAllocator, AllocateBelow)
+{
+    for (const auto policy: { FreeListAllocator::Policy::FirstFit, FreeListAllocator::Policy::SegregatedFit })
+    {
+        void* block = malloc(4_KiB);
+        Otter::FreeListAllocator allocator(block, 4_KiB, policy);
+
+        void* allocation1 = allocator.Allocate(256, 8);
+        void* allocation2 = allocator.Allocate(256, 8);
+        void* allocation3 = allocator.Allocate(256, 8);
+
+        // Only the end of the memory block is free, which lies above every allocation
+        EXPECT_EQ(allocator.AllocateBelow(allocation3, 128, 8), nullptr);
+
+        allocator.Free(allocation1);
+
+        void* below = allocator.AllocateBelow(allocation3, 128, 8);
+        EXPECT_NE(below, nullptr);
+        EXPECT_LT(below, allocation2);
+
+        // The rest of the hole is too small, and the free memory that fits lies above the limit
+        EXPECT_EQ(allocator.AllocateBelow(allocation2, 512, 8), nullptr);
+
+        allocator.Free(below);
+        allocator.Free(allocation2);
+        allocator.Free(allocation3);
+        EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+        free(block);
+    }
+}
+
 TEST(FreeListAllocator, GetMemoryFootprint)
 {
     void* block = malloc(1_KiB);
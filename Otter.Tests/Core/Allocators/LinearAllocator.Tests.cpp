@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "Core/Allocators/LinearAllocator.h"
+
+using LinearAllocator = Otter::LinearAllocator;
+
+TEST(LinearAllocator, Initialisation_Valid)
+{
+    void* block = malloc(1_KiB);
+    LinearAllocator allocator(block, 1_KiB);
+
+    EXPECT_EQ(allocator.GetMemorySize(), 1_KiB);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_EQ(allocator.GetMemoryFree(), 1_KiB);
+
+    free(block);
+}
+
+TEST(LinearAllocator, Initialisation_Invalid)
+{
+    ASSERT_DEATH(LinearAllocator allocator(nullptr, 1_KiB), "");
+}
+
+TEST(LinearAllocator, Allocate)
+{
+    void* block = malloc(1_KiB);
+    LinearAllocator allocator(block, 1_KiB);
+
+    void* allocation1 = allocator.Allocate(64, 8);
+    EXPECT_EQ(allocation1, block);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 64);
+
+    void* allocation2 = allocator.Allocate(4, 8);
+    EXPECT_EQ((UIntPtr) allocation2, (UIntPtr) block + 64);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 68);
+
+    void* allocation3 = allocator.Allocate(32, 16);
+    EXPECT_EQ((UIntPtr) allocation3 % 16, 0);
+    EXPECT_GE(allocator.GetMemoryUsed(), 68 + 32);
+
+    EXPECT_TRUE(allocator.Contains(allocation1));
+    EXPECT_TRUE(allocator.Contains(allocation3));
+    EXPECT_FALSE(allocator.Contains((void*) ((UIntPtr) block + 1_KiB)));
+
+    free(block);
+}
+
+TEST(LinearAllocator, Allocate_OutOfMemory)
+{
+    void* block = malloc(1_KiB);
+    LinearAllocator allocator(block, 1_KiB);
+
+    EXPECT_NE(allocator.Allocate(1_KiB, 8), nullptr);
+    EXPECT_EQ(allocator.Allocate(8, 8), nullptr);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 1_KiB);
+
+    free(block);
+}
+
+TEST(LinearAllocator, Free_Clear)
+{
+    void* block = malloc(1_KiB);
+    LinearAllocator allocator(block, 1_KiB);
+
+    void* allocation = allocator.Allocate(64, 8);
+    allocator.Free(allocation);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 64);
+
+    allocator.Clear();
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_EQ(allocator.Allocate(64, 8), allocation);
+
+    free(block);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include "Core/Allocators/PoolAllocator.h"
+#include "Core/Allocators/FreeListAllocator.h"
+
+using PoolAllocator = Otter::PoolAllocator;
+
+TEST(PoolAllocator, Initialisation_Valid)
+{
+    void* block = malloc(1_KiB);
+    PoolAllocator allocator(block, 1_KiB, 32);
+
+    EXPECT_EQ(allocator.GetMemorySize(), 1_KiB);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_EQ(allocator.GetBlockSize(), 32);
+    EXPECT_EQ(allocator.GetBlockAlignment(), OTR_PLATFORM_MEMORY_ALIGNMENT);
+    EXPECT_TRUE(allocator.HasFreeBlocks());
+
+    free(block);
+}
+
+TEST(PoolAllocator, Initialisation_Invalid)
+{
+    ASSERT_DEATH(PoolAllocator allocator(nullptr, 1_KiB, 32), "");
+}
+
+TEST(PoolAllocator, Allocate_Free)
+{
+    void* block = malloc(1_KiB);
+    PoolAllocator allocator(block, 1_KiB, 20);
+
+    void* allocation1 = allocator.Allocate(20, 8);
+    void* allocation2 = allocator.Allocate(16, 8);
+    EXPECT_EQ(allocation1, block);
+    EXPECT_EQ((UIntPtr) allocation2, (UIntPtr) block + 24);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 48);
+
+    allocator.Free(allocation1);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 24);
+
+    void* allocation3 = allocator.Allocate(20, 8);
+    EXPECT_EQ(allocation3, allocation1);
+
+    allocator.Free(allocation2);
+    allocator.Free(allocation3);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    free(block);
+}
+
+TEST(PoolAllocator, Allocate_OutOfBlocks)
+{
+    void* block = malloc(1_KiB);
+    PoolAllocator allocator(block, 1_KiB, 256);
+
+    for (UInt64 i = 0; i < 4; i++)
+        EXPECT_NE(allocator.Allocate(256, 8), nullptr);
+
+    EXPECT_FALSE(allocator.HasFreeBlocks());
+    EXPECT_EQ(allocator.Allocate(256, 8), nullptr);
+
+    allocator.Clear();
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_TRUE(allocator.HasFreeBlocks());
+
+    free(block);
+}
+
+TEST(PoolAllocator, Allocate_ChunkGrowth)
+{
+    void* block = malloc(4_KiB);
+    Otter::FreeListAllocator upstream(block, 4_KiB);
+
+    {
+        PoolAllocator allocator(64, 16, 512, &upstream);
+        EXPECT_EQ(allocator.GetMemorySize(), 0);
+        EXPECT_FALSE(allocator.HasFreeBlocks());
+
+        void* allocations[20];
+        for (auto& allocation: allocations)
+        {
+            allocation = allocator.Allocate(64, 16);
+            EXPECT_NE(allocation, nullptr);
+            EXPECT_EQ((UIntPtr) allocation % 16, 0);
+        }
+
+        EXPECT_EQ(allocator.GetMemoryUsed(), 20 * 64);
+        EXPECT_GE(allocator.GetMemorySize(), 20 * 64);
+        EXPECT_GT(upstream.GetMemoryUsed(), 0);
+
+        for (auto& allocation: allocations)
+            allocator.Free(allocation);
+
+        EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    }
+
+    EXPECT_EQ(upstream.GetMemoryUsed(), 0);
+
+    free(block);
+}
+
+TEST(PoolAllocator, GetMemoryFootprint)
+{
+    void* block = malloc(1_KiB);
+    PoolAllocator allocator(block, 1_KiB, 32);
+
+    allocator.Allocate(32, 8);
+    void* allocation = allocator.Allocate(32, 8);
+
+    UInt64 size, offset;
+    UInt16 padding, alignment;
+    allocator.GetMemoryFootprint(allocation, &size, &offset, &padding, &alignment);
+
+    EXPECT_EQ(size, 32);
+    EXPECT_EQ(offset, 32);
+    EXPECT_EQ(padding, 0);
+    EXPECT_EQ(alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+    free(block);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "Core/Allocators/StackAllocator.h"
+
+using StackAllocator = Otter::StackAllocator;
+
+TEST(StackAllocator, Initialisation_Valid)
+{
+    void* block = malloc(1_KiB);
+    StackAllocator allocator(block, 1_KiB);
+
+    EXPECT_EQ(allocator.GetMemorySize(), 1_KiB);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+    EXPECT_EQ(allocator.GetMemoryFree(), 1_KiB);
+    EXPECT_EQ(allocator.GetMarker(), 0);
+
+    free(block);
+}
+
+TEST(StackAllocator, Initialisation_Invalid)
+{
+    ASSERT_DEATH(StackAllocator allocator(nullptr, 1_KiB), "");
+}
+
+TEST(StackAllocator, Allocate)
+{
+    void* block = malloc(1_KiB);
+    StackAllocator allocator(block, 1_KiB);
+
+    const UInt64 headerSize = StackAllocator::GetAllocatorHeaderSize();
+
+    void* allocation1 = allocator.Allocate(64, 8);
+    EXPECT_EQ((UIntPtr) allocation1, (UIntPtr) block + headerSize);
+    EXPECT_EQ(allocator.GetMemoryUsed(), headerSize + 64);
+
+    void* allocation2 = allocator.Allocate(32, 64);
+    EXPECT_EQ((UIntPtr) allocation2 % 64, 0);
+    EXPECT_TRUE(allocator.IsTop(allocation2));
+    EXPECT_FALSE(allocator.IsTop(allocation1));
+
+    UInt64 size, offset;
+    UInt16 padding, alignment;
+    allocator.GetMemoryFootprint(allocation2, &size, &offset, &padding, &alignment);
+    EXPECT_EQ(size, 32);
+    EXPECT_EQ(offset, (UIntPtr) allocation2 - (UIntPtr) block);
+    EXPECT_EQ(padding, offset - (headerSize + 64));
+
+    EXPECT_EQ(allocator.Allocate(1_KiB, 8), nullptr);
+
+    free(block);
+}
+
+TEST(StackAllocator, Free_Lifo)
+{
+    void* block = malloc(1_KiB);
+    StackAllocator allocator(block, 1_KiB);
+
+    void* allocation1 = allocator.Allocate(64, 8);
+    void* allocation2 = allocator.Allocate(16, 16);
+
+    allocator.Free(allocation2);
+    EXPECT_TRUE(allocator.IsTop(allocation1));
+
+    allocator.Free(allocation1);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    EXPECT_EQ(allocator.Allocate(64, 8), allocation1);
+
+    free(block);
+}
+
+TEST(StackAllocator, FreeToMarker)
+{
+    void* block = malloc(1_KiB);
+    StackAllocator allocator(block, 1_KiB);
+
+    void* allocation = allocator.Allocate(64, 8);
+    const auto marker = allocator.GetMarker();
+
+    for (UInt64 i = 0; i < 16; i++)
+        EXPECT_NE(allocator.Allocate(16, 8), nullptr);
+
+    EXPECT_GT(allocator.GetMemoryUsed(), marker);
+
+    allocator.FreeToMarker(marker);
+    EXPECT_EQ(allocator.GetMemoryUsed(), marker);
+    EXPECT_TRUE(allocator.IsTop(allocation));
+
+    allocator.Clear();
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    free(block);
+}
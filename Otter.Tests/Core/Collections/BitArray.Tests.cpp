@@ -155,6 +155,132 @@ TEST_F(BitSet_Fixture, Includes)
     EXPECT_FALSE(bitset1.Includes(bitset3));
 }
 
+TEST_F(BitSet_Fixture, Includes_DifferentSizes)
+{
+    BitSet<int> small;
+    small.Set(3, true);
+
+    BitSet<int> large;
+    large.Set(3, true);
+    large.Set(700, true);
+
+    EXPECT_TRUE(large.Includes(small));
+    EXPECT_FALSE(small.Includes(large));
+
+    large.Set(700, false);
+
+    EXPECT_TRUE(small.Includes(large));
+}
+
+TEST_F(BitSet_Fixture, Intersects)
+{
+    BitSet<int> bitset1;
+    bitset1.Set(5, true);
+    bitset1.Set(600, true);
+
+    BitSet<int> bitset2;
+    bitset2.Set(600, true);
+
+    BitSet<int> bitset3;
+    bitset3.Set(4, true);
+
+    EXPECT_TRUE(bitset1.Intersects(bitset2));
+    EXPECT_TRUE(bitset2.Intersects(bitset1));
+    EXPECT_FALSE(bitset1.Intersects(bitset3));
+    EXPECT_FALSE(bitset2.Intersects(bitset3));
+}
+
+TEST_F(BitSet_Fixture, And_Or_Xor_AndNot)
+{
+    // Long enough to cover several vectors of words, with bits in both the vectors and the words after them
+    BitSet<int> left;
+    BitSet<int> right;
+    for (UInt64 i = 0; i < 1000; i += 3)
+        left.Set(i, true);
+    for (UInt64 i = 0; i < 500; i += 5)
+        right.Set(i, true);
+
+    const BitSet<int> andResult    = Otter::BitSet::And(left, right);
+    const BitSet<int> orResult     = Otter::BitSet::Or(right, left);
+    const BitSet<int> xorResult    = Otter::BitSet::Xor(left, right);
+    const BitSet<int> andNotResult = Otter::BitSet::AndNot(left, right);
+
+    EXPECT_EQ(andResult.GetSize(), left.GetSize());
+    EXPECT_EQ(orResult.GetSize(), left.GetSize());
+
+    for (UInt64 i = 0; i < left.GetBitsSize(); i++)
+    {
+        const bool inLeft  = i < 1000 && i % 3 == 0;
+        const bool inRight = i < 500 && i % 5 == 0;
+
+        EXPECT_EQ(andResult.Get(i), inLeft && inRight);
+        EXPECT_EQ(orResult.Get(i), inLeft || inRight);
+        EXPECT_EQ(xorResult.Get(i), inLeft != inRight);
+        EXPECT_EQ(andNotResult.Get(i), inLeft && !inRight);
+    }
+
+    // The in-place versions give the same bits
+    BitSet<int> bitset = left;
+    bitset.And(right);
+    EXPECT_EQ(bitset, andResult);
+
+    bitset = right;
+    bitset.Or(left);
+    EXPECT_EQ(bitset, orResult);
+
+    bitset = left;
+    bitset.Xor(right);
+    EXPECT_EQ(bitset, xorResult);
+
+    bitset = left;
+    bitset.AndNot(right);
+    EXPECT_EQ(bitset, andNotResult);
+}
+
+TEST_F(BitSet_Fixture, FindFirstSet_FindNextSet)
+{
+    BitSet<int> bitset;
+    EXPECT_EQ(bitset.FindFirstSet(), 0);
+
+    bitset.Reserve(512);
+    EXPECT_EQ(bitset.FindFirstSet(), bitset.GetBitsSize());
+
+    bitset.Set(70, true);
+    bitset.Set(71, true);
+    bitset.Set(400, true);
+
+    EXPECT_EQ(bitset.FindFirstSet(), 70);
+    EXPECT_EQ(bitset.FindNextSet(70), 70);
+    EXPECT_EQ(bitset.FindNextSet(71), 71);
+    EXPECT_EQ(bitset.FindNextSet(72), 400);
+    EXPECT_EQ(bitset.FindNextSet(401), bitset.GetBitsSize());
+    EXPECT_EQ(bitset.FindNextSet(10'000), bitset.GetBitsSize());
+}
+
+TEST_F(BitSet_Fixture, ForEachSetBit)
+{
+    BitSet<int> bitset;
+    for (const UInt64 index: { 0, 63, 64, 130, 300 })
+        bitset.Set(index, true);
+
+    UInt64 indices[5];
+    UInt64 count = 0;
+    bitset.ForEachSetBit([&](const UInt64 index)
+                         {
+                             if (count < 5)
+                                 indices[count] = index;
+
+                             count++;
+                         });
+
+    EXPECT_EQ(count, 5);
+    EXPECT_EQ(indices[0], 0);
+    EXPECT_EQ(indices[1], 63);
+    EXPECT_EQ(indices[2], 64);
+    EXPECT_EQ(indices[3], 130);
+    EXPECT_EQ(indices[4], 300);
+}
+
 TEST_F(BitSet_Fixture, Reserve)
 {
     BitSet<int> bitset = { true, false, true, false, true, false, true, false };
@@ -6,11 +6,18 @@
 template<typename TKey, typename TValue>
 using Dictionary = Otter::Dictionary<TKey, TValue>;
 
-using HashUtils = Otter::Internal::HashUtils;
-
 template<typename T>
 using List = Otter::List<T>;
 
+struct CollidingKey
+{
+    int Value;
+
+    [[nodiscard]] UInt64 GetHashCode() const noexcept { return 42; }
+
+    bool operator==(const CollidingKey& other) const noexcept { return Value == other.Value; }
+};
+
 class Dictionary_Fixture : public ::testing::Test
 {
 protected:
@@ -41,7 +48,7 @@ TEST_F(Dictionary_Fixture, Initialisation_FromInitialisationList)
                                        { 2, 2 },
                                        { 3, 3 }};
 
-    EXPECT_EQ(dictionary.GetCapacity(), 3);
+    EXPECT_EQ(dictionary.GetCapacity(), 4);
     EXPECT_EQ(dictionary.GetCount(), 3);
     EXPECT_FALSE(dictionary.IsEmpty());
 
@@ -50,7 +57,7 @@ TEST_F(Dictionary_Fixture, Initialisation_FromInitialisationList)
                   { 3, 3 },
                   { 4, 4 }};
 
-    EXPECT_EQ(dictionary.GetCapacity(), 7);
+    EXPECT_EQ(dictionary.GetCapacity(), 8);
     EXPECT_EQ(dictionary.GetCount(), 4);
     EXPECT_FALSE(dictionary.IsEmpty());
 }
@@ -156,43 +163,96 @@ TEST_F(Dictionary_Fixture, TryAdd_SimpleCases)
     EXPECT_EQ(dictionary.GetCapacity(), capacity);
 
     EXPECT_TRUE(dictionary.TryAdd(4, 4));
-    EXPECT_NE(dictionary.GetCapacity(), capacity) << "Capacity should have increased";
-    EXPECT_EQ(dictionary.GetCapacity(),
-              HashUtils::GetNextPrime(dictionary.GetCount() * Dictionary<int, int>::GetResizingFactor()));
+    EXPECT_EQ(dictionary.GetCapacity(), capacity * (Dictionary<int, int>::GetResizingFactor()))
+                    << "Capacity should have increased";
     capacity = dictionary.GetCapacity();
 
-    EXPECT_TRUE(dictionary.TryAdd(11, 11)) << "Collision with 4, should be added";
-    EXPECT_TRUE(dictionary.TryAdd(18, 18)) << "Collision with 4, should be added";
-    EXPECT_TRUE(dictionary.TryAdd(25, 25)) << "Collision with 4, should be added";
-    EXPECT_NE(dictionary.GetCapacity(), capacity) << "Capacity should have increased";
-    EXPECT_EQ(dictionary.GetCapacity(),
-              HashUtils::GetNextPrime(dictionary.GetCount() * Dictionary<int, int>::GetResizingFactor()));
+    EXPECT_TRUE(dictionary.TryAdd(5, 5));
+    EXPECT_TRUE(dictionary.TryAdd(6, 6));
+    EXPECT_TRUE(dictionary.TryAdd(7, 7));
+    EXPECT_EQ(dictionary.GetCapacity(), capacity) << "Capacity should not have increased";
+
+    EXPECT_TRUE(dictionary.TryAdd(8, 8));
+    EXPECT_EQ(dictionary.GetCapacity(), capacity * (Dictionary<int, int>::GetResizingFactor()))
+                    << "Capacity should have increased";
+    EXPECT_EQ(dictionary.GetCount(), 8);
+}
+
+TEST_F(Dictionary_Fixture, TryAdd_CollidingKeys)
+{
+    Dictionary<CollidingKey, int> dictionary;
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_TRUE(dictionary.TryAdd(CollidingKey{ i }, i));
+
+    EXPECT_EQ(dictionary.GetCount(), 20);
+
+    for (int i = 0; i < 20; i++)
+    {
+        int value = -1;
+        EXPECT_TRUE(dictionary.TryGet(CollidingKey{ i }, &value));
+        EXPECT_EQ(value, i);
+    }
+
+    for (int i = 0; i < 20; i += 2)
+        EXPECT_TRUE(dictionary.TryRemove(CollidingKey{ i }));
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_EQ(dictionary.ContainsKey(CollidingKey{ i }), i % 2 == 1);
+
+    for (int i = 0; i < 20; i += 2)
+        EXPECT_TRUE(dictionary.TryAdd(CollidingKey{ i }, i * 10));
+
+    EXPECT_EQ(dictionary.GetCount(), 20);
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_EQ(*dictionary[CollidingKey{ i }], i % 2 == 0 ? i * 10 : i);
 }
 
-TEST_F(Dictionary_Fixture, TryAdd_CollisionSlots)
+TEST_F(Dictionary_Fixture, TryAdd_ChurnKeepsCapacity)
 {
     Dictionary<int, int> dictionary;
+    dictionary.EnsureCapacity(64);
 
-    EXPECT_TRUE(dictionary.TryAdd(0, 0));
-    UInt64 capacity = Dictionary<int, int>::GetDefaultInitialCapacity();
-    EXPECT_EQ(dictionary.GetCapacity(), capacity);
+    const UInt64 capacity = dictionary.GetCapacity();
+
+    for (int i = 0; i < 48; i++)
+        EXPECT_TRUE(dictionary.TryAdd(i, i));
 
-    UInt64 index = 0;
-    EXPECT_TRUE(dictionary.TryGetIndex(0, &index));
-    EXPECT_EQ(index, 0) << "0 should be at index 0";
+    for (int i = 48; i < 4096; i++)
+    {
+        EXPECT_TRUE(dictionary.TryRemove(i - 48));
+        EXPECT_TRUE(dictionary.TryAdd(i, i));
+    }
 
-    EXPECT_TRUE(dictionary.TryAdd(3, 3)) << "Collision with 0, should be added";
-    EXPECT_TRUE(dictionary.TryGetIndex(3, &index));
-    EXPECT_EQ(index, 1) << "0 should be at index 0, and since 3 is a collision, it should be at index 1 (next "
-                           "available slot)";
+    EXPECT_EQ(dictionary.GetCount(), 48);
+    EXPECT_EQ(dictionary.GetCapacity(), capacity) << "Removed slots should be reused instead of growing";
 
-    EXPECT_TRUE(dictionary.TryAdd(1, 1)) << "Collision with item at index 1, should be added";
-    EXPECT_TRUE(dictionary.TryGetIndex(1, &index));
-    EXPECT_EQ(index, 1) << "1 should replace item at index 1";
-    EXPECT_TRUE(dictionary.TryGetIndex(3, &index));
-    EXPECT_EQ(index, 2) << "3 should have been moved to index 2, since it was a collision (next available slot)";
+    for (int i = 4096 - 48; i < 4096; i++)
+        EXPECT_TRUE(dictionary.ContainsKey(i));
+}
 
-    EXPECT_EQ(dictionary.GetCapacity(), capacity) << "Capacity should not have increased";
+TEST_F(Dictionary_Fixture, TryAddRange)
+{
+    Dictionary<int, int> dictionary = {{ 1, 1 }};
+
+    EXPECT_TRUE(dictionary.TryAddRange({{ 1, 10 },
+                                        { 2, 2 },
+                                        { 3, 3 }}));
+    EXPECT_EQ(dictionary.GetCount(), 3);
+    EXPECT_EQ(*dictionary[1], 10) << "Existing key should have its value replaced";
+
+    List<Otter::KeyValuePair<int, int>> pairs;
+    for (int i = 0; i < 100; i++)
+        pairs.Add({ i, i * 2 });
+
+    EXPECT_TRUE(dictionary.TryAddRange(pairs));
+    EXPECT_EQ(dictionary.GetCount(), 100);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(*dictionary[i], i * 2);
+
+    EXPECT_FALSE(dictionary.TryAddRange(List<Otter::KeyValuePair<int, int>>()));
 }
 
 TEST_F(Dictionary_Fixture, TryGet)
@@ -234,6 +294,64 @@ TEST_F(Dictionary_Fixture, TryGet)
     EXPECT_FALSE(dictionary.IsEmpty());
 }
 
+TEST_F(Dictionary_Fixture, TryGet_HashedKey)
+{
+    Dictionary<int, int> dictionary = {{ 1, 10 },
+                                       { 2, 20 }};
+
+    const int key = 2;
+    const Otter::HashedKey<int> hashedKey(key);
+    EXPECT_EQ(hashedKey.GetHashCode(), GetHashCode(key));
+
+    int value = 0;
+    EXPECT_TRUE(dictionary.TryGet(hashedKey, &value));
+    EXPECT_EQ(value, 20);
+    EXPECT_TRUE(dictionary.ContainsKey(hashedKey));
+    EXPECT_EQ(*dictionary[hashedKey], 20);
+
+    value = 0;
+    EXPECT_TRUE(dictionary.TryGetWithHash(1, GetHashCode(1), &value));
+    EXPECT_EQ(value, 10);
+
+    const int missingKey = 3;
+    const Otter::HashedKey<int> missingHashedKey(missingKey);
+    EXPECT_FALSE(dictionary.TryGet(missingHashedKey, &value));
+    EXPECT_FALSE(dictionary.ContainsKey(missingHashedKey));
+    EXPECT_EQ(dictionary[missingHashedKey], nullptr);
+
+    EXPECT_TRUE(dictionary.TryAdd(missingHashedKey, 30));
+    EXPECT_EQ(*dictionary[missingKey], 30);
+    EXPECT_EQ(dictionary.GetCount(), 3);
+}
+
+TEST_F(Dictionary_Fixture, FindOrInsert)
+{
+    Dictionary<int, int> dictionary;
+
+    bool inserted = false;
+    dictionary.FindOrInsert(1, &inserted) = 10;
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(dictionary.GetCount(), 1);
+    EXPECT_EQ(*dictionary[1], 10);
+
+    dictionary.FindOrInsert(1, &inserted) += 5;
+    EXPECT_FALSE(inserted);
+    EXPECT_EQ(dictionary.GetCount(), 1);
+    EXPECT_EQ(*dictionary[1], 15);
+
+    for (int i = 0; i < 20; i++)
+        dictionary.FindOrInsert(i)++;
+
+    EXPECT_EQ(dictionary.GetCount(), 20);
+    EXPECT_EQ(*dictionary[1], 16);
+    EXPECT_EQ(*dictionary[19], 1);
+
+    const int key = 25;
+    EXPECT_EQ(dictionary.FindOrInsert(Otter::HashedKey<int>(key), &inserted), 0);
+    EXPECT_TRUE(inserted);
+    EXPECT_TRUE(dictionary.ContainsKey(key));
+}
+
 TEST_F(Dictionary_Fixture, TryRemove_SimpleCases)
 {
     Dictionary<int, int> dictionary = {{ 1, 1 },
@@ -327,13 +445,14 @@ TEST_F(Dictionary_Fixture, ForEach)
                            (*value)++;
                        });
 
-    count = 1;
+    count = 0;
     dictionary.ForEach([&count](int key, int* value)
                        {
-                           EXPECT_EQ(++count, *value);
+                           EXPECT_EQ(key + 1, *value);
+                           ++count;
                        });
 
-    EXPECT_EQ(count, dictionary.GetCount() + 1);
+    EXPECT_EQ(count, dictionary.GetCount());
 }
 
 TEST_F(Dictionary_Fixture, TryForKey)
@@ -384,12 +503,15 @@ TEST_F(Dictionary_Fixture, ForEachKey)
                                        { 5, 5 }};
 
     int count = 0;
-    dictionary.ForEachKey([&count](int key)
+    int sum   = 0;
+    dictionary.ForEachKey([&count, &sum](int key)
                           {
-                              EXPECT_EQ(++count, key);
+                              sum += key;
+                              ++count;
                           });
 
     EXPECT_EQ(count, dictionary.GetCount());
+    EXPECT_EQ(sum, 15);
 }
 
 TEST_F(Dictionary_Fixture, ForEachValue)
@@ -406,25 +528,28 @@ TEST_F(Dictionary_Fixture, ForEachValue)
                             });
 
     int count = 0;
-    dictionary.ForEachValue([&count](int value)
+    int sum   = 0;
+    dictionary.ForEachValue([&count, &sum](int value)
                             {
-                                EXPECT_EQ(++count, value);
+                                sum += value;
+                                ++count;
                             });
 
     EXPECT_EQ(count, dictionary.GetCount());
+    EXPECT_EQ(sum, 15);
 
     dictionary.ForEachValue([](int* value)
                             {
                                 (*value)++;
                             });
 
-    count = 1;
-    dictionary.ForEachValue([&count](int* value)
+    sum = 0;
+    dictionary.ForEachValue([&sum](int* value)
                             {
-                                EXPECT_EQ(++count, *value);
+                                sum += *value;
                             });
 
-    EXPECT_EQ(count, dictionary.GetCount() + 1);
+    EXPECT_EQ(sum, 15 + dictionary.GetCount());
 }
 
 TEST_F(Dictionary_Fixture, EnsureCapacity)
@@ -443,6 +568,30 @@ TEST_F(Dictionary_Fixture, EnsureCapacity)
     EXPECT_TRUE(dictionary.ContainsKey(1));
 }
 
+TEST_F(Dictionary_Fixture, Reserve)
+{
+    Dictionary<int, int> dictionary;
+    dictionary.Reserve(100);
+
+    const UInt64 capacity = dictionary.GetCapacity();
+    EXPECT_GE(capacity, 100);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_TRUE(dictionary.TryAdd(i, i));
+
+    EXPECT_EQ(dictionary.GetCapacity(), capacity) << "Capacity should not have increased";
+
+    dictionary.Reserve(50);
+    EXPECT_EQ(dictionary.GetCapacity(), capacity) << "Reserving less than the count should do nothing";
+
+    dictionary.Reserve(1000);
+    EXPECT_GE(dictionary.GetCapacity(), 1000);
+    EXPECT_EQ(dictionary.GetCount(), 100);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_TRUE(dictionary.ContainsKey(i));
+}
+
 TEST_F(Dictionary_Fixture, Clear)
 {
     Dictionary<int, int> dictionary = {{ 1, 1 },
@@ -503,27 +652,23 @@ TEST_F(Dictionary_Fixture, GetMemoryFootprint)
                                        { 5, 5 }};
 
     auto footprint1 = dictionary.GetMemoryFootprint(OTR_NAME_OF(Dictionary<int, int>));
-    EXPECT_EQ(footprint1.GetSize(), 3);
+    EXPECT_EQ(footprint1.GetSize(), 1);
 
     auto* pointer1 = footprint1[0].GetData().GetPointer();
 
     EXPECT_EQ(footprint1[0].GetData().GetName(), OTR_NAME_OF(Dictionary<int, int>));
     EXPECT_NE(pointer1, nullptr);
-    EXPECT_NE(footprint1[0].Offset, Otter::FreeListAllocator::GetAllocatorHeaderSize());
+    EXPECT_EQ(footprint1[0].Offset, Otter::FreeListAllocator::GetAllocatorHeaderSize())
+                    << "Control bytes and slots share one block, which is the first allocation";
     EXPECT_EQ(footprint1[0].Padding, 0);
     EXPECT_EQ(footprint1[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-    EXPECT_EQ(footprint1[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint1[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint1[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint1[2].GetData().GetPointer(), nullptr);
-
     dictionary.TryAdd(6, 6);
     dictionary.TryAdd(7, 7);
     dictionary.TryAdd(8, 8);
 
     auto footprint2 = dictionary.GetMemoryFootprint(OTR_NAME_OF(Dictionary<int, int>));
-    EXPECT_EQ(footprint2.GetSize(), 3);
+    EXPECT_EQ(footprint2.GetSize(), 1);
 
     EXPECT_EQ(footprint2[0].GetData().GetName(), OTR_NAME_OF(Dictionary<int, int>));
     EXPECT_NE(footprint2[0].GetData().GetPointer(), pointer1);
@@ -535,15 +680,10 @@ TEST_F(Dictionary_Fixture, GetMemoryFootprint)
     EXPECT_EQ(footprint2[0].Padding, 0);
     EXPECT_EQ(footprint2[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-    EXPECT_EQ(footprint2[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint2[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint2[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint2[2].GetData().GetPointer(), nullptr);
-
     dictionary.ClearDestructive();
 
     auto footprint3 = dictionary.GetMemoryFootprint(OTR_NAME_OF(Dictionary<int, int>));
-    EXPECT_EQ(footprint3.GetSize(), 3);
+    EXPECT_EQ(footprint3.GetSize(), 1);
 
     EXPECT_EQ(footprint3[0].GetData().GetName(), OTR_NAME_OF(Dictionary<int, int>));
     EXPECT_EQ(footprint3[0].GetData().GetPointer(), nullptr);
@@ -551,27 +691,21 @@ TEST_F(Dictionary_Fixture, GetMemoryFootprint)
     EXPECT_EQ(footprint3[0].Offset, 0);
     EXPECT_EQ(footprint3[0].Padding, 0);
     EXPECT_EQ(footprint3[0].Alignment, 0);
-
-    EXPECT_EQ(footprint3[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_EQ(footprint3[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint3[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_EQ(footprint3[2].GetData().GetPointer(), nullptr);
 }
 
 TEST_F(Dictionary_Fixture, Iterator)
 {
-    int temp[] = { 1, 2, 5, 6 };
-
     Dictionary<int, int> dictionary = {{ 1, 1 },
                                        { 2, 2 },
                                        { 5, 5 },
                                        { 6, 6 }};
 
-    UInt64 i = 0;
+    UInt64 i   = 0;
+    int    sum = 0;
     for (auto& [key, value]: dictionary)
     {
-        EXPECT_EQ(key, temp[i]);
-        EXPECT_EQ(value, temp[i]);
+        EXPECT_EQ(key, value);
+        sum += key;
 
         value++;
 
@@ -579,13 +713,52 @@ TEST_F(Dictionary_Fixture, Iterator)
     }
 
     EXPECT_EQ(i, dictionary.GetCount());
+    EXPECT_EQ(sum, 14);
 
     for (auto it = dictionary.rbegin(); it != dictionary.rend(); --it)
     {
-        EXPECT_EQ((*it).Key, temp[i - 1]);
-        EXPECT_EQ((*it).Value, temp[i - 1] + 1);
+        EXPECT_EQ((*it).Value, (*it).Key + 1);
+        sum -= (*it).Key;
         --i;
     }
 
     EXPECT_EQ(i, 0);
-}
\ No newline at end of file
+    EXPECT_EQ(sum, 0);
+}
+
+TEST_F(Dictionary_Fixture, Iterator_Sparse)
+{
+    Dictionary<int, int> dictionary;
+    dictionary.Reserve(100);
+    dictionary.TryAdd(1, 1);
+    dictionary.TryAdd(50, 50);
+    dictionary.TryAdd(99, 99);
+
+    EXPECT_GT(dictionary.GetCapacity(), 16);
+
+    const UInt64 allocationCount =
+                     Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount;
+
+    UInt64 i   = 0;
+    int    sum = 0;
+    for (const auto& [key, value]: dictionary)
+    {
+        EXPECT_EQ(key, value);
+        sum += key;
+        ++i;
+    }
+
+    EXPECT_EQ(i, 3);
+    EXPECT_EQ(sum, 150);
+
+    for (auto it = dictionary.rbegin(); it != dictionary.rend(); --it)
+    {
+        sum -= (*it).Key;
+        --i;
+    }
+
+    EXPECT_EQ(i, 0);
+    EXPECT_EQ(sum, 0);
+    EXPECT_EQ(Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount,
+              allocationCount);
+}
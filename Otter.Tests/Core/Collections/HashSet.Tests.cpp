@@ -2,14 +2,22 @@
 
 #include "Core/Collections/HashSet.h"
 #include "Core/Collections/BitSet.h"
+#include "Core/Collections/List.h"
 
 template<typename T>
 using HashSet = Otter::HashSet<T>;
 
-using HashUtils = Otter::Internal::HashUtils;
-
 using BitSet = Otter::BitSet;
 
+struct CollidingItem
+{
+    int Value;
+
+    [[nodiscard]] UInt64 GetHashCode() const noexcept { return 42; }
+
+    bool operator==(const CollidingItem& other) const noexcept { return Value == other.Value; }
+};
+
 class HashSet_Fixture : public ::testing::Test
 {
 protected:
@@ -39,13 +47,13 @@ TEST_F(HashSet_Fixture, Initialisation_FromInitialisationList)
 {
     HashSet<int> hashSet = { 1, 2, 3, 4, 4, 4, 5 };
 
-    EXPECT_EQ(hashSet.GetCapacity(), 7);
+    EXPECT_EQ(hashSet.GetCapacity(), 8);
     EXPECT_EQ(hashSet.GetCount(), 5);
     EXPECT_FALSE(hashSet.IsEmpty());
 
     hashSet = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10 };
 
-    EXPECT_EQ(hashSet.GetCapacity(), 11);
+    EXPECT_EQ(hashSet.GetCapacity(), 16);
     EXPECT_EQ(hashSet.GetCount(), 10);
     EXPECT_FALSE(hashSet.IsEmpty());
 }
@@ -115,41 +123,77 @@ TEST_F(HashSet_Fixture, TryAdd_SimpleCases)
     EXPECT_EQ(hashSet.GetCapacity(), capacity);
 
     EXPECT_TRUE(hashSet.TryAdd(4));
-    EXPECT_NE(hashSet.GetCapacity(), capacity) << "Capacity should have increased";
-    EXPECT_EQ(hashSet.GetCapacity(), HashUtils::GetNextPrime(hashSet.GetCount() * HashSet<int>::GetResizingFactor()));
+    EXPECT_EQ(hashSet.GetCapacity(), capacity * HashSet<int>::GetResizingFactor()) << "Capacity should have increased";
     capacity = hashSet.GetCapacity();
 
-    EXPECT_TRUE(hashSet.TryAdd(11)) << "Collision with 4, should be added";
-    EXPECT_TRUE(hashSet.TryAdd(18)) << "Collision with 4, should be added";
-    EXPECT_TRUE(hashSet.TryAdd(25)) << "Collision with 4, should be added";
-    EXPECT_NE(hashSet.GetCapacity(), capacity) << "Capacity should have increased";
-    EXPECT_EQ(hashSet.GetCapacity(), HashUtils::GetNextPrime(hashSet.GetCount() * HashSet<int>::GetResizingFactor()));
+    EXPECT_TRUE(hashSet.TryAdd(5));
+    EXPECT_TRUE(hashSet.TryAdd(6));
+    EXPECT_TRUE(hashSet.TryAdd(7));
+    EXPECT_EQ(hashSet.GetCapacity(), capacity) << "Capacity should not have increased";
+
+    EXPECT_TRUE(hashSet.TryAdd(8));
+    EXPECT_EQ(hashSet.GetCapacity(), capacity * HashSet<int>::GetResizingFactor()) << "Capacity should have increased";
+    EXPECT_EQ(hashSet.GetCount(), 8);
+}
+
+TEST_F(HashSet_Fixture, TryAdd_CollidingItems)
+{
+    HashSet<CollidingItem> hashSet;
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_TRUE(hashSet.TryAdd(CollidingItem{ i }));
+
+    EXPECT_FALSE(hashSet.TryAdd(CollidingItem{ 7 })) << "Value already exists";
+    EXPECT_EQ(hashSet.GetCount(), 20);
+
+    for (int i = 0; i < 20; i += 2)
+        EXPECT_TRUE(hashSet.TryRemove(CollidingItem{ i }));
+
+    for (int i = 0; i < 20; i++)
+        EXPECT_EQ(hashSet.Contains(CollidingItem{ i }), i % 2 == 1);
+
+    for (int i = 0; i < 20; i += 2)
+        EXPECT_TRUE(hashSet.TryAdd(CollidingItem{ i }));
+
+    EXPECT_EQ(hashSet.GetCount(), 20);
 }
 
-TEST_F(HashSet_Fixture, TryAdd_CollisionSlots)
+TEST_F(HashSet_Fixture, TryAdd_ChurnKeepsCapacity)
 {
     HashSet<int> hashSet;
+    hashSet.EnsureCapacity(64);
 
-    EXPECT_TRUE(hashSet.TryAdd(0));
-    UInt64 capacity = HashSet<int>::GetDefaultInitialCapacity();
-    EXPECT_EQ(hashSet.GetCapacity(), capacity);
+    const UInt64 capacity = hashSet.GetCapacity();
 
-    UInt64 index = 0;
-    EXPECT_TRUE(hashSet.TryGetIndex(0, &index));
-    EXPECT_EQ(index, 0) << "0 should be at index 0";
+    for (int i = 0; i < 48; i++)
+        EXPECT_TRUE(hashSet.TryAdd(i));
 
-    EXPECT_TRUE(hashSet.TryAdd(3)) << "Collision with 0, should be added";
-    EXPECT_TRUE(hashSet.TryGetIndex(3, &index));
-    EXPECT_EQ(index, 1) << "0 should be at index 0, and since 3 is a collision, it should be at index 1 (next "
-                           "available slot)";
+    for (int i = 48; i < 4096; i++)
+    {
+        EXPECT_TRUE(hashSet.TryRemove(i - 48));
+        EXPECT_TRUE(hashSet.TryAdd(i));
+    }
 
-    EXPECT_TRUE(hashSet.TryAdd(1)) << "Collision with item at index 1, should be added";
-    EXPECT_TRUE(hashSet.TryGetIndex(1, &index));
-    EXPECT_EQ(index, 1) << "1 should replace item at index 1";
-    EXPECT_TRUE(hashSet.TryGetIndex(3, &index));
-    EXPECT_EQ(index, 2) << "3 should have been moved to index 2, since it was a collision (next available slot)";
+    EXPECT_EQ(hashSet.GetCount(), 48);
+    EXPECT_EQ(hashSet.GetCapacity(), capacity) << "Removed slots should be reused instead of growing";
+}
 
-    EXPECT_EQ(hashSet.GetCapacity(), capacity) << "Capacity should not have increased";
+TEST_F(HashSet_Fixture, TryAddRange)
+{
+    HashSet<int> hashSet = { 1 };
+
+    EXPECT_FALSE(hashSet.TryAddRange({ 1, 2, 3 })) << "1 already exists";
+    EXPECT_EQ(hashSet.GetCount(), 3);
+
+    Otter::List<int> items;
+    for (int i = 10; i < 110; i++)
+        items.Add(i);
+
+    EXPECT_TRUE(hashSet.TryAddRange(items));
+    EXPECT_EQ(hashSet.GetCount(), 103);
+
+    for (int i = 10; i < 110; i++)
+        EXPECT_TRUE(hashSet.Contains(i));
 }
 
 TEST_F(HashSet_Fixture, TryRemove_SimpleCases)
@@ -207,12 +251,15 @@ TEST_F(HashSet_Fixture, ForEach)
     HashSet<int> hashSet = { 1, 2, 3, 4, 5 };
 
     int count = 0;
-    hashSet.ForEach([&count](int value)
+    int sum   = 0;
+    hashSet.ForEach([&count, &sum](int value)
                     {
-                        EXPECT_EQ(value, ++count);
+                        sum += value;
+                        ++count;
                     });
 
     EXPECT_EQ(count, 5);
+    EXPECT_EQ(sum, 15);
 }
 
 TEST_F(HashSet_Fixture, EnsureCapacity)
@@ -231,6 +278,20 @@ TEST_F(HashSet_Fixture, EnsureCapacity)
     EXPECT_TRUE(hashSet.Contains(1));
 }
 
+TEST_F(HashSet_Fixture, Reserve)
+{
+    HashSet<int> hashSet;
+    hashSet.Reserve(100);
+
+    const UInt64 capacity = hashSet.GetCapacity();
+    EXPECT_GE(capacity, 100);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_TRUE(hashSet.TryAdd(i));
+
+    EXPECT_EQ(hashSet.GetCapacity(), capacity) << "Capacity should not have increased";
+}
+
 TEST_F(HashSet_Fixture, Clear)
 {
     HashSet<int> hashSet = { 1, 2, 3, 4, 5 };
@@ -287,27 +348,23 @@ TEST_F(HashSet_Fixture, GetMemoryFootprint)
     HashSet<int> hashSet = { 1, 2, 3, 4, 5 };
 
     auto footprint1 = hashSet.GetMemoryFootprint(OTR_NAME_OF(HashSet<int>));
-    EXPECT_EQ(footprint1.GetSize(), 3);
+    EXPECT_EQ(footprint1.GetSize(), 1);
 
     auto* pointer1 = footprint1[0].GetData().GetPointer();
 
     EXPECT_EQ(footprint1[0].GetData().GetName(), OTR_NAME_OF(HashSet<int>));
     EXPECT_NE(pointer1, nullptr);
-    EXPECT_NE(footprint1[0].Offset, Otter::FreeListAllocator::GetAllocatorHeaderSize());
+    EXPECT_EQ(footprint1[0].Offset, Otter::FreeListAllocator::GetAllocatorHeaderSize())
+                    << "Control bytes and slots share one block, which is the first allocation";
     EXPECT_EQ(footprint1[0].Padding, 0);
     EXPECT_EQ(footprint1[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-    EXPECT_EQ(footprint1[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint1[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint1[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint1[2].GetData().GetPointer(), nullptr);
-
     hashSet.TryAdd(6);
     hashSet.TryAdd(7);
     hashSet.TryAdd(8);
 
     auto footprint2 = hashSet.GetMemoryFootprint(OTR_NAME_OF(HashSet<int>));
-    EXPECT_EQ(footprint2.GetSize(), 3);
+    EXPECT_EQ(footprint2.GetSize(), 1);
 
     EXPECT_EQ(footprint2[0].GetData().GetName(), OTR_NAME_OF(HashSet<int>));
     EXPECT_NE(footprint2[0].GetData().GetPointer(), pointer1);
@@ -319,15 +376,10 @@ TEST_F(HashSet_Fixture, GetMemoryFootprint)
     EXPECT_EQ(footprint2[0].Padding, 0);
     EXPECT_EQ(footprint2[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-    EXPECT_EQ(footprint2[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint2[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint2[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_NE(footprint2[2].GetData().GetPointer(), nullptr);
-
     hashSet.ClearDestructive();
 
     auto footprint3 = hashSet.GetMemoryFootprint(OTR_NAME_OF(HashSet<int>));
-    EXPECT_EQ(footprint3.GetSize(), 3);
+    EXPECT_EQ(footprint3.GetSize(), 1);
 
     EXPECT_EQ(footprint3[0].GetData().GetName(), OTR_NAME_OF(HashSet<int>));
     EXPECT_EQ(footprint3[0].GetData().GetPointer(), nullptr);
@@ -335,32 +387,65 @@ TEST_F(HashSet_Fixture, GetMemoryFootprint)
     EXPECT_EQ(footprint3[0].Offset, 0);
     EXPECT_EQ(footprint3[0].Padding, 0);
     EXPECT_EQ(footprint3[0].Alignment, 0);
-
-    EXPECT_EQ(footprint3[1].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_EQ(footprint3[1].GetData().GetPointer(), nullptr);
-    EXPECT_EQ(footprint3[2].GetData().GetName(), OTR_NAME_OF(BitSet));
-    EXPECT_EQ(footprint3[2].GetData().GetPointer(), nullptr);
 }
 
 TEST_F(HashSet_Fixture, Iterator)
 {
-    int          temp[]  = { 1, 2, 5, 6 };
     HashSet<int> hashSet = { 1, 2, 5, 6 };
 
-    UInt64 i = 0;
+    UInt64 i   = 0;
+    int    sum = 0;
     for (const auto& item: hashSet)
     {
-        EXPECT_EQ(item, temp[i]);
+        sum += item;
         ++i;
     }
 
     EXPECT_EQ(i, hashSet.GetCount());
+    EXPECT_EQ(sum, 14);
+
+    for (auto it = hashSet.rbegin(); it != hashSet.rend(); --it)
+    {
+        sum -= *it;
+        --i;
+    }
+
+    EXPECT_EQ(i, 0);
+    EXPECT_EQ(sum, 0);
+}
+
+TEST_F(HashSet_Fixture, Iterator_Sparse)
+{
+    HashSet<int> hashSet;
+    hashSet.Reserve(100);
+    hashSet.TryAdd(1);
+    hashSet.TryAdd(50);
+    hashSet.TryAdd(99);
+
+    EXPECT_GT(hashSet.GetCapacity(), 16);
+
+    const UInt64 allocationCount =
+                     Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount;
+
+    UInt64 i   = 0;
+    int    sum = 0;
+    for (const auto& item: hashSet)
+    {
+        sum += item;
+        ++i;
+    }
+
+    EXPECT_EQ(i, 3);
+    EXPECT_EQ(sum, 150);
 
     for (auto it = hashSet.rbegin(); it != hashSet.rend(); --it)
     {
-        EXPECT_EQ(*it, temp[i - 1]);
+        sum -= *it;
         --i;
     }
 
     EXPECT_EQ(i, 0);
-}
\ No newline at end of file
+    EXPECT_EQ(sum, 0);
+    EXPECT_EQ(Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount,
+              allocationCount);
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include "Core/Collections/InlineList.h"
+#include "Core/Collections/List.h"
+
+template<typename T, UInt64 InlineCapacity>
+using InlineList = Otter::InlineList<T, InlineCapacity>;
+
+template<typename T>
+using List = Otter::List<T>;
+
+class InlineList_Fixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Otter::MemorySystem::Initialise(1_KiB);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(Otter::MemorySystem::GetUsedMemory(), 0);
+        Otter::MemorySystem::Shutdown();
+    }
+
+    static UInt64 GetAllocationCount()
+    {
+        return Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount;
+    }
+};
+
+TEST_F(InlineList_Fixture, Initialisation_Default)
+{
+    InlineList<int, 4> list;
+
+    EXPECT_NE(list.GetData(), nullptr);
+    EXPECT_EQ(list.GetCapacity(), 4);
+    EXPECT_EQ(list.GetCount(), 0);
+
+    EXPECT_TRUE(list.IsEmpty());
+    EXPECT_FALSE(list.IsSpilled());
+}
+
+TEST_F(InlineList_Fixture, Initialisation_FromInitialisationList)
+{
+    InlineList<int, 4> inlineList = { 1, 2, 3 };
+
+    EXPECT_EQ(inlineList.GetCapacity(), 4);
+    EXPECT_EQ(inlineList.GetCount(), 3);
+    EXPECT_FALSE(inlineList.IsSpilled());
+
+    for (UInt64 i = 0; i < inlineList.GetCount(); ++i)
+        EXPECT_EQ(inlineList[i], i + 1);
+
+    InlineList<int, 4> spilledList = { 1, 2, 3, 4, 5 };
+
+    EXPECT_EQ(spilledList.GetCapacity(), 5);
+    EXPECT_EQ(spilledList.GetCount(), 5);
+    EXPECT_TRUE(spilledList.IsSpilled());
+
+    for (UInt64 i = 0; i < spilledList.GetCount(); ++i)
+        EXPECT_EQ(spilledList[i], i + 1);
+}
+
+TEST_F(InlineList_Fixture, Initialisation_Copy)
+{
+    InlineList<int, 4> inlineList = { 1, 2, 3 };
+    InlineList<int, 4> inlineCopy = inlineList;
+
+    EXPECT_NE(inlineCopy.GetData(), inlineList.GetData());
+    EXPECT_FALSE(inlineCopy.IsSpilled());
+    EXPECT_EQ(inlineCopy, inlineList);
+
+    InlineList<int, 4> spilledList = { 1, 2, 3, 4, 5 };
+    InlineList<int, 4> spilledCopy = spilledList;
+
+    EXPECT_NE(spilledCopy.GetData(), spilledList.GetData());
+    EXPECT_TRUE(spilledCopy.IsSpilled());
+    EXPECT_EQ(spilledCopy, spilledList);
+}
+
+TEST_F(InlineList_Fixture, Initialisation_Move)
+{
+    InlineList<int, 4> inlineList = { 1, 2, 3 };
+    InlineList<int, 4> inlineMove = std::move(inlineList);
+
+    EXPECT_FALSE(inlineMove.IsSpilled());
+    EXPECT_EQ(inlineMove.GetCount(), 3);
+    EXPECT_EQ(inlineMove[2], 3);
+    EXPECT_TRUE(inlineList.IsEmpty());
+
+    InlineList<int, 4> spilledList = { 1, 2, 3, 4, 5 };
+    const int* data = spilledList.GetData();
+
+    InlineList<int, 4> spilledMove = std::move(spilledList);
+
+    EXPECT_EQ(spilledMove.GetData(), data);
+    EXPECT_EQ(spilledMove.GetCount(), 5);
+    EXPECT_TRUE(spilledList.IsEmpty());
+    EXPECT_FALSE(spilledList.IsSpilled());
+}
+
+TEST_F(InlineList_Fixture, Assignment)
+{
+    InlineList<int, 4> spilledList = { 1, 2, 3, 4, 5 };
+    InlineList<int, 4> list        = { 6, 7 };
+
+    list = spilledList;
+    EXPECT_EQ(list, spilledList);
+
+    list = InlineList<int, 4>{ 8 };
+    EXPECT_FALSE(list.IsSpilled());
+    EXPECT_EQ(list.GetCount(), 1);
+    EXPECT_EQ(list[0], 8);
+
+    list = std::move(spilledList);
+    EXPECT_TRUE(list.IsSpilled());
+    EXPECT_EQ(list.GetCount(), 5);
+}
+
+TEST_F(InlineList_Fixture, Add_StaysInlineUntilFull)
+{
+    const UInt64 allocationCount = GetAllocationCount();
+
+    InlineList<int, 4> list;
+    for (int i = 0; i < 4; i++)
+        list.Add(i);
+
+    EXPECT_FALSE(list.IsSpilled());
+    EXPECT_EQ(GetAllocationCount(), allocationCount);
+
+    list.Add(4);
+
+    EXPECT_TRUE(list.IsSpilled());
+    EXPECT_EQ(list.GetCapacity(), 8);
+    EXPECT_EQ(GetAllocationCount(), allocationCount + 1);
+
+    for (int i = 5; i < 20; i++)
+        list.Add(i);
+
+    EXPECT_EQ(list.GetCount(), 20);
+    for (UInt64 i = 0; i < list.GetCount(); ++i)
+        EXPECT_EQ(list[i], i);
+}
+
+TEST_F(InlineList_Fixture, Add_NonTrivialItems)
+{
+    InlineList<List<int>, 2> list;
+    list.Add(List<int>{ 1 });
+    list.Add(List<int>{ 2, 2 });
+    list.Add(List<int>{ 3, 3, 3 });
+
+    EXPECT_TRUE(list.IsSpilled());
+    for (UInt64 i = 0; i < list.GetCount(); ++i)
+        EXPECT_EQ(list[i].GetCount(), i + 1);
+
+    list.ClearDestructive();
+
+    EXPECT_TRUE(list.IsEmpty());
+    EXPECT_FALSE(list.IsSpilled());
+}
+
+TEST_F(InlineList_Fixture, TryAddRange)
+{
+    InlineList<int, 4> list = { 1, 2 };
+
+    EXPECT_FALSE(list.TryAddRange({ }));
+    EXPECT_TRUE(list.TryAddRange({ 3, 4, 5 }));
+
+    EXPECT_EQ(list.GetCount(), 5);
+    EXPECT_TRUE(list.IsSpilled());
+
+    for (UInt64 i = 0; i < list.GetCount(); ++i)
+        EXPECT_EQ(list[i], i + 1);
+}
+
+TEST_F(InlineList_Fixture, TryRemove)
+{
+    InlineList<int, 4> list = { 1, 2, 3, 4 };
+
+    EXPECT_TRUE(list.TryRemove(2));
+    EXPECT_FALSE(list.TryRemove(2));
+    EXPECT_FALSE(list.TryRemoveAt(3));
+    EXPECT_TRUE(list.TryRemoveAt(0));
+
+    EXPECT_EQ(list.GetCount(), 2);
+    EXPECT_TRUE(list.Contains(3));
+    EXPECT_TRUE(list.Contains(4));
+
+    UInt64 index;
+    EXPECT_TRUE(list.TryGetIndexOf(3, &index));
+    EXPECT_EQ(list[index], 3);
+    EXPECT_FALSE(list.TryGetIndexOf(1, &index));
+}
+
+TEST_F(InlineList_Fixture, EnsureCapacity)
+{
+    InlineList<int, 4> list = { 1, 2, 3 };
+
+    list.EnsureCapacity(2);
+    EXPECT_FALSE(list.IsSpilled());
+
+    list.EnsureCapacity(10);
+    EXPECT_TRUE(list.IsSpilled());
+    EXPECT_EQ(list.GetCapacity(), 10);
+    EXPECT_EQ(list.GetCount(), 3);
+    EXPECT_EQ(list[2], 3);
+}
+
+TEST_F(InlineList_Fixture, Iterator)
+{
+    InlineList<int, 4> list = { 1, 2, 3, 4, 5 };
+
+    int i = 1;
+    for (const auto& item: list)
+        EXPECT_EQ(item, i++);
+
+    i = 5;
+    for (auto it = list.rbegin(); it != list.rend(); --it)
+        EXPECT_EQ(*it, i--);
+}
@@ -132,6 +132,48 @@ TEST_F(List_Fixture, Add)
         EXPECT_EQ(list[i], i + 1);
 }
 
+TEST_F(List_Fixture, Add_NonTrivialItems)
+{
+    List<List<int>> list;
+    for (int i = 0; i < 10; i++)
+        list.Add(List<int>{ i, i });
+
+    while (list.GetCount() < list.GetCapacity())
+        list.Add(List<int>{ 0, 0 });
+
+    // Growing moves the inner lists into the new buffer, their own buffers stay where they are
+    const int* data = list[0].GetData();
+    const auto allocationCount =
+        Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount;
+
+    list.Add(List<int>());
+
+    EXPECT_EQ(list[0].GetData(), data);
+    EXPECT_EQ(Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount,
+              allocationCount + 1);
+
+    for (UInt64 i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(list[i].GetCount(), 2);
+        EXPECT_EQ(list[i][1], i);
+    }
+}
+
+TEST_F(List_Fixture, Expand_NonTrivialItems_Empty)
+{
+    List<List<int>> list;
+    list.Reserve(4);
+
+    // There are no items to move, so growing only swaps the buffers
+    list.Expand();
+
+    EXPECT_EQ(list.GetCount(), 0);
+    EXPECT_GT(list.GetCapacity(), 4);
+
+    list.Add(List<int>{ 1, 2 });
+    EXPECT_EQ(list[0][1], 2);
+}
+
 TEST_F(List_Fixture, TryAddAt)
 {
     List<int> list;
@@ -233,11 +275,11 @@ TEST_F(List_Fixture, GetMemoryFootprint)
 
     EXPECT_EQ(footprint2[0].GetData().GetName(), OTR_NAME_OF(List<int>));
     EXPECT_EQ(footprint2[0].GetData().GetPointer(), list.GetData());
-    EXPECT_NE(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
-                    << "Pointer should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
+                    << "Pointer should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Size, OTR_ALLOCATED_MEMORY(int, list.GetCapacity()));
-    EXPECT_NE(footprint2[0].Offset, footprint1[0].Offset)
-                    << "Offset should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].Offset, footprint1[0].Offset)
+                    << "Offset should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Padding, 0);
     EXPECT_EQ(footprint2[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "Core/Collections/MpmcQueue.h"
+#include "Core/Collections/List.h"
+
+template<typename T, UInt64 Capacity>
+using MpmcQueue = Otter::MpmcQueue<T, Capacity>;
+
+template<typename T>
+using List = Otter::List<T>;
+
+class MpmcQueue_Fixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Otter::MemorySystem::Initialise(1_KiB);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(Otter::MemorySystem::GetUsedMemory(), 0);
+        Otter::MemorySystem::Shutdown();
+    }
+};
+
+TEST_F(MpmcQueue_Fixture, Initialisation_Default)
+{
+    MpmcQueue<int, 4> queue;
+
+    EXPECT_EQ(queue.GetCapacity(), 4);
+    EXPECT_EQ(queue.GetCount(), 0);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(MpmcQueue_Fixture, TryEnqueue_TryDequeue)
+{
+    MpmcQueue<int, 4> queue;
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(queue.TryEnqueue(i));
+
+    EXPECT_FALSE(queue.TryEnqueue(4));
+    EXPECT_EQ(queue.GetCount(), 4);
+
+    int value;
+    EXPECT_TRUE(queue.TryDequeue(&value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.TryDequeue());
+
+    // The next items wrap around the end of the buffer
+    EXPECT_TRUE(queue.TryEnqueue(4));
+    EXPECT_TRUE(queue.TryEnqueue(5));
+
+    for (int i = 2; i < 6; i++)
+    {
+        EXPECT_TRUE(queue.TryDequeue(&value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.TryDequeue(&value));
+    EXPECT_FALSE(queue.TryDequeue());
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(MpmcQueue_Fixture, TryEnqueue_NonTrivialItems)
+{
+    MpmcQueue<List<int>, 2> queue;
+
+    EXPECT_TRUE(queue.TryEnqueue(List<int>{ 1, 2, 3 }));
+
+    List<int> list;
+    EXPECT_TRUE(queue.TryDequeue(&list));
+    EXPECT_EQ(list.GetCount(), 3);
+    EXPECT_EQ(list[2], 3);
+}
+
+TEST_F(MpmcQueue_Fixture, Stress_ManyProducersManyConsumers)
+{
+    constexpr UInt64 producerCount        = 4;
+    constexpr UInt64 consumerCount        = 2;
+    constexpr UInt64 itemCountPerProducer = 1'000'000;
+
+    static MpmcQueue<UInt64, 1024> queue;
+
+    // Each item holds its producer in the high bits and its index in the low bits
+    std::vector<std::thread> producers;
+    for (UInt64 producer = 0; producer < producerCount; producer++)
+        producers.emplace_back([producer]()
+                               {
+                                   for (UInt64 i = 0; i < itemCountPerProducer; i++)
+                                       while (!queue.TryEnqueue(producer << 32 | i))
+                                           std::this_thread::yield();
+                               });
+
+    // Every item must arrive exactly once, and the items of a producer must arrive in order at every consumer
+    std::atomic<UInt64> received{ 0 };
+    std::atomic<UInt64> errors{ 0 };
+    UInt64 sums[consumerCount] = { };
+
+    std::vector<std::thread> consumers;
+    for (UInt64 consumer = 0; consumer < consumerCount; consumer++)
+        consumers.emplace_back([&, consumer]()
+                               {
+                                   Int64 lastIndices[producerCount];
+                                   for (Int64& lastIndex: lastIndices)
+                                       lastIndex = -1;
+
+                                   UInt64 value;
+                                   while (received.load(std::memory_order_relaxed)
+                                          < producerCount * itemCountPerProducer)
+                                   {
+                                       if (!queue.TryDequeue(&value))
+                                       {
+                                           std::this_thread::yield();
+                                           continue;
+                                       }
+
+                                       const UInt64 producer = value >> 32;
+                                       const Int64  index    = (Int64) (value & 0xFFFFFFFF);
+
+                                       if (producer >= producerCount || index <= lastIndices[producer])
+                                           errors++;
+                                       else
+                                           lastIndices[producer] = index;
+
+                                       sums[consumer] += index;
+                                       received++;
+                                   }
+                               });
+
+    for (auto& producer: producers)
+        producer.join();
+    for (auto& consumer: consumers)
+        consumer.join();
+
+    UInt64 sum = 0;
+    for (const UInt64 consumerSum: sums)
+        sum += consumerSum;
+
+    EXPECT_EQ(errors, 0);
+    EXPECT_EQ(received, producerCount * itemCountPerProducer);
+    EXPECT_EQ(sum, producerCount * itemCountPerProducer * (itemCountPerProducer - 1) / 2);
+    EXPECT_TRUE(queue.IsEmpty());
+}
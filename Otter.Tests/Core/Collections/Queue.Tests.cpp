@@ -221,6 +221,32 @@ TEST_F(Queue_Fixture, Expand)
     EXPECT_EQ(value, 3);
 }
 
+TEST_F(Queue_Fixture, Expand_NonTrivialItems)
+{
+    Queue<Queue<int>> queue = { { 1 }, { 2, 2 }, { 3, 3, 3 } };
+
+    queue.TryDequeue();
+    queue.TryEnqueue({ 4, 4, 4, 4 }); // m_EndIndex < m_StartIndex
+
+    const auto allocationCount =
+        Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount;
+
+    queue.Expand(5);
+
+    // Only the outer buffer is allocated, the inner queues are moved rather than copied
+    EXPECT_EQ(Otter::MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Collections).TotalAllocationCount,
+              allocationCount + 1);
+    EXPECT_EQ(queue.GetCapacity(), 8);
+    EXPECT_EQ(queue.GetCount(), 3);
+
+    for (UInt64 i = 2; i <= 4; i++)
+    {
+        Queue<int> item;
+        EXPECT_TRUE(queue.TryDequeue(&item));
+        EXPECT_EQ(item.GetCount(), i);
+    }
+}
+
 TEST_F(Queue_Fixture, Shrink)
 {
     Queue<int> emptyQueue;
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "Core/Collections/SpscQueue.h"
+#include "Core/Collections/List.h"
+
+template<typename T, UInt64 Capacity>
+using SpscQueue = Otter::SpscQueue<T, Capacity>;
+
+template<typename T>
+using List = Otter::List<T>;
+
+class SpscQueue_Fixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Otter::MemorySystem::Initialise(1_KiB);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(Otter::MemorySystem::GetUsedMemory(), 0);
+        Otter::MemorySystem::Shutdown();
+    }
+};
+
+TEST_F(SpscQueue_Fixture, Initialisation_Default)
+{
+    SpscQueue<int, 4> queue;
+
+    EXPECT_EQ(queue.GetCapacity(), 4);
+    EXPECT_EQ(queue.GetCount(), 0);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(SpscQueue_Fixture, TryEnqueue_TryDequeue)
+{
+    SpscQueue<int, 4> queue;
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(queue.TryEnqueue(i));
+
+    EXPECT_FALSE(queue.TryEnqueue(4));
+    EXPECT_EQ(queue.GetCount(), 4);
+
+    int value;
+    EXPECT_TRUE(queue.TryDequeue(&value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.TryDequeue());
+
+    // The next items wrap around the end of the buffer
+    EXPECT_TRUE(queue.TryEnqueue(4));
+    EXPECT_TRUE(queue.TryEnqueue(5));
+
+    for (int i = 2; i < 6; i++)
+    {
+        EXPECT_TRUE(queue.TryDequeue(&value));
+        EXPECT_EQ(value, i);
+    }
+
+    EXPECT_FALSE(queue.TryDequeue(&value));
+    EXPECT_FALSE(queue.TryDequeue());
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST_F(SpscQueue_Fixture, TryEnqueue_NonTrivialItems)
+{
+    SpscQueue<List<int>, 2> queue;
+
+    EXPECT_TRUE(queue.TryEnqueue(List<int>{ 1, 2, 3 }));
+
+    List<int> list;
+    EXPECT_TRUE(queue.TryDequeue(&list));
+    EXPECT_EQ(list.GetCount(), 3);
+    EXPECT_EQ(list[2], 3);
+}
+
+TEST_F(SpscQueue_Fixture, TryEnqueueRange_TryDequeueRange)
+{
+    SpscQueue<int, 8> queue;
+
+    const int items[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    EXPECT_EQ(queue.TryEnqueueRange(items, 5), 5);
+    EXPECT_EQ(queue.TryEnqueueRange(items + 5, 5), 3);
+    EXPECT_EQ(queue.TryEnqueueRange(items, 1), 0);
+
+    int outItems[8];
+    EXPECT_EQ(queue.TryDequeueRange(outItems, 6), 6);
+    for (int i = 0; i < 6; i++)
+        EXPECT_EQ(outItems[i], i);
+
+    EXPECT_EQ(queue.TryEnqueueRange(items + 8, 2), 2);
+    EXPECT_EQ(queue.TryDequeueRange(outItems, 8), 4);
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(outItems[i], i + 6);
+
+    EXPECT_EQ(queue.TryDequeueRange(outItems, 8), 0);
+}
+
+TEST_F(SpscQueue_Fixture, Stress_TwoThreads)
+{
+    constexpr UInt64 itemCount = 100'000'000;
+
+    static SpscQueue<UInt64, 4096> queue;
+
+    std::thread producer([]()
+                         {
+                             for (UInt64 i = 0; i < itemCount; i++)
+                                 while (!queue.TryEnqueue(i))
+                                     std::this_thread::yield();
+                         });
+
+    // Every item must arrive exactly once and in order
+    UInt64 expected = 0;
+    UInt64 errors   = 0;
+    UInt64 value;
+    while (expected < itemCount)
+    {
+        if (!queue.TryDequeue(&value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        errors += value != expected;
+        expected++;
+    }
+
+    producer.join();
+
+    EXPECT_EQ(errors, 0);
+    EXPECT_TRUE(queue.IsEmpty());
+}
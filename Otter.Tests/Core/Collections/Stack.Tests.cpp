@@ -167,11 +167,11 @@ TEST_F(Stack_Fixture, GetMemoryFootprint)
 
     EXPECT_EQ(footprint2[0].GetData().GetName(), OTR_NAME_OF(Stack<int>));
     EXPECT_EQ(footprint2[0].GetData().GetPointer(), stack.GetData());
-    EXPECT_NE(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
-                    << "Pointer should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
+                    << "Pointer should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Size, OTR_ALLOCATED_MEMORY(int, stack.GetCapacity()));
-    EXPECT_NE(footprint2[0].Offset, footprint1[0].Offset)
-                    << "Offset should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].Offset, footprint1[0].Offset)
+                    << "Offset should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Padding, 0);
     EXPECT_EQ(footprint2[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
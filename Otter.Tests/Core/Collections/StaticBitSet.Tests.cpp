@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include "Core/Collections/StaticBitSet.h"
+#include "Core/Collections/HashSet.h"
+
+template<UInt64 BitCount>
+using StaticBitSet = Otter::StaticBitSet<BitCount>;
+
+class StaticBitSet_Fixture : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Otter::MemorySystem::Initialise(1_KiB);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(Otter::MemorySystem::GetUsedMemory(), 0);
+        Otter::MemorySystem::Shutdown();
+    }
+};
+
+TEST_F(StaticBitSet_Fixture, Initialisation_Default)
+{
+    static_assert(std::is_trivially_copyable_v<StaticBitSet<256>>);
+    static_assert(sizeof(StaticBitSet<256>) == 32);
+    static_assert(sizeof(StaticBitSet<65>) == 16);
+
+    StaticBitSet<256> bitset;
+
+    EXPECT_EQ(bitset.GetBitsSize(), 256);
+    EXPECT_EQ(bitset.GetTrueCount(), 0);
+    EXPECT_EQ(Otter::MemorySystem::GetUsedMemory(), 0);
+}
+
+TEST_F(StaticBitSet_Fixture, Get_Set)
+{
+    StaticBitSet<200> bitset;
+    bitset.Set(0, true);
+    bitset.Set(64, true);
+    bitset.Set(199, true);
+
+    EXPECT_TRUE(bitset.Get(0));
+    EXPECT_FALSE(bitset.Get(1));
+    EXPECT_TRUE(bitset.Get(64));
+    EXPECT_TRUE(bitset.Get(199));
+    EXPECT_EQ(bitset.GetTrueCount(), 3);
+
+    bitset.Set(64, false);
+
+    EXPECT_FALSE(bitset.Get(64));
+    EXPECT_EQ(bitset.GetTrueCount(), 2);
+
+    bitset.Clear();
+
+    EXPECT_EQ(bitset.GetTrueCount(), 0);
+}
+
+TEST_F(StaticBitSet_Fixture, Equality)
+{
+    StaticBitSet<320> bitset1;
+    bitset1.Set(5, true);
+    bitset1.Set(300, true);
+
+    StaticBitSet<320> bitset2 = bitset1;
+
+    EXPECT_TRUE(bitset1 == bitset2);
+    EXPECT_FALSE(bitset1 != bitset2);
+
+    // A difference in the last word, which is not part of a whole vector
+    bitset2.Set(300, false);
+
+    EXPECT_FALSE(bitset1 == bitset2);
+
+    bitset2.Set(300, true);
+    bitset2.Set(70, true);
+
+    EXPECT_TRUE(bitset1 != bitset2);
+}
+
+TEST_F(StaticBitSet_Fixture, Includes_Intersects)
+{
+    StaticBitSet<256> bitset1;
+    bitset1.Set(1, true);
+    bitset1.Set(130, true);
+    bitset1.Set(255, true);
+
+    StaticBitSet<256> bitset2;
+    bitset2.Set(130, true);
+    bitset2.Set(255, true);
+
+    StaticBitSet<256> bitset3;
+    bitset3.Set(2, true);
+
+    EXPECT_TRUE(bitset1.Includes(bitset2));
+    EXPECT_FALSE(bitset2.Includes(bitset1));
+    EXPECT_FALSE(bitset1.Includes(bitset3));
+    EXPECT_TRUE(bitset1.Includes(StaticBitSet<256>()));
+
+    EXPECT_TRUE(bitset1.Intersects(bitset2));
+    EXPECT_FALSE(bitset1.Intersects(bitset3));
+}
+
+TEST_F(StaticBitSet_Fixture, ForEachSetBit)
+{
+    StaticBitSet<256> bitset;
+    for (const UInt64 index: { 3, 64, 200 })
+        bitset.Set(index, true);
+
+    UInt64 sum   = 0;
+    UInt64 count = 0;
+    bitset.ForEachSetBit([&](const UInt64 index)
+                         {
+                             sum += index;
+                             count++;
+                         });
+
+    EXPECT_EQ(count, 3);
+    EXPECT_EQ(sum, 3 + 64 + 200);
+}
+
+TEST_F(StaticBitSet_Fixture, GetHashCode)
+{
+    StaticBitSet<256> bitset1;
+    bitset1.Set(10, true);
+
+    StaticBitSet<256> bitset2;
+    bitset2.Set(74, true);
+
+    // The same bit in different words must not hash the same
+    EXPECT_NE(bitset1.GetHashCode(), bitset2.GetHashCode());
+    EXPECT_NE(bitset1.GetHashCode(), StaticBitSet<256>().GetHashCode());
+
+    Otter::HashSet<StaticBitSet<256>> set;
+    EXPECT_TRUE(set.TryAdd(bitset1));
+    EXPECT_TRUE(set.TryAdd(bitset2));
+    EXPECT_FALSE(set.TryAdd(bitset1));
+    EXPECT_TRUE(set.Contains(bitset2));
+}
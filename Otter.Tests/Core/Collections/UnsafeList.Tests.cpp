@@ -424,13 +424,13 @@ TEST_F(UnsafeList_Fixture, GetMemoryFootprint)
 
     EXPECT_EQ(footprint2[0].GetData().GetName(), OTR_NAME_OF(UnsafeList));
     EXPECT_EQ(footprint2[0].GetData().GetPointer(), list.GetData());
-    EXPECT_NE(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
-                    << "Pointer should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].GetData().GetPointer(), footprint1[0].GetData().GetPointer())
+                    << "Pointer should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Size,
               OTR_ALIGNED_OFFSET(sizeof(int) * list.GetCapacity(), OTR_PLATFORM_MEMORY_ALIGNMENT) +
               Otter::FreeListAllocator::GetAllocatorHeaderSize());
-    EXPECT_NE(footprint2[0].Offset, footprint1[0].Offset)
-                    << "Offset should have changed because of capacity increase (reallocation)";
+    EXPECT_EQ(footprint2[0].Offset, footprint1[0].Offset)
+                    << "Offset should not have changed because the block grew in place";
     EXPECT_EQ(footprint2[0].Padding, 0);
     EXPECT_EQ(footprint2[0].Alignment, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
@@ -1,3 +1,29 @@
 #include <gtest/gtest.h>
 
 #include "Core/Collections/Utils/HashUtils.h"
+
+using HashUtils = Otter::Internal::HashUtils;
+
+TEST(HashUtils, GetNextPrime_Table)
+{
+    EXPECT_EQ(HashUtils::GetNextPrime(0), 3);
+    EXPECT_EQ(HashUtils::GetNextPrime(3), 3);
+    EXPECT_EQ(HashUtils::GetNextPrime(4), 7);
+    EXPECT_EQ(HashUtils::GetNextPrime(130000), 130363);
+}
+
+TEST(HashUtils, GetNextPrime_PastTable)
+{
+    EXPECT_EQ(HashUtils::GetNextPrime(130364), 130367);
+    EXPECT_EQ(HashUtils::GetNextPrime(1000000), 1000003);
+    EXPECT_EQ(HashUtils::GetNextPrime(10000000), 10000019);
+    EXPECT_EQ(HashUtils::GetNextPrime(1000000007), 1000000007);
+}
+
+TEST(HashUtils, GetPreviousPrime)
+{
+    EXPECT_EQ(HashUtils::GetPreviousPrime(10), 7);
+    EXPECT_EQ(HashUtils::GetPreviousPrime(130363), 130363);
+    EXPECT_EQ(HashUtils::GetPreviousPrime(1000000), 999983);
+    EXPECT_EQ(HashUtils::GetPreviousPrime(10000019), 10000019);
+}
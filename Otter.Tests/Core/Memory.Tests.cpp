@@ -1,6 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include "Core/Memory.h"
+#include "Core/Allocators/MemoryTrace.h"
+#include "Core/Allocators/ThreadCache.h"
+#include "Platform/FileSystem.h"
+
+#if OTR_PLATFORM_LINUX
+#include <sys/mman.h>
+#endif
 
 using MemorySystem = Otter::MemorySystem;
 
@@ -19,6 +29,115 @@ TEST(Memory, Initialisation)
     EXPECT_DEATH(MemorySystem::Shutdown(), "");
 }
 
+TEST(Memory, Initialisation_LargeArena)
+{
+    MemorySystem::Initialise(8_MiB);
+
+    EXPECT_EQ(MemorySystem::GetFreeMemory(), 8_MiB);
+    EXPECT_EQ(MemorySystem::GetMemorySize(), 8_MiB);
+
+    auto handle = MemorySystem::Allocate(4_MiB);
+    EXPECT_NE(handle.Pointer, nullptr);
+
+    auto* bytes = (Byte*) handle.Pointer;
+    bytes[0]         = 1;
+    bytes[4_MiB - 1] = 1;
+    EXPECT_EQ(bytes[0] + bytes[4_MiB - 1], 2);
+
+    MemorySystem::Free(handle.Pointer);
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, Platform_HugePageAlignment)
+{
+#if OTR_PLATFORM_LINUX
+    const UInt64 hugePageSize = 2_MiB;
+
+    auto* block = (Byte*) Otter::Platform::Allocate(1_KiB);
+    ASSERT_NE(block, nullptr);
+    block[0] = 1;
+
+    // Growing past a huge page moves the block to a huge page boundary
+    block = (Byte*) Otter::Platform::Reallocate(block, 4_MiB);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ((UIntPtr) block % hugePageSize, 0);
+    EXPECT_EQ(block[0], 1);
+    block[4_MiB - 1] = 2;
+
+    // A mapping right after the block stops it from growing in place, so it has to move and be aligned again
+    void* blocker = mmap(block + 4_MiB, 4_KiB, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    EXPECT_EQ(blocker, block + 4_MiB);
+
+    block = (Byte*) Otter::Platform::Reallocate(block, 64_MiB);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ((UIntPtr) block % hugePageSize, 0);
+    EXPECT_EQ(block[0], 1);
+    EXPECT_EQ(block[4_MiB - 1], 2);
+
+    block = (Byte*) Otter::Platform::Reallocate(block, 3_MiB);
+    ASSERT_NE(block, nullptr);
+    EXPECT_EQ((UIntPtr) block % hugePageSize, 0);
+    EXPECT_EQ(block[0], 1);
+
+    Otter::Platform::Free(block);
+    munmap(blocker, 4_KiB);
+#endif
+}
+
+TEST(Memory, Growth)
+{
+    for (const auto policy: { Otter::FreeListAllocator::Policy::FirstFit,
+                              Otter::FreeListAllocator::Policy::SegregatedFit })
+    {
+        MemorySystem::Initialise(1_KiB, policy);
+
+        auto handle1 = MemorySystem::Allocate(24_KiB);
+        auto handle2 = MemorySystem::Allocate(24_KiB);
+        EXPECT_NE(handle1.Pointer, nullptr);
+        EXPECT_NE(handle2.Pointer, nullptr);
+        EXPECT_EQ(MemorySystem::GetRegionCount(), 3);
+        EXPECT_GT(MemorySystem::GetMemorySize(), 48_KiB + 1_KiB);
+
+        auto* bytes = (Byte*) handle2.Pointer;
+        bytes[0]          = 1;
+        bytes[24_KiB - 1] = 1;
+        EXPECT_EQ(bytes[0] + bytes[24_KiB - 1], 2);
+
+        // One empty region is kept as a spare, the next one is returned to the OS
+        MemorySystem::Free(handle1.Pointer);
+        EXPECT_EQ(MemorySystem::GetRegionCount(), 3);
+
+        MemorySystem::Free(handle2.Pointer);
+        EXPECT_EQ(MemorySystem::GetRegionCount(), 2);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+        MemorySystem::Shutdown();
+
+        EXPECT_EQ(MemorySystem::GetRegionCount(), 0);
+    }
+}
+
+TEST(Memory, Growth_MemoryLimit)
+{
+    MemorySystem::Initialise(1_KiB, Otter::FreeListAllocator::Policy::FirstFit, 0, 0, 64_KiB);
+
+    auto handle = MemorySystem::Allocate(24_KiB);
+    EXPECT_NE(handle.Pointer, nullptr);
+    EXPECT_EQ(MemorySystem::GetRegionCount(), 2);
+
+    auto handleOverLimit = MemorySystem::Allocate(24_KiB);
+    EXPECT_EQ(handleOverLimit.Pointer, nullptr);
+    EXPECT_EQ(MemorySystem::GetRegionCount(), 2);
+    EXPECT_LE(MemorySystem::GetMemorySize(), 64_KiB);
+
+    MemorySystem::Free(handle.Pointer);
+
+    MemorySystem::Shutdown();
+}
+
 TEST(Memory, Allocation)
 {
     auto handleUninitialised = MemorySystem::Allocate(512);
@@ -78,6 +197,58 @@ TEST(Memory, Reallocation)
     MemorySystem::Shutdown();
 }
 
+TEST(Memory, Reallocation_InPlace)
+{
+    MemorySystem::Initialise(2_KiB);
+
+    auto handle = MemorySystem::Allocate(128);
+    void* pointer = handle.Pointer;
+
+    auto handleGrown = MemorySystem::Reallocate(handle, 512);
+    EXPECT_EQ(handleGrown.Pointer, pointer);
+    EXPECT_EQ(handleGrown.Size, 512);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 512 + Otter::FreeListAllocator::GetAllocatorHeaderSize());
+
+    auto blocker = MemorySystem::Allocate(64);
+
+    auto handleMoved = MemorySystem::Reallocate(handleGrown, 640);
+    EXPECT_NE(handleMoved.Pointer, pointer);
+
+    MemorySystem::Free(blocker.Pointer);
+    MemorySystem::Free(handleMoved.Pointer);
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, Reallocation_Zeroed)
+{
+    MemorySystem::Initialise(1_KiB);
+
+    auto handle = MemorySystem::Allocate(4 * sizeof(UInt32));
+    for (UInt32 i = 0; i < 4; ++i)
+        ((UInt32*) handle.Pointer)[i] = i + 1;
+
+    auto handleReallocated = MemorySystem::Reallocate(handle,
+                                                      8 * sizeof(UInt32),
+                                                      OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                      Otter::AllocationFlags::Zeroed);
+
+    EXPECT_EQ(handle.Pointer, nullptr);
+    EXPECT_EQ(handleReallocated.Size, 8 * sizeof(UInt32));
+
+    for (UInt32 i = 0; i < 4; ++i)
+        EXPECT_EQ(((UInt32*) handleReallocated.Pointer)[i], i + 1);
+
+    for (UInt32 i = 4; i < 8; ++i)
+        EXPECT_EQ(((UInt32*) handleReallocated.Pointer)[i], 0);
+
+    MemorySystem::Free(handleReallocated.Pointer);
+
+    MemorySystem::Shutdown();
+}
+
 TEST(Memory, MemoryCopy)
 {
     int source[5] = { 1, 2, 3, 4, 5 };
@@ -133,7 +304,6 @@ TEST(Memory, New_Delete)
 
     Otter::Delete<int>(num);
 
-    EXPECT_EQ(*num, 0);
     EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
 
     MemorySystem::Shutdown();
@@ -143,7 +313,7 @@ TEST(Memory, Buffer_New_Delete)
 {
     MemorySystem::Initialise(1_KiB);
 
-    int* num = Otter::Buffer::New<int>(5);
+    int* num = Otter::Buffer::New<int>(5, Otter::AllocationFlags::Zeroed);
 
     EXPECT_EQ(MemorySystem::GetUsedMemory(),
               5 * OTR_ALIGNED_OFFSET(sizeof(int), OTR_PLATFORM_MEMORY_ALIGNMENT)
@@ -156,7 +326,105 @@ TEST(Memory, Buffer_New_Delete)
 
     Otter::Buffer::Delete<int>(num, 5);
 
-    EXPECT_EQ(*num, 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, Buffer_NewAligned)
+{
+    MemorySystem::Initialise(16_KiB);
+
+    struct Position
+    {
+        Float32 X, Y, Z;
+    };
+
+    constexpr UInt64 length = 100;
+
+    auto* positions = Otter::Buffer::NewAligned<Position>(length, 64, Otter::MemoryTag::ECS);
+    EXPECT_NE(positions, nullptr);
+    EXPECT_EQ((UIntPtr) positions % 64, 0);
+    EXPECT_EQ((UIntPtr) &positions[1] - (UIntPtr) &positions[0], sizeof(Position));
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::ECS).LiveBytes,
+              OTR_ALIGNED_OFFSET(length * sizeof(Position), OTR_PLATFORM_MEMORY_ALIGNMENT));
+
+    for (UInt64 i = 0; i < length; i++)
+        positions[i] = { (Float32) i, 0.0f, 0.0f };
+
+    // A blocker right after the buffer forces it to be moved, which must keep it aligned
+    auto* blocker = Otter::Buffer::NewAligned<Position>(1, 32);
+    EXPECT_EQ((UIntPtr) blocker % 32, 0);
+
+    positions = Otter::Buffer::ReallocateAligned<Position>(positions, length, 4 * length, 64,
+                                                           Otter::AllocationFlags::Uninitialised,
+                                                           Otter::MemoryTag::ECS);
+    EXPECT_NE(positions, nullptr);
+    EXPECT_EQ((UIntPtr) positions % 64, 0);
+    EXPECT_EQ(positions[length - 1].X, (Float32) (length - 1));
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::ECS).LiveBytes,
+              OTR_ALIGNED_OFFSET(4 * length * sizeof(Position), OTR_PLATFORM_MEMORY_ALIGNMENT));
+
+    Otter::Buffer::DeleteAligned<Position>(blocker, 1);
+    Otter::Buffer::DeleteAligned<Position>(positions, 4 * length, Otter::MemoryTag::ECS);
+
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::ECS).LiveBytes, 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+struct Counted
+{
+    static inline int s_Copies = 0;
+    static inline int s_Moves  = 0;
+    static inline int s_Alive  = 0;
+
+    int Value = -1;
+
+    Counted() { s_Alive++; }
+    Counted(const Counted& other) : Value(other.Value) { s_Alive++; s_Copies++; }
+    Counted(Counted&& other) noexcept : Value(other.Value) { s_Alive++; s_Moves++; }
+    ~Counted() { s_Alive--; }
+
+    Counted& operator=(const Counted& other) = default;
+    Counted& operator=(Counted&& other) noexcept = default;
+};
+
+TEST(Memory, Buffer_Relocate)
+{
+    MemorySystem::Initialise(1_KiB);
+
+    static_assert(Otter::IsTriviallyRelocatable<UInt64>::value);
+    static_assert(!Otter::IsTriviallyRelocatable<Counted>::value);
+
+    // A ring buffer of 4 that starts at index 2, so that its items wrap around the end
+    auto* items = Otter::Buffer::New<Counted>(4, Otter::MemoryTag::User);
+    for (int i = 0; i < 4; i++)
+        items[(2 + i) % 4].Value = i;
+
+    items = Otter::Buffer::Relocate<Counted>(items, 4, 6, 4, 2, Otter::MemoryTag::User);
+
+    EXPECT_EQ(Counted::s_Copies, 0);
+    EXPECT_EQ(Counted::s_Moves, 4);
+    EXPECT_EQ(Counted::s_Alive, 6);
+
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(items[i].Value, i);
+
+    EXPECT_EQ(items[4].Value, -1);
+    EXPECT_EQ(items[5].Value, -1);
+
+    // Shrinking drops the items past the new length
+    items = Otter::Buffer::Relocate<Counted>(items, 6, 2, 4, 0, Otter::MemoryTag::User);
+
+    EXPECT_EQ(Counted::s_Alive, 2);
+    EXPECT_EQ(items[1].Value, 1);
+
+    Otter::Buffer::Delete<Counted>(items, 2, Otter::MemoryTag::User);
+
+    EXPECT_EQ(Counted::s_Alive, 0);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 0);
     EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
 
     MemorySystem::Shutdown();
@@ -178,4 +446,488 @@ TEST(Memory, Unsafe_New_Delete)
     EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
 
     MemorySystem::Shutdown();
-}
\ No newline at end of file
+}
+
+TEST(Memory, Relocatable_Defragment)
+{
+    for (const auto policy: { Otter::FreeListAllocator::Policy::FirstFit,
+                              Otter::FreeListAllocator::Policy::SegregatedFit })
+    {
+        MemorySystem::Initialise(4_KiB, policy);
+
+        Otter::RelocatableHandle handles[4];
+        for (auto& handle: handles)
+        {
+            handle = MemorySystem::AllocateRelocatable(512, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                       Otter::AllocationFlags::Zeroed, Otter::MemoryTag::User);
+            EXPECT_TRUE(handle.IsValid());
+            EXPECT_EQ(MemorySystem::GetRelocatableSize(handle), 512);
+        }
+
+        for (UInt64 i = 0; i < 512; i++)
+        {
+            ((Byte*) handles[2].Get())[i] = (Byte) i;
+            ((Byte*) handles[3].Get())[i] = (Byte) (i * 3);
+        }
+
+        auto stale = handles[0];
+        MemorySystem::FreeRelocatable(handles[0]);
+        MemorySystem::FreeRelocatable(handles[1]);
+        EXPECT_FALSE(handles[0].IsValid());
+        EXPECT_DEATH((void) stale.Get(), "");
+
+        // The remaining blocks slide down into the hole, and keep their contents and their handles
+        void* pointer2 = handles[2].Get();
+        void* pointer3 = handles[3].Get();
+        const UInt64 usedMemory = MemorySystem::GetUsedMemory();
+
+        EXPECT_EQ(MemorySystem::Defragment(1'000'000), 1024);
+        EXPECT_LT(handles[2].Get(), pointer2);
+        EXPECT_LT(handles[3].Get(), pointer3);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), usedMemory);
+        EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 1024);
+
+        for (UInt64 i = 0; i < 512; i++)
+        {
+            EXPECT_EQ(((Byte*) handles[2].Get())[i], (Byte) i);
+            EXPECT_EQ(((Byte*) handles[3].Get())[i], (Byte) (i * 3));
+        }
+
+        // Nothing is left to move, and the free memory at the end of the region is in one piece
+        EXPECT_EQ(MemorySystem::Defragment(1'000'000), 0);
+
+        auto large = MemorySystem::Allocate(2_KiB);
+        EXPECT_NE(large.Pointer, nullptr);
+        EXPECT_EQ(MemorySystem::GetRegionCount(), 1);
+
+        EXPECT_TRUE(MemorySystem::ReallocateRelocatable(handles[2], 768));
+        EXPECT_EQ(MemorySystem::GetRelocatableSize(handles[2]), 768);
+        EXPECT_EQ(((Byte*) handles[2].Get())[511], (Byte) 511);
+
+        MemorySystem::Free(large.Pointer);
+        MemorySystem::FreeRelocatable(handles[2]);
+        MemorySystem::FreeRelocatable(handles[3]);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+        EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 0);
+
+        MemorySystem::Shutdown();
+    }
+}
+
+TEST(Memory, Relocatable_Defragment_Incremental)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    Otter::RelocatableHandle handles[4];
+    for (auto& handle: handles)
+        handle = MemorySystem::AllocateRelocatable(512);
+
+    MemorySystem::FreeRelocatable(handles[0]);
+    MemorySystem::FreeRelocatable(handles[1]);
+
+    // Without a budget, every pass visits a single entry and the next one picks up where it stopped
+    UInt64 movedBytes = 0;
+    for (UInt64 i = 0; i < 4; i++)
+    {
+        const UInt64 passBytes = MemorySystem::Defragment(0);
+        EXPECT_LE(passBytes, 512);
+
+        movedBytes += passBytes;
+    }
+
+    EXPECT_EQ(movedBytes, 1024);
+    EXPECT_EQ(MemorySystem::Defragment(1'000'000), 0);
+
+    MemorySystem::FreeRelocatable(handles[2]);
+    MemorySystem::FreeRelocatable(handles[3]);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, ThreadCache_AllocateFree)
+{
+    MemorySystem::Initialise(1_MiB);
+
+    MemorySystem::EnableThreadCache();
+
+    auto handle1 = MemorySystem::Allocate(24);
+    auto handle2 = MemorySystem::Allocate(200);
+    EXPECT_NE(handle1.Pointer, nullptr);
+    EXPECT_NE(handle2.Pointer, nullptr);
+    EXPECT_GT(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Free(handle1.Pointer);
+    MemorySystem::Free(handle2.Pointer);
+
+    auto handle3 = MemorySystem::Allocate(24);
+    EXPECT_EQ(handle3.Pointer, handle1.Pointer);
+    MemorySystem::Free(handle3.Pointer);
+
+    std::vector<void*> allocations;
+    for (UInt64 i = 0; i < 100; i++)
+        allocations.push_back(MemorySystem::Allocate(64).Pointer);
+
+    const UInt64 usedMemory = MemorySystem::GetUsedMemory();
+
+    std::thread thread([&allocations]()
+                       {
+                           for (void* pointer: allocations)
+                               MemorySystem::Free(pointer);
+                       });
+    thread.join();
+
+    for (UInt64 i = 0; i < 100; i++)
+        allocations[i] = MemorySystem::Allocate(64).Pointer;
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), usedMemory);
+
+    for (void* pointer: allocations)
+        MemorySystem::Free(pointer);
+
+    MemorySystem::DisableThreadCache();
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, ThreadCache_MemoryFootprint)
+{
+    MemorySystem::Initialise(1_MiB);
+
+    MemorySystem::EnableThreadCache();
+
+    auto handle = MemorySystem::Allocate(24);
+
+    Otter::MemoryFootprint footprint = { };
+    MemorySystem::CheckMemoryFootprint([&]()
+                                       {
+                                           Otter::MemoryDebugPair pair[1];
+                                           pair[0] = { "Block", handle.Pointer };
+
+                                           return Otter::MemoryDebugHandle{ pair, 1 };
+                                       },
+                                       &footprint,
+                                       nullptr);
+
+    EXPECT_EQ(footprint.Size, 32) << "The block is served from the 32 byte size class";
+    EXPECT_EQ(footprint.Offset, (UIntPtr) handle.Pointer % Otter::ThreadCache::k_SpanSize);
+    EXPECT_EQ(footprint.Padding, 0);
+    EXPECT_EQ(footprint.Alignment, Otter::ThreadCache::k_BlockAlignment);
+
+    MemorySystem::Free(handle.Pointer);
+    MemorySystem::DisableThreadCache();
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, ThreadCache_RemoteFree)
+{
+    MemorySystem::Initialise(4_MiB);
+
+    constexpr UInt64 threadCount     = 4;
+    constexpr UInt64 allocationCount = 2000;
+
+    std::vector<void*> allocations[threadCount];
+    std::vector<std::thread> threads;
+
+    for (UInt64 i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&allocations, i]()
+                             {
+                                 MemorySystem::EnableThreadCache();
+
+                                 for (UInt64 j = 0; j < allocationCount; j++)
+                                 {
+                                     auto handle = MemorySystem::Allocate(8 + (j % 32) * 8);
+                                     *(UInt64*) handle.Pointer = i;
+
+                                     if (j % 2 == 0)
+                                         MemorySystem::Free(handle.Pointer);
+                                     else
+                                         allocations[i].push_back(handle.Pointer);
+                                 }
+
+                                 MemorySystem::DisableThreadCache();
+                             });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+    threads.clear();
+
+    // The blocks are freed on a different thread than the one that allocated them
+    for (UInt64 i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&allocations, i]()
+                             {
+                                 MemorySystem::EnableThreadCache();
+
+                                 for (void* pointer: allocations[(i + 1) % threadCount])
+                                 {
+                                     EXPECT_EQ(*(UInt64*) pointer, (i + 1) % threadCount);
+                                     MemorySystem::Free(pointer);
+                                 }
+
+                                 MemorySystem::DisableThreadCache();
+                             });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, FrameMemoryScope)
+{
+    MemorySystem::Initialise(1_KiB, Otter::FreeListAllocator::Policy::FirstFit, 1_KiB);
+
+    void* pointer = nullptr;
+    {
+        Otter::FrameMemoryScope frameMemory;
+
+        auto handle = MemorySystem::Allocate(64);
+        EXPECT_NE(handle.Pointer, nullptr);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+        EXPECT_EQ(MemorySystem::GetUsedFrameMemory(), 64);
+
+        MemorySystem::Free(handle.Pointer);
+        EXPECT_EQ(MemorySystem::GetUsedFrameMemory(), 64);
+
+        pointer = handle.Pointer;
+    }
+
+    auto handle = MemorySystem::Allocate(64);
+    EXPECT_NE(handle.Pointer, pointer);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 64 + Otter::FreeListAllocator::GetAllocatorHeaderSize());
+    MemorySystem::Free(handle.Pointer);
+
+    MemorySystem::BeginFrame();
+    EXPECT_EQ(MemorySystem::GetUsedFrameMemory(), 64);
+
+    MemorySystem::BeginFrame();
+    EXPECT_EQ(MemorySystem::GetUsedFrameMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, FrameMemoryScope_Reallocate)
+{
+    MemorySystem::Initialise(1_KiB, Otter::FreeListAllocator::Policy::FirstFit, 1_KiB);
+
+    auto handle  = MemorySystem::Allocate(64);
+    auto blocker = MemorySystem::Allocate(64);
+    {
+        Otter::FrameMemoryScope frameMemory;
+
+        // The blocker stops the block from growing in place, so it has to move, but not into frame memory
+        auto newHandle = MemorySystem::Reallocate(handle, 256);
+        EXPECT_NE(newHandle.Pointer, nullptr);
+        EXPECT_EQ(MemorySystem::GetUsedFrameMemory(), 0);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), 64 + 256 + 2 * Otter::FreeListAllocator::GetAllocatorHeaderSize());
+
+        handle = newHandle;
+    }
+
+    MemorySystem::Free(handle.Pointer);
+    MemorySystem::Free(blocker.Pointer);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, MemoryTag_Stats)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    constexpr UInt64 stride = OTR_ALIGNED_OFFSET(sizeof(UInt64), OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+    auto* numbers = Otter::Buffer::New<UInt64>(8, Otter::MemoryTag::User);
+    auto handle = Otter::Unsafe::New(256, Otter::MemoryTag::User);
+
+    auto stats = MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User);
+    EXPECT_EQ(stats.LiveBytes, 8 * stride + 256);
+    EXPECT_EQ(stats.PeakBytes, 8 * stride + 256);
+    EXPECT_EQ(stats.AllocationCount, 2);
+    EXPECT_EQ(stats.TotalAllocationCount, 2);
+
+    numbers = Otter::Buffer::Reallocate<UInt64>(numbers, 8, 16, Otter::MemoryTag::User);
+
+    stats = MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User);
+    EXPECT_EQ(stats.LiveBytes, 16 * stride + 256);
+    EXPECT_EQ(stats.AllocationCount, 2);
+
+    Otter::Buffer::Delete<UInt64>(numbers, 16, Otter::MemoryTag::User);
+    Otter::Unsafe::Delete(handle, Otter::MemoryTag::User);
+
+    stats = MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User);
+    EXPECT_EQ(stats.LiveBytes, 0);
+    EXPECT_EQ(stats.PeakBytes, 16 * stride + 256);
+    EXPECT_EQ(stats.AllocationCount, 0);
+    EXPECT_EQ(stats.TotalAllocationCount, 3);
+
+    // Untagged allocations are not accounted
+    auto untagged = MemorySystem::Allocate(64);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Untagged).LiveBytes, 0);
+    MemorySystem::Free(untagged.Pointer);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, MemoryTag_Budget)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    MemorySystem::SetMemoryBudget(Otter::MemoryTag::Events, 512, Otter::MemoryBudgetPolicy::Fail);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Events).Budget, 512);
+
+    auto handle = MemorySystem::Allocate(384, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                         Otter::AllocationFlags::Uninitialised, Otter::MemoryTag::Events);
+    EXPECT_NE(handle.Pointer, nullptr);
+
+    auto handleOverBudget = MemorySystem::Allocate(256, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                   Otter::AllocationFlags::Uninitialised, Otter::MemoryTag::Events);
+    EXPECT_EQ(handleOverBudget.Pointer, nullptr);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Events).LiveBytes, 384);
+
+    // A budget that only warns lets the allocation through
+    MemorySystem::SetMemoryBudget(Otter::MemoryTag::Events, 512, Otter::MemoryBudgetPolicy::Warn);
+
+    auto handleWarned = MemorySystem::Allocate(256, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                               Otter::AllocationFlags::Uninitialised, Otter::MemoryTag::Events);
+    EXPECT_NE(handleWarned.Pointer, nullptr);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Events).LiveBytes, 640);
+
+    MemorySystem::Free(handle.Pointer, handle.Size, Otter::MemoryTag::Events);
+    MemorySystem::Free(handleWarned.Pointer, handleWarned.Size, Otter::MemoryTag::Events);
+
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::Events).LiveBytes, 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, Tracing)
+{
+    const char* const filePath = "Memory.Tracing.otrtrace";
+
+    MemorySystem::Initialise(2_KiB);
+
+    EXPECT_TRUE(MemorySystem::StartTracing(filePath));
+    EXPECT_TRUE(MemorySystem::IsTracing());
+
+    auto handle = MemorySystem::Allocate(128, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                         Otter::AllocationFlags::Uninitialised, Otter::MemoryTag::Events);
+    void* pointer = handle.Pointer;
+
+    auto handleGrown = MemorySystem::Reallocate(handle, 256, OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                Otter::AllocationFlags::Uninitialised, Otter::MemoryTag::Events);
+    EXPECT_EQ(handleGrown.Pointer, pointer);
+
+    MemorySystem::Free(handleGrown.Pointer, handleGrown.Size, Otter::MemoryTag::Events);
+
+    MemorySystem::StopTracing();
+    EXPECT_FALSE(MemorySystem::IsTracing());
+
+    MemorySystem::Shutdown();
+
+    Otter::FileSystem::File file;
+    ASSERT_TRUE(Otter::FileSystem::TryOpenFile(filePath, Otter::FileSystem::OpenMode::Read, true, &file));
+
+    Otter::MemoryTraceHeader header{ };
+    Otter::MemoryTraceEvent  events[8]{ };
+    Size headerBytesRead = 0, eventBytesRead = 0;
+    EXPECT_TRUE(Otter::FileSystem::TryReadFile(&file, sizeof(header), &header, &headerBytesRead));
+    EXPECT_TRUE(Otter::FileSystem::TryReadFile(&file, sizeof(events), events, &eventBytesRead));
+    Otter::FileSystem::CloseFile(&file);
+    std::remove(filePath);
+
+    EXPECT_EQ(header.Magic, Otter::MemoryTraceHeader::k_Magic);
+    EXPECT_EQ(header.Version, Otter::MemoryTraceHeader::k_Version);
+    EXPECT_EQ(header.EventSize, sizeof(Otter::MemoryTraceEvent));
+    ASSERT_EQ(eventBytesRead, 4 * sizeof(Otter::MemoryTraceEvent));
+
+    EXPECT_EQ(events[0].Type, Otter::MemoryTraceEventType::AddRegion);
+    EXPECT_EQ(events[0].BlockSize, 2_KiB);
+
+    EXPECT_EQ(events[1].Type, Otter::MemoryTraceEventType::Allocate);
+    EXPECT_EQ(events[1].Size, 128);
+    EXPECT_EQ(events[1].Tag, (UInt8) Otter::MemoryTag::Events);
+    EXPECT_NE(events[1].CallSite, 0);
+
+    EXPECT_EQ(events[2].Type, Otter::MemoryTraceEventType::Reallocate);
+    EXPECT_EQ(events[2].Offset, events[1].Offset);
+    EXPECT_EQ(events[2].Size, 256);
+    EXPECT_EQ(events[2].PreviousSize, 128);
+    EXPECT_EQ(events[2].PreviousBlockSize, events[1].BlockSize);
+
+    EXPECT_EQ(events[3].Type, Otter::MemoryTraceEventType::Free);
+    EXPECT_EQ(events[3].Offset, events[1].Offset);
+    EXPECT_EQ(events[3].BlockSize, events[2].BlockSize);
+}
+
+TEST(Memory, Pool_New_Delete)
+{
+    MemorySystem::Initialise(64_KiB);
+
+    auto* num1 = Otter::Pool::New<UInt64>(5);
+    auto* num2 = Otter::Pool::New<UInt64>(10);
+    EXPECT_EQ(*num1, 5);
+    EXPECT_EQ(*num2, 10);
+    EXPECT_EQ((UIntPtr) num2 - (UIntPtr) num1, 16);
+
+    const UInt64 usedMemory = MemorySystem::GetUsedMemory();
+    EXPECT_GT(usedMemory, 0);
+
+    Otter::Delete<UInt64>(num1);
+    Otter::Delete<UInt64>(num2);
+
+    auto* num3 = Otter::Pool::New<UInt64>(15);
+    EXPECT_EQ(*num3, 15);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), usedMemory);
+    Otter::Delete<UInt64>(num3);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(Memory, StackMemoryScope)
+{
+    MemorySystem::Initialise(4_KiB, Otter::FreeListAllocator::Policy::FirstFit, 0, 1_KiB);
+
+    {
+        Otter::StackMemoryScope outer;
+
+        auto* numbers = outer.New<UInt64>(4);
+        EXPECT_NE(numbers, nullptr);
+        EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+        const UInt64 usedStackMemory = MemorySystem::GetUsedStackMemory();
+        EXPECT_EQ(usedStackMemory, 4 * sizeof(UInt64) + Otter::StackAllocator::GetAllocatorHeaderSize());
+
+        {
+            Otter::StackMemoryScope inner;
+
+            for (UInt64 i = 0; i < 8; i++)
+                EXPECT_NE(inner.Allocate(16), nullptr);
+
+            EXPECT_GT(MemorySystem::GetUsedStackMemory(), usedStackMemory);
+        }
+
+        EXPECT_EQ(MemorySystem::GetUsedStackMemory(), usedStackMemory);
+
+        // Falls back to the global allocator once the stack is exhausted
+        void* overflow = outer.Allocate(1_KiB);
+        EXPECT_NE(overflow, nullptr);
+        EXPECT_GT(MemorySystem::GetUsedMemory(), 0);
+    }
+
+    EXPECT_EQ(MemorySystem::GetUsedStackMemory(), 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "Core/SmartPointers.h"
+#include "Core/Allocators/FreeListAllocator.h"
+
+using MemorySystem = Otter::MemorySystem;
+
+namespace
+{
+    struct Base
+    {
+        explicit Base(int* destructions) : Destructions(destructions) { }
+        virtual ~Base() { ++*Destructions; }
+
+        int* Destructions;
+    };
+
+    struct Derived final : Base
+    {
+        explicit Derived(int* destructions) : Base(destructions) { }
+
+        UInt64 Payload[8]{ };
+    };
+}
+
+TEST(SmartPointers, UniquePtr_MakeUnique)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    int destructions = 0;
+    {
+        auto unique = Otter::MakeUnique<Derived, Otter::MemoryTag::User>(&destructions);
+        EXPECT_TRUE(unique);
+        EXPECT_EQ(unique->Destructions, &destructions);
+        EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, sizeof(Derived));
+
+        auto moved = std::move(unique);
+        EXPECT_FALSE(unique);
+        EXPECT_TRUE(moved);
+        EXPECT_EQ(destructions, 0);
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(SmartPointers, UniquePtr_Base)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    int destructions = 0;
+    {
+        // The base class pointer still frees the whole derived object
+        Otter::UniquePtr<Base> base = Otter::MakeUnique<Derived, Otter::MemoryTag::User>(&destructions);
+        EXPECT_TRUE(base);
+        EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, sizeof(Derived));
+
+        base.Reset();
+        EXPECT_FALSE(base);
+        EXPECT_EQ(destructions, 1);
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(SmartPointers, UniquePtr_New_Release)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    int destructions = 0;
+    Derived* derived;
+    {
+        Otter::UniquePtr<Derived> unique(Otter::New<Derived>(&destructions));
+        derived = unique.Release();
+        EXPECT_EQ(unique, nullptr);
+    }
+    EXPECT_EQ(destructions, 0);
+
+    {
+        Otter::UniquePtr<Base> base{ Otter::UniquePtr<Derived>(derived) };
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(SmartPointers, UniquePtr_AllocateUnique)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    auto handle = MemorySystem::Allocate(1_KiB);
+    Otter::FreeListAllocator allocator(handle.Pointer, handle.Size);
+
+    int destructions = 0;
+    {
+        auto unique = Otter::AllocateUnique<Derived>(allocator, &destructions);
+        EXPECT_TRUE(unique);
+        EXPECT_GT(allocator.GetMemoryUsed(), 0);
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    MemorySystem::Free(handle.Pointer);
+    MemorySystem::Shutdown();
+}
+
+TEST(SmartPointers, SharedPtr_MakeShared)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    int destructions = 0;
+    {
+        Otter::SharedPtr<Derived> shared = Otter::MakeShared<Derived, Otter::MemoryTag::User>(&destructions);
+        EXPECT_TRUE(shared);
+        EXPECT_EQ(shared.GetReferenceCount(), 1);
+
+        {
+            Otter::SharedPtr<Base> base = shared;
+            EXPECT_EQ(shared.GetReferenceCount(), 2);
+            EXPECT_EQ(base.Get(), shared.Get());
+
+            Otter::SharedPtr<Base> moved = std::move(base);
+            EXPECT_FALSE(base);
+            EXPECT_EQ(moved.GetReferenceCount(), 2);
+        }
+        EXPECT_EQ(shared.GetReferenceCount(), 1);
+        EXPECT_EQ(destructions, 0);
+
+        // The object and its reference count share a single allocation
+        EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).AllocationCount, 1);
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(MemorySystem::GetMemoryTagStats(Otter::MemoryTag::User).LiveBytes, 0);
+    EXPECT_EQ(MemorySystem::GetUsedMemory(), 0);
+
+    MemorySystem::Shutdown();
+}
+
+TEST(SmartPointers, SharedPtr_AllocateShared)
+{
+    MemorySystem::Initialise(4_KiB);
+
+    auto handle = MemorySystem::Allocate(1_KiB);
+    Otter::FreeListAllocator allocator(handle.Pointer, handle.Size);
+
+    int destructions = 0;
+    {
+        auto shared = Otter::AllocateShared<Derived>(allocator, &destructions);
+        auto copy   = shared;
+        EXPECT_EQ(copy.GetReferenceCount(), 2);
+
+        shared.Reset();
+        EXPECT_EQ(copy.GetReferenceCount(), 1);
+        EXPECT_EQ(destructions, 0);
+    }
+    EXPECT_EQ(destructions, 1);
+    EXPECT_EQ(allocator.GetMemoryUsed(), 0);
+
+    MemorySystem::Free(handle.Pointer);
+    MemorySystem::Shutdown();
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "Core/Collections/List.h"
 #include "ECS/ComponentData.h"
 
 using ComponentData = Otter::ComponentData;
@@ -274,4 +275,27 @@ TEST_F(ComponentData_Fixture, Iterator)
 
     EXPECT_EQ(loopCount, 2);
     EXPECT_FALSE(comp2Found);
-}
\ No newline at end of file
+}
+
+TEST_F(ComponentData_Fixture, List_Growth)
+{
+    static_assert(Otter::IsTriviallyRelocatable<ComponentData>::value);
+
+    auto t1 = TestComponent1(1, 2);
+
+    Otter::List<ComponentData> list;
+    list.Add(ComponentData());
+    list[0].Add(TestComponent1::Id, sizeof(TestComponent1), (Byte*) &t1);
+
+    while (list.GetCount() < list.GetCapacity())
+        list.Add(ComponentData());
+
+    // Growing copies the containers bytewise, so their buffers stay where they are
+    const Byte* data = list[0].GetComponentData();
+    list.Add(ComponentData());
+
+    EXPECT_EQ(list[0].GetComponentData(), data);
+    EXPECT_EQ(list[0].GetCount(), 1);
+    EXPECT_EQ(list[0].GetComponentIds()[0], TestComponent1::Id);
+    EXPECT_EQ(((TestComponent1*) list[0].GetComponentData())->B, 2);
+}
@@ -73,6 +73,29 @@ TEST_F(EntityManager_Fixture, RegisterComponents)
     EXPECT_EQ(manager.GetComponentCount(), 2);
 }
 
+template<Otter::ComponentId TId>
+struct IndexedTestComponent final : public Otter::IComponent
+{
+    static constexpr Otter::ComponentId Id = TId;
+
+    int Value;
+};
+
+template<UInt64... Indices>
+void RegisterIndexedComponents(EntityManager& manager, std::integer_sequence<UInt64, Indices...>)
+{
+    manager.RegisterComponents<IndexedTestComponent<Indices + 1>...>();
+}
+
+TEST_F(EntityManager_Fixture, RegisterComponents_OverLimit)
+{
+    EntityManager manager;
+    RegisterIndexedComponents(manager, std::make_integer_sequence<UInt64, OTR_ECS_MAX_COMPONENT_COUNT + 1>{ });
+    manager.LockComponents();
+
+    EXPECT_EQ(manager.GetComponentCount(), OTR_ECS_MAX_COMPONENT_COUNT);
+}
+
 TEST_F(EntityManager_Fixture, CreateArchetype_Success)
 {
     EntityManager manager;
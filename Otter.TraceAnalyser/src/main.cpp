@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "Core/Memory.h"
+#include "Core/Allocators/MemoryTrace.h"
+
+using namespace Otter;
+
+namespace
+{
+    /**
+     * @brief The replayed state of one region of the global allocator.
+     */
+    struct Region final
+    {
+        bool   IsLive    = false;
+        UInt64 Size      = 0;
+        UInt64 UsedBytes = 0;
+        UInt64 Waste     = 0;
+
+        /// @brief The used blocks of the region, by their offset, with their block size and requested size.
+        std::map<UInt64, std::pair<UInt64, UInt64>> Blocks;
+    };
+
+    /**
+     * @brief The state of the memory system at one point of the trace.
+     */
+    struct Sample final
+    {
+        UInt64 Timestamp        = 0;
+        UInt64 EventIndex       = 0;
+        UInt64 UsedBytes        = 0;
+        UInt64 FreeBytes        = 0;
+        UInt64 LargestFreeBlock = 0;
+        UInt64 Waste            = 0;
+
+        [[nodiscard]] double GetFragmentation() const
+        {
+            return FreeBytes == 0 ? 0.0 : 1.0 - (double) LargestFreeBlock / (double) FreeBytes;
+        }
+    };
+
+    /**
+     * @brief The statistics of the allocations of one call site.
+     */
+    struct CallSite final
+    {
+        UInt64 Address         = 0;
+        UInt8  Tag             = 0;
+        UInt64 AllocationCount = 0;
+        UInt64 AllocatedBytes  = 0;
+        UInt64 Waste           = 0;
+    };
+
+    const char* GetTagName(const UInt8 tag)
+    {
+        switch (static_cast<MemoryTag>(tag))
+        {
+            case MemoryTag::Untagged:
+                return "Untagged";
+#define REPLACE_WITH(Item, Value) case MemoryTag::Item: return #Item;
+            MEMORY_TAG_LIST
+#undef REPLACE_WITH
+            default:
+                return "Unknown";
+        }
+    }
+
+    Sample TakeSample(const std::vector<Region>& regions, const MemoryTraceEvent& event, const UInt64 eventIndex)
+    {
+        Sample sample{ };
+        sample.Timestamp  = event.Timestamp;
+        sample.EventIndex = eventIndex;
+
+        for (const Region& region: regions)
+        {
+            if (!region.IsLive)
+                continue;
+
+            sample.UsedBytes += region.UsedBytes;
+            sample.FreeBytes += region.Size - region.UsedBytes;
+            sample.Waste += region.Waste;
+
+            UInt64 previousEnd = 0;
+            for (const auto& [offset, block]: region.Blocks)
+            {
+                if (offset > previousEnd)
+                    sample.LargestFreeBlock = std::max(sample.LargestFreeBlock, offset - previousEnd);
+
+                previousEnd = offset + block.first;
+            }
+
+            if (region.Size > previousEnd)
+                sample.LargestFreeBlock = std::max(sample.LargestFreeBlock, region.Size - previousEnd);
+        }
+
+        return sample;
+    }
+
+    void PrintCallSites(std::vector<CallSite> callSites, const char* title, UInt64 CallSite::* key)
+    {
+        constexpr UInt64 k_CallSiteCount = 10;
+
+        std::sort(callSites.begin(), callSites.end(), [key](const CallSite& lhs, const CallSite& rhs)
+        {
+            return lhs.*key > rhs.*key;
+        });
+
+        std::printf("\nHottest call sites by %s:\n", title);
+        std::printf("  %-18s  %-12s  %12s  %14s  %12s\n", "Call site", "Tag", "Allocations", "Bytes", "Waste");
+
+        for (UInt64 i = 0; i < std::min(k_CallSiteCount, (UInt64) callSites.size()); i++)
+            std::printf("  0x%016llx  %-12s  %12llu  %14llu  %12llu\n",
+                        (unsigned long long) callSites[i].Address,
+                        GetTagName(callSites[i].Tag),
+                        (unsigned long long) callSites[i].AllocationCount,
+                        (unsigned long long) callSites[i].AllocatedBytes,
+                        (unsigned long long) callSites[i].Waste);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::printf("Usage: %s <trace file> [events per sample]\n", argv[0]);
+        return 1;
+    }
+
+    const UInt64 eventsPerSample = argc > 2 ? std::max(1ull, std::strtoull(argv[2], nullptr, 10)) : 1024;
+
+    FILE* file = std::fopen(argv[1], "rb");
+    if (!file)
+    {
+        std::printf("Failed to open trace file '%s'\n", argv[1]);
+        return 1;
+    }
+
+    MemoryTraceHeader header{ };
+    if (std::fread(&header, sizeof(header), 1, file) != 1
+        || header.Magic != MemoryTraceHeader::k_Magic
+        || header.Version != MemoryTraceHeader::k_Version
+        || header.EventSize != sizeof(MemoryTraceEvent))
+    {
+        std::printf("'%s' is not a memory trace, or was written by an incompatible version\n", argv[1]);
+        std::fclose(file);
+        return 1;
+    }
+
+    std::vector<Region>                  regions;
+    std::vector<Sample>                  samples;
+    std::unordered_map<UInt64, CallSite> callSites;
+
+    Sample peak{ };
+    Sample worst{ };
+    UInt64 eventIndex    = 0;
+    UInt64 unknownFrees  = 0;
+    UInt64 lastTimestamp = 0;
+
+    MemoryTraceEvent event{ };
+    while (std::fread(&event, sizeof(event), 1, file) == 1)
+    {
+        if (event.Region >= regions.size())
+            regions.resize(event.Region + 1);
+
+        Region& region = regions[event.Region];
+
+        switch (event.Type)
+        {
+            case MemoryTraceEventType::AddRegion:
+                region = Region{ };
+                region.IsLive = true;
+                region.Size   = event.BlockSize;
+                break;
+            case MemoryTraceEventType::RemoveRegion:
+                region = Region{ };
+                break;
+            case MemoryTraceEventType::Allocate:
+            {
+                region.Blocks[event.Offset] = { event.BlockSize, event.Size };
+                region.UsedBytes += event.BlockSize;
+                region.Waste += event.BlockSize - event.Size;
+
+                CallSite& callSite = callSites[event.CallSite];
+                callSite.Address = event.CallSite;
+                callSite.Tag     = event.Tag;
+                callSite.AllocationCount++;
+                callSite.AllocatedBytes += event.Size;
+                callSite.Waste += event.BlockSize - event.Size;
+            }
+                break;
+            case MemoryTraceEventType::Reallocate:
+            case MemoryTraceEventType::Free:
+            {
+                // Blocks that were allocated before tracing started are unknown to the trace
+                const auto iterator = region.Blocks.find(event.Offset);
+                if (iterator == region.Blocks.end())
+                {
+                    unknownFrees++;
+                    break;
+                }
+
+                region.UsedBytes -= iterator->second.first;
+                region.Waste -= iterator->second.first - iterator->second.second;
+
+                if (event.Type == MemoryTraceEventType::Free)
+                {
+                    region.Blocks.erase(iterator);
+                    break;
+                }
+
+                iterator->second = { event.BlockSize, event.Size };
+                region.UsedBytes += event.BlockSize;
+                region.Waste += event.BlockSize - event.Size;
+            }
+                break;
+            default:
+                std::printf("Unknown event type %u at event %llu\n",
+                            (unsigned) event.Type,
+                            (unsigned long long) eventIndex);
+                break;
+        }
+
+        eventIndex++;
+        lastTimestamp = event.Timestamp;
+
+        if (eventIndex % eventsPerSample == 0)
+        {
+            const Sample sample = TakeSample(regions, event, eventIndex);
+            samples.push_back(sample);
+
+            if (sample.UsedBytes > peak.UsedBytes)
+                peak = sample;
+            if (sample.GetFragmentation() > worst.GetFragmentation())
+                worst = sample;
+        }
+    }
+
+    std::fclose(file);
+
+    if (eventIndex == 0)
+    {
+        std::printf("The trace has no events\n");
+        return 0;
+    }
+
+    if (eventIndex % eventsPerSample != 0)
+        samples.push_back(TakeSample(regions, event, eventIndex));
+
+    std::printf("Fragmentation over time (every %llu events):\n", (unsigned long long) eventsPerSample);
+    std::printf("  %12s  %10s  %14s  %14s  %14s  %8s  %12s\n",
+                "Time (ms)", "Events", "Used", "Free", "Largest free", "Frag %", "Waste");
+
+    for (const Sample& sample: samples)
+        std::printf("  %12.3f  %10llu  %14llu  %14llu  %14llu  %8.2f  %12llu\n",
+                    (double) sample.Timestamp / 1.0e6,
+                    (unsigned long long) sample.EventIndex,
+                    (unsigned long long) sample.UsedBytes,
+                    (unsigned long long) sample.FreeBytes,
+                    (unsigned long long) sample.LargestFreeBlock,
+                    sample.GetFragmentation() * 100.0,
+                    (unsigned long long) sample.Waste);
+
+    const Sample& last = samples.back();
+
+    std::printf("\nSummary:\n");
+    std::printf("  Events:                    %llu over %.3f ms\n",
+                (unsigned long long) eventIndex,
+                (double) lastTimestamp / 1.0e6);
+    std::printf("  Peak used bytes:           %llu at %.3f ms\n",
+                (unsigned long long) peak.UsedBytes,
+                (double) peak.Timestamp / 1.0e6);
+    std::printf("  Worst fragmentation:       %.2f%% at %.3f ms\n",
+                worst.GetFragmentation() * 100.0,
+                (double) worst.Timestamp / 1.0e6);
+    std::printf("  Final largest free block:  %llu of %llu free bytes\n",
+                (unsigned long long) last.LargestFreeBlock,
+                (unsigned long long) last.FreeBytes);
+    std::printf("  Final waste:               %llu bytes of headers and padding\n",
+                (unsigned long long) last.Waste);
+
+    if (unknownFrees > 0)
+        std::printf("  Untracked blocks:          %llu freed or resized, allocated before tracing started\n",
+                    (unsigned long long) unknownFrees);
+
+    std::vector<CallSite> sortedCallSites;
+    sortedCallSites.reserve(callSites.size());
+    for (const auto& [address, callSite]: callSites)
+        sortedCallSites.push_back(callSite);
+
+    PrintCallSites(sortedCallSites, "allocation count", &CallSite::AllocationCount);
+    PrintCallSites(sortedCallSites, "allocated bytes", &CallSite::AllocatedBytes);
+
+    return 0;
+}
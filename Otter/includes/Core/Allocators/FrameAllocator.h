@@ -0,0 +1,101 @@
+#ifndef OTTERENGINE_FRAMEALLOCATOR_H
+#define OTTERENGINE_FRAMEALLOCATOR_H
+
+#include "Core/Allocators/AbstractAllocator.h"
+#include "Core/Allocators/LinearAllocator.h"
+
+namespace Otter
+{
+    /**
+     * @brief A double-buffered linear allocator used for per-frame scratch memory. The memory is split into two
+     * linear allocators, and every frame the allocator switches to the other one and clears it.
+     *
+     * @note Memory allocated during a frame stays valid until the end of the next frame, so that data produced in
+     * one frame can still be consumed in the next one.
+     */
+    class FrameAllocator final : public AbstractAllocator
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         */
+        FrameAllocator()
+            : AbstractAllocator(), m_Buffers{ }, m_CurrentBuffer(0)
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param memory The memory to use. Half of it is used by each buffer.
+         * @param memorySize The size of the memory.
+         */
+        explicit FrameAllocator(void* memory, const UInt64 memorySize)
+            : AbstractAllocator(memory, memorySize),
+              m_Buffers{ LinearAllocator(memory, memorySize / 2),
+                         LinearAllocator((void*) ((UIntPtr) memory + memorySize / 2), memorySize - memorySize / 2) },
+              m_CurrentBuffer(0)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~FrameAllocator() final { m_Memory = nullptr; }
+
+        /**
+         * @brief Allocates a memory block from the current frame's buffer
+         *
+         * @param size Size of the memory to allocate
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the buffer is out of memory
+         */
+        void* Allocate(UInt64 size, UInt16 alignment) final;
+
+        /**
+         * @brief Does nothing, since memory blocks are only released when their buffer is cleared.
+         *
+         * @param block Pointer to the memory block to free
+         */
+        void Free(void* block) final;
+
+        /**
+         * @brief Retrieves the memory footprint of a memory block in the allocator
+         *
+         * @param block Pointer to the memory block
+         * @param outSize The size of the memory block inside the allocator
+         * @param outOffset The offset of the memory block from the start of the allocator
+         * @param outPadding The padding of the memory block
+         * @param outAlignment The alignment of the memory block
+         */
+        void GetMemoryFootprint(const void* block,
+                                UInt64* outSize,
+                                UInt64* outOffset,
+                                UInt16* outPadding,
+                                UInt16* outAlignment) const final;
+
+        /**
+         * @brief Switches to the other buffer and clears it, releasing the memory allocated two frames ago.
+         */
+        void SwapBuffers();
+
+        /**
+         * @brief Checks whether a memory block belongs to the allocator's memory.
+         *
+         * @param block Pointer to the memory block
+         *
+         * @return True if the block is inside the allocator's memory, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool Contains(const void* block) const
+        {
+            return (UIntPtr) block - (UIntPtr) m_Memory < m_MemorySize;
+        }
+
+    private:
+        LinearAllocator m_Buffers[2];
+        UInt8           m_CurrentBuffer;
+    };
+}
+
+#endif //OTTERENGINE_FRAMEALLOCATOR_H
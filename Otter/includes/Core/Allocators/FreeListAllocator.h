@@ -10,11 +10,16 @@ namespace Otter
      * When allocating a memory block, the allocator will also allocate a header that holds information about
      * the memory block, and is also used when freeing the memory block. Any free blocks are stored in a linked list.
      *
-     * @note The allocator can be used to allocate memory blocks in either a first fit or best fit manner.
+     * @note The allocator can be used to allocate memory blocks in either a first fit, best fit or segregated fit
+     * manner.
      * @note When allocating a memory block, the allocator will iterate through the linked list and find the
      * appropriate block that fits the size and alignment. When freeing a memory block, the allocator will iterate
      * through the linked list and find the correct position to insert the free block. If the free block is adjacent
      * to another free block, the allocator will merge the two blocks together.
+     * @note With the segregated fit policy, free blocks are instead kept in a two-level table of size classes
+     * (power-of-two first level, linear second level) with a bitmap per level, and every block carries a boundary
+     * tag pointing to its physical predecessor. Finding, splitting and merging a block are all constant time,
+     * regardless of how many blocks are live.
      */
     class FreeListAllocator final : public AbstractAllocator
     {
@@ -29,14 +34,17 @@ namespace Otter
             /// @brief Allocates the first free block that fits the size and alignment.
             FirstFit = 0,
             /// @brief Allocates the smallest free block that fits the size and alignment.
-            BestFit  = 1
+            BestFit  = 1,
+            /// @brief Allocates a free block from the two-level segregated size classes (TLSF), in constant time.
+            SegregatedFit = 2
         };
 
         /**
          * @brief Default constructor.
          */
         FreeListAllocator()
-            : AbstractAllocator(), m_Head(nullptr), m_Policy(Policy::FirstFit)
+            : AbstractAllocator(), m_Head(nullptr), m_Policy(Policy::FirstFit), m_FirstLevelBitmap(0),
+              m_SecondLevelBitmaps{ }, m_SegregatedLists{ }
         {
         }
 
@@ -48,7 +56,8 @@ namespace Otter
          * @param policy The allocation policy.
          */
         explicit FreeListAllocator(void* memory, UInt64 memorySize, Policy policy = Policy::FirstFit)
-            : AbstractAllocator(memory, memorySize), m_Head(nullptr), m_Policy(policy)
+            : AbstractAllocator(memory, memorySize), m_Head(nullptr), m_Policy(policy), m_FirstLevelBitmap(0),
+              m_SecondLevelBitmaps{ }, m_SegregatedLists{ }
         {
             Clear();
         }
@@ -64,7 +73,7 @@ namespace Otter
          * @param size Size of the memory to allocate
          * @param alignment Alignment of the memory to allocate
          *
-         * @return Pointer to the allocated memory block
+         * @return Pointer to the allocated memory block, or nullptr if there is no free block large enough
          */
         void* Allocate(UInt64 size, UInt16 alignment) final;
 
@@ -75,6 +84,29 @@ namespace Otter
          */
         void Free(void* block) final;
 
+        /**
+         * @brief Tries to resize a memory block without moving it. Growing takes space from the free block that
+         * directly follows it in memory, and shrinking gives the tail of the block back to the allocator.
+         *
+         * @param block Pointer to the memory block to resize
+         * @param size The new size of the memory block
+         *
+         * @return True if the block was resized in place, false if it has to be moved to fit the new size.
+         */
+        bool TryResize(void* block, UInt64 size);
+
+        /**
+         * @brief Allocates a memory block from the lowest free block that fits the size and alignment and lies before
+         * a given address. Used to slide blocks towards the start of the memory when compacting it.
+         *
+         * @param limit The address that the allocated block must lie before, usually a block that is being moved.
+         * @param size Size of the memory to allocate
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block, or nullptr if no free block before the limit fits.
+         */
+        void* AllocateBelow(const void* limit, UInt64 size, UInt16 alignment);
+
         /**
          * @brief Retrieves the memory footprint of a memory block in the allocator
          *
@@ -90,6 +122,16 @@ namespace Otter
                                 UInt16* outPadding,
                                 UInt16* outAlignment) const final;
 
+        /**
+         * @brief Retrieves the range of the allocator's memory that a memory block occupies, including its header
+         * and padding
+         *
+         * @param block Pointer to the memory block
+         * @param outOffset The offset of the first byte of the range from the start of the allocator
+         * @param outSize The size of the range
+         */
+        void GetBlockBounds(const void* block, UInt64* outOffset, UInt64* outSize) const;
+
         /**
          * @brief Clears the allocator.
          */
@@ -114,7 +156,13 @@ namespace Otter
          *
          * @return The iterator starting point.
          */
-        [[nodiscard]] OTR_INLINE Iterator begin() const noexcept { return Iterator(m_Head); }
+        [[nodiscard]] OTR_INLINE Iterator begin() const noexcept
+        {
+            if (m_Policy != Policy::SegregatedFit)
+                return Iterator(m_Head);
+
+            return Iterator(this, FindSegregatedListHead(0));
+        }
 
         /**
          * @brief The iterator ending point for the free list allocator.
@@ -142,6 +190,20 @@ namespace Otter
             Node* Next;
         };
 
+        /**
+         * @brief A block of the segregated fit policy. The first two fields form the boundary tag that is kept in
+         * front of every block, the rest is only valid while the block is free and overlaps the block's data.
+         *
+         * @note The free bit is stored in the lowest bit of the previous physical block address, so that the free
+         * list link is a regular Node holding the size of the block.
+         */
+        struct Block
+        {
+            UIntPtr PreviousPhysical;
+            Node    Link;
+            Node* PreviousFree;
+        };
+
         /**
          * @brief The iterator for the free list allocator.
          */
@@ -154,7 +216,18 @@ namespace Otter
              * @param node The node to iterate from.
              */
             explicit Iterator(Node* node)
-                : m_Node(node)
+                : m_Allocator(nullptr), m_Node(node)
+            {
+            }
+
+            /**
+             * @brief Constructor for iterating over the segregated lists of an allocator.
+             *
+             * @param allocator The allocator whose segregated lists to iterate.
+             * @param node The node to iterate from.
+             */
+            Iterator(const FreeListAllocator* allocator, Node* node)
+                : m_Allocator(allocator), m_Node(node)
             {
             }
 
@@ -165,7 +238,11 @@ namespace Otter
              */
             OTR_INLINE Iterator& operator++()
             {
-                m_Node = m_Node->Next;
+                if (m_Node->Next || !m_Allocator)
+                    m_Node = m_Node->Next;
+                else
+                    m_Node = m_Allocator->FindSegregatedListHead(m_Allocator->GetSegregatedListIndex(m_Node) + 1);
+
                 return *this;
             }
 
@@ -203,12 +280,27 @@ namespace Otter
             OTR_INLINE bool operator!=(const Iterator& other) const { return !(*this == other); }
 
         private:
+            const FreeListAllocator* m_Allocator;
             Node* m_Node;
         };
 
+        static constexpr UInt64 k_SecondLevelCountLog2 = 4;
+        static constexpr UInt64 k_SecondLevelCount     = 1 << k_SecondLevelCountLog2;
+        static constexpr UInt64 k_FirstLevelShift      = k_SecondLevelCountLog2 + 3;
+        static constexpr UInt64 k_FirstLevelMax        = 40;
+        static constexpr UInt64 k_FirstLevelCount      = k_FirstLevelMax - k_FirstLevelShift + 1;
+        static constexpr UInt64 k_SmallBlockSize       = 1 << k_FirstLevelShift;
+        static constexpr UInt64 k_BlockHeaderSize      = sizeof(UIntPtr) + sizeof(UInt64);
+        static constexpr UInt64 k_MinBlockSize         = sizeof(Block);
+        static constexpr UIntPtr k_FreeBit             = 1;
+
         Node* m_Head;
         Policy m_Policy;
 
+        UInt64 m_FirstLevelBitmap;
+        UInt32 m_SecondLevelBitmaps[k_FirstLevelCount];
+        Node* m_SegregatedLists[k_FirstLevelCount][k_SecondLevelCount];
+
         /**
          * @brief Finds the first fit memory block.
          *
@@ -233,6 +325,18 @@ namespace Otter
          */
         Node* FindBestFit(Node** previous, UInt16* padding, UInt64 size, UInt16 alignment);
 
+        /**
+         * @brief Allocates a memory block from a free node, splitting off the space that it does not need.
+         *
+         * @param node The free node.
+         * @param previous The free node before it.
+         * @param headerPadding The padding before the memory block, including its header.
+         * @param size The size of the memory block.
+         *
+         * @return Pointer to the allocated memory block.
+         */
+        void* AllocateFromNode(Node* node, Node* previous, UInt16 headerPadding, UInt64 size);
+
         /**
          * @brief Inserts a memory block into the allocator.
          *
@@ -257,6 +361,196 @@ namespace Otter
          */
         void Merge(Node* toMerge, Node* previousNode);
 
+        /**
+         * @brief Allocates a memory block using the segregated fit policy.
+         *
+         * @param size Size of the memory to allocate
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block
+         */
+        void* AllocateSegregated(UInt64 size, UInt16 alignment);
+
+        /**
+         * @brief Allocates a memory block from a free block that has been removed from its size class, splitting off
+         * the space that it does not need.
+         *
+         * @param block The free block.
+         * @param blockSize The size of the memory block, including its header.
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block
+         */
+        void* AllocateFromSegregatedBlock(Block* block, UInt64 blockSize, UInt16 alignment);
+
+        /**
+         * @brief Frees a memory block allocated using the segregated fit policy.
+         *
+         * @param block Pointer to the memory block to free
+         */
+        void FreeSegregated(void* block);
+
+        /**
+         * @brief Tries to resize a memory block allocated using the segregated fit policy without moving it.
+         *
+         * @param block Pointer to the memory block to resize
+         * @param size The new size of the memory block
+         *
+         * @return True if the block was resized in place, false otherwise.
+         */
+        bool TryResizeSegregated(void* block, UInt64 size);
+
+        /**
+         * @brief Clears the allocator and turns the whole memory into a single segregated free block.
+         */
+        void ClearSegregated();
+
+        /**
+         * @brief Inserts a free block into the segregated list of its size class.
+         *
+         * @param block The block to insert.
+         */
+        void InsertSegregated(Block* block);
+
+        /**
+         * @brief Removes a free block from the segregated list of its size class.
+         *
+         * @param block The block to remove.
+         */
+        void RemoveSegregated(Block* block);
+
+        /**
+         * @brief Finds and removes a free block that is guaranteed to fit the given size.
+         *
+         * @param size The size of the block, including its header.
+         *
+         * @return The removed free block, or nullptr if there is none.
+         */
+        Block* FindSegregatedFit(UInt64 size);
+
+        /**
+         * @brief Splits a block into a block of the given size and a trailing free block, if the remainder is large
+         * enough to form a block.
+         *
+         * @param block The block to split.
+         * @param size The size of the block to keep.
+         */
+        void SplitSegregated(Block* block, UInt64 size);
+
+        /**
+         * @brief Retrieves the first non-empty segregated list, starting from a given list index.
+         *
+         * @param listIndex The flat index of the segregated list to start from.
+         *
+         * @return The head of the list, or nullptr if all remaining lists are empty.
+         */
+        [[nodiscard]] Node* FindSegregatedListHead(UInt64 listIndex) const;
+
+        /**
+         * @brief Retrieves the flat index of the segregated list a free node belongs to.
+         *
+         * @param node The free node.
+         *
+         * @return The flat index of the segregated list.
+         */
+        [[nodiscard]] static UInt64 GetSegregatedListIndex(const Node* node);
+
+        /**
+         * @brief Maps a block size to its first and second level indices.
+         *
+         * @param size The size of the block.
+         * @param outFirstLevel The first level index.
+         * @param outSecondLevel The second level index.
+         */
+        static void MapSegregatedSize(UInt64 size, UInt64* outFirstLevel, UInt64* outSecondLevel);
+
+        /**
+         * @brief Gets the size of the block that holds an allocation of a given size, including its header.
+         *
+         * @param size The size of the allocation.
+         *
+         * @return The size of the block.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetSegregatedBlockSize(const UInt64 size)
+        {
+            const UInt64 blockSize = OTR_ALIGNED_OFFSET(size, OTR_PLATFORM_MEMORY_ALIGNMENT) + k_BlockHeaderSize;
+
+            return blockSize < k_MinBlockSize ? k_MinBlockSize : blockSize;
+        }
+
+        /**
+         * @brief Retrieves the block that a free list node belongs to.
+         *
+         * @param node The free list node.
+         *
+         * @return The block of the node.
+         */
+        [[nodiscard]] OTR_INLINE static Block* GetBlock(const Node* node)
+        {
+            return (Block*) ((UIntPtr) node - sizeof(UIntPtr));
+        }
+
+        /**
+         * @brief Retrieves the block that follows a block in memory.
+         *
+         * @param block The block.
+         *
+         * @return The next physical block.
+         */
+        [[nodiscard]] OTR_INLINE static Block* GetNextPhysical(const Block* block)
+        {
+            return (Block*) ((UIntPtr) block + block->Link.Size);
+        }
+
+        /**
+         * @brief Retrieves the block that precedes a block in memory.
+         *
+         * @param block The block.
+         *
+         * @return The previous physical block, or nullptr if it is the first block.
+         */
+        [[nodiscard]] OTR_INLINE static Block* GetPreviousPhysical(const Block* block)
+        {
+            return (Block*) (block->PreviousPhysical & ~k_FreeBit);
+        }
+
+        /**
+         * @brief Sets the block that precedes a block in memory, keeping the block's free bit.
+         *
+         * @param block The block.
+         * @param previous The previous physical block.
+         */
+        OTR_INLINE static void SetPreviousPhysical(Block* block, const Block* previous)
+        {
+            block->PreviousPhysical = (UIntPtr) previous | (block->PreviousPhysical & k_FreeBit);
+        }
+
+        /**
+         * @brief Checks whether a block is free.
+         *
+         * @param block The block.
+         *
+         * @return True if the block is free, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE static bool IsFree(const Block* block)
+        {
+            return (block->PreviousPhysical & k_FreeBit) != 0;
+        }
+
+        /**
+         * @brief Marks a block as free or used.
+         *
+         * @param block The block.
+         * @param isFree Whether the block is free.
+         */
+        OTR_INLINE static void SetFree(Block* block, const bool isFree)
+        {
+            if (isFree)
+                block->PreviousPhysical |= k_FreeBit;
+            else
+                block->PreviousPhysical &= ~k_FreeBit;
+        }
+
         /**
          * @brief Retrieves the alignment padding of a memory block.
          *
@@ -280,6 +574,9 @@ OStream& operator<<(OStream& os, const Otter::FreeListAllocator::Policy& policy)
         case Otter::FreeListAllocator::Policy::BestFit:
             os << OTR_NAME_OF(FreeListAllocator::Policy::BestFit);
             break;
+        case Otter::FreeListAllocator::Policy::SegregatedFit:
+            os << OTR_NAME_OF(FreeListAllocator::Policy::SegregatedFit);
+            break;
         default:
             os << "Unknown FreeListAllocator::Policy";
     }
@@ -0,0 +1,96 @@
+#ifndef OTTERENGINE_LINEARALLOCATOR_H
+#define OTTERENGINE_LINEARALLOCATOR_H
+
+#include "Core/Allocators/AbstractAllocator.h"
+
+namespace Otter
+{
+    /**
+     * @brief A linear (bump) allocator used for allocating short-lived memory blocks of any size and alignment.
+     * Allocating a memory block only moves an offset forward, and no information is stored about the block.
+     *
+     * @note Individual memory blocks cannot be freed. All memory blocks are released at once by clearing
+     * the allocator.
+     */
+    class LinearAllocator final : public AbstractAllocator
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         */
+        LinearAllocator()
+            : AbstractAllocator()
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param memory The memory to use.
+         * @param memorySize The size of the memory.
+         */
+        explicit LinearAllocator(void* memory, const UInt64 memorySize)
+            : AbstractAllocator(memory, memorySize)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~LinearAllocator() final { m_Memory = nullptr; }
+
+        /**
+         * @brief Allocates a memory block
+         *
+         * @param size Size of the memory to allocate
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the allocator is out of memory
+         */
+        void* Allocate(UInt64 size, UInt16 alignment) final;
+
+        /**
+         * @brief Does nothing, since memory blocks are only released when the allocator is cleared.
+         *
+         * @param block Pointer to the memory block to free
+         */
+        void Free(void* block) final;
+
+        /**
+         * @brief Retrieves the memory footprint of a memory block in the allocator
+         *
+         * @param block Pointer to the memory block
+         * @param outSize The size of the memory block inside the allocator
+         * @param outOffset The offset of the memory block from the start of the allocator
+         * @param outPadding The padding of the memory block
+         * @param outAlignment The alignment of the memory block
+         *
+         * @note The allocator does not keep track of the size of each block, so the size is reported as the
+         * distance from the block to the end of the used memory.
+         */
+        void GetMemoryFootprint(const void* block,
+                                UInt64* outSize,
+                                UInt64* outOffset,
+                                UInt16* outPadding,
+                                UInt16* outAlignment) const final;
+
+        /**
+         * @brief Clears the allocator, releasing all memory blocks.
+         */
+        OTR_INLINE void Clear() { m_MemoryUsed = 0; }
+
+        /**
+         * @brief Checks whether a memory block belongs to the allocator's memory.
+         *
+         * @param block Pointer to the memory block
+         *
+         * @return True if the block is inside the allocator's memory, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool Contains(const void* block) const
+        {
+            return (UIntPtr) block - (UIntPtr) m_Memory < m_MemorySize;
+        }
+    };
+}
+
+#endif //OTTERENGINE_LINEARALLOCATOR_H
@@ -0,0 +1,75 @@
+#ifndef OTTERENGINE_MEMORYTRACE_H
+#define OTTERENGINE_MEMORYTRACE_H
+
+#include "Core/BaseTypes.h"
+
+namespace Otter
+{
+    /**
+     * @brief The type of an event of a memory trace. Its size is 1 byte.
+     */
+    enum class MemoryTraceEventType : UInt8
+    {
+        /// @brief A block was allocated from a region.
+        Allocate = 0x01,
+
+        /// @brief A block was freed back to its region.
+        Free = 0x02,
+
+        /// @brief A block was resized in place. Blocks that are moved are traced as an allocation and a free.
+        Reallocate = 0x03,
+
+        /// @brief A region was added to the memory system.
+        AddRegion = 0x04,
+
+        /// @brief A region was returned to the OS.
+        RemoveRegion = 0x05,
+    };
+
+    /**
+     * @brief The header at the start of a memory trace file. It is followed by a sequence of MemoryTraceEvent.
+     */
+    struct MemoryTraceHeader final
+    {
+        static constexpr UInt32 k_Magic   = 0x5452544F; // "OTRT"
+        static constexpr UInt16 k_Version = 1;
+
+        UInt32 Magic;
+        UInt16 Version;
+        UInt16 EventSize;
+    };
+
+    /**
+     * @brief An event of a memory trace. Describes a change to the blocks of one region of the global allocator.
+     */
+    struct MemoryTraceEvent final
+    {
+        /// @brief The time of the event in nanoseconds, since tracing started.
+        UInt64 Timestamp;
+        /// @brief The return address of the call into the memory system that caused the event, or 0 if unknown.
+        UInt64 CallSite;
+        /// @brief The offset of the first byte that the block occupies in its region, including its header.
+        UInt64 Offset;
+        /// @brief The number of bytes that the block occupies in its region. For region events, the region's size.
+        UInt64 BlockSize;
+        /// @brief The number of bytes that were requested for the block, or 0 if it is unknown, as for frees.
+        UInt64 Size;
+        /// @brief The number of bytes that the block occupied before it was resized. Only set for reallocations.
+        UInt64 PreviousBlockSize;
+        /// @brief The number of bytes that were requested for the block before it was resized. Only set for
+        /// reallocations.
+        UInt64 PreviousSize;
+        /// @brief The alignment that was requested for the block.
+        UInt16 Alignment;
+        /// @brief The type of the event.
+        MemoryTraceEventType Type;
+        /// @brief The index of the region of the block.
+        UInt8 Region;
+        /// @brief The memory tag that the block is accounted to.
+        UInt8 Tag;
+    };
+
+    static_assert(sizeof(MemoryTraceEvent) == 64, "Memory trace events must keep their file layout");
+}
+
+#endif //OTTERENGINE_MEMORYTRACE_H
@@ -0,0 +1,201 @@
+#ifndef OTTERENGINE_POOLALLOCATOR_H
+#define OTTERENGINE_POOLALLOCATOR_H
+
+#include "Core/Allocators/AbstractAllocator.h"
+
+namespace Otter
+{
+    /**
+     * @brief A pool allocator used for allocating and freeing memory blocks of a single, fixed size. The memory is
+     * divided into blocks up front, and free blocks are linked together through their own memory, so allocating and
+     * freeing a block is constant time and no header is stored per block.
+     *
+     * @note The memory size of the allocator is the total size of its blocks, across the fixed memory and all chunks.
+     * @note The allocator can optionally grow, by requesting chunks of memory from an upstream allocator whenever it
+     * runs out of free blocks. Chunks can also be added explicitly.
+     */
+    class PoolAllocator final : public AbstractAllocator
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         */
+        PoolAllocator()
+            : AbstractAllocator(), m_FixedMemorySize(0), m_BlockSize(0), m_BlockAlignment(0), m_ChunkSize(0),
+              m_Upstream(nullptr), m_FreeBlocks(nullptr), m_Chunks(nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructor for a pool over a fixed block of memory.
+         *
+         * @param memory The memory to use.
+         * @param memorySize The size of the memory.
+         * @param blockSize The size of each block.
+         * @param blockAlignment The alignment of each block.
+         */
+        explicit PoolAllocator(void* memory,
+                               UInt64 memorySize,
+                               UInt64 blockSize,
+                               UInt16 blockAlignment = OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+        /**
+         * @brief Constructor for a pool that grows by requesting chunks from an upstream allocator.
+         *
+         * @param blockSize The size of each block.
+         * @param blockAlignment The alignment of each block.
+         * @param chunkSize The size of each chunk requested from the upstream allocator.
+         * @param upstream The allocator to request chunks from.
+         */
+        explicit PoolAllocator(UInt64 blockSize, UInt16 blockAlignment, UInt64 chunkSize, AbstractAllocator* upstream);
+
+        /**
+         * @brief Destructor. Returns every chunk to the upstream allocator.
+         */
+        ~PoolAllocator() final;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        PoolAllocator(const PoolAllocator&) = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The pool to move.
+         */
+        PoolAllocator(PoolAllocator&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The pool to move.
+         *
+         * @return A reference to this pool.
+         */
+        PoolAllocator& operator=(PoolAllocator&& other) noexcept;
+
+        /**
+         * @brief Allocates a memory block
+         *
+         * @param size Size of the memory to allocate. Must not be greater than the block size.
+         * @param alignment Alignment of the memory to allocate. Must not be greater than the block alignment.
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the pool is out of blocks and cannot grow
+         */
+        void* Allocate(UInt64 size, UInt16 alignment) final;
+
+        /**
+         * @brief Frees a memory block
+         *
+         * @param block Pointer to the memory block to free
+         */
+        void Free(void* block) final;
+
+        /**
+         * @brief Retrieves the memory footprint of a memory block in the allocator
+         *
+         * @param block Pointer to the memory block
+         * @param outSize The size of the memory block inside the allocator
+         * @param outOffset The offset of the memory block from the start of its chunk
+         * @param outPadding The padding of the memory block
+         * @param outAlignment The alignment of the memory block
+         */
+        void GetMemoryFootprint(const void* block,
+                                UInt64* outSize,
+                                UInt64* outOffset,
+                                UInt16* outPadding,
+                                UInt16* outAlignment) const final;
+
+        /**
+         * @brief Divides a chunk of memory into blocks and adds them to the pool. The chunk is not owned by the pool.
+         *
+         * @param memory The memory of the chunk.
+         * @param memorySize The size of the chunk.
+         */
+        void AddChunk(void* memory, UInt64 memorySize);
+
+        /**
+         * @brief Clears the allocator. Chunks from the upstream allocator are returned, and the rest of the memory
+         * is divided into blocks again.
+         */
+        void Clear();
+
+        /**
+         * @brief Checks whether the pool has a free block, without growing.
+         *
+         * @return True if the pool has a free block, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool HasFreeBlocks() const { return m_FreeBlocks != nullptr; }
+
+        /**
+         * @brief Retrieves the size of each block.
+         *
+         * @return The size of each block.
+         */
+        [[nodiscard]] OTR_INLINE constexpr UInt64 GetBlockSize() const { return m_BlockSize; }
+
+        /**
+         * @brief Retrieves the alignment of each block.
+         *
+         * @return The alignment of each block.
+         */
+        [[nodiscard]] OTR_INLINE constexpr UInt16 GetBlockAlignment() const { return m_BlockAlignment; }
+
+    private:
+        /**
+         * @brief The header of a chunk of memory that has been added to the pool.
+         */
+        struct Chunk
+        {
+            Chunk* Next;
+            UInt64 Size;
+            bool IsOwned;
+        };
+
+        UInt64 m_FixedMemorySize;
+        UInt64 m_BlockSize;
+        UInt16 m_BlockAlignment;
+        UInt64 m_ChunkSize;
+        AbstractAllocator* m_Upstream;
+
+        void* m_FreeBlocks;
+        Chunk* m_Chunks;
+
+        /**
+         * @brief Requests a new chunk from the upstream allocator.
+         *
+         * @return True if a chunk was added, false otherwise.
+         */
+        bool Grow();
+
+        /**
+         * @brief Returns the chunks owned by the pool to the upstream allocator and forgets all other chunks.
+         */
+        void ReleaseChunks();
+
+        /**
+         * @brief Divides a region of memory into blocks and pushes them to the free blocks.
+         *
+         * @param memory The memory to divide.
+         * @param memorySize The size of the memory.
+         */
+        void Carve(void* memory, UInt64 memorySize);
+
+        /**
+         * @brief Retrieves the chunk that a block belongs to.
+         *
+         * @param block The block.
+         *
+         * @return The chunk of the block, or nullptr if it belongs to the fixed memory.
+         */
+        [[nodiscard]] const Chunk* FindChunk(const void* block) const;
+    };
+}
+
+#endif //OTTERENGINE_POOLALLOCATOR_H
@@ -0,0 +1,151 @@
+#ifndef OTTERENGINE_STACKALLOCATOR_H
+#define OTTERENGINE_STACKALLOCATOR_H
+
+#include "Core/Allocators/AbstractAllocator.h"
+
+namespace Otter
+{
+    /**
+     * @brief A stack allocator used for allocating nested, short-lived memory blocks of any size and alignment.
+     * Allocating a memory block moves an offset forward, and every block stores a small header that remembers
+     * where the offset was before it.
+     *
+     * @note Memory blocks must be freed in the reverse order of their allocation. Any number of memory blocks can be
+     * released at once, by taking a marker and later rolling the allocator back to it.
+     */
+    class StackAllocator final : public AbstractAllocator
+    {
+    public:
+        /**
+         * @brief A position in the stack, that the allocator can be rolled back to.
+         */
+        using Marker = UInt64;
+
+        /**
+         * @brief Default constructor.
+         */
+        StackAllocator()
+            : AbstractAllocator()
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param memory The memory to use.
+         * @param memorySize The size of the memory.
+         */
+        explicit StackAllocator(void* memory, const UInt64 memorySize)
+            : AbstractAllocator(memory, memorySize)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~StackAllocator() final { m_Memory = nullptr; }
+
+        /**
+         * @brief Allocates a memory block on top of the stack
+         *
+         * @param size Size of the memory to allocate
+         * @param alignment Alignment of the memory to allocate
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the allocator is out of memory
+         */
+        void* Allocate(UInt64 size, UInt16 alignment) final;
+
+        /**
+         * @brief Frees the memory block on top of the stack
+         *
+         * @param block Pointer to the memory block to free. Must be the last allocated block that is still alive.
+         */
+        void Free(void* block) final;
+
+        /**
+         * @brief Retrieves the memory footprint of a memory block in the allocator
+         *
+         * @param block Pointer to the memory block
+         * @param outSize The size of the memory block inside the allocator
+         * @param outOffset The offset of the memory block from the start of the allocator
+         * @param outPadding The padding of the memory block, including its header
+         * @param outAlignment The alignment of the memory block
+         */
+        void GetMemoryFootprint(const void* block,
+                                UInt64* outSize,
+                                UInt64* outOffset,
+                                UInt16* outPadding,
+                                UInt16* outAlignment) const final;
+
+        /**
+         * @brief Retrieves a marker to the current top of the stack.
+         *
+         * @return The marker.
+         */
+        [[nodiscard]] OTR_INLINE Marker GetMarker() const { return m_MemoryUsed; }
+
+        /**
+         * @brief Frees every memory block that was allocated after a marker was taken.
+         *
+         * @param marker The marker to roll back to.
+         */
+        void FreeToMarker(Marker marker);
+
+        /**
+         * @brief Clears the allocator.
+         */
+        OTR_INLINE void Clear() { m_MemoryUsed = 0; }
+
+        /**
+         * @brief Checks whether a memory block belongs to the allocator's memory.
+         *
+         * @param block Pointer to the memory block
+         *
+         * @return True if the block is inside the allocator's memory, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool Contains(const void* block) const
+        {
+            return (UIntPtr) block - (UIntPtr) m_Memory < m_MemorySize;
+        }
+
+        /**
+         * @brief Checks whether a memory block is on top of the stack, meaning that it can be freed.
+         *
+         * @param block Pointer to the memory block
+         *
+         * @return True if the block is the last allocated block that is still alive, false otherwise.
+         */
+        [[nodiscard]] bool IsTop(const void* block) const;
+
+        /**
+         * @brief Retrieves the size of the header stored in front of every memory block.
+         *
+         * @return The size of the header.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetAllocatorHeaderSize() { return sizeof(Header); }
+
+    private:
+        /**
+         * @brief The header stored in front of every memory block.
+         */
+        struct Header
+        {
+            UInt64 PreviousOffset;
+            UInt64 Size;
+        };
+
+        /**
+         * @brief Retrieves the header of a memory block.
+         *
+         * @param block Pointer to the memory block
+         *
+         * @return The header of the block.
+         */
+        [[nodiscard]] OTR_INLINE static Header* GetHeader(const void* block)
+        {
+            return (Header*) ((UIntPtr) block - sizeof(Header));
+        }
+    };
+}
+
+#endif //OTTERENGINE_STACKALLOCATOR_H
@@ -0,0 +1,196 @@
+#ifndef OTTERENGINE_THREADCACHE_H
+#define OTTERENGINE_THREADCACHE_H
+
+#include <atomic>
+
+#include "Core/Defines.h"
+#include "Core/BaseTypes.h"
+#include "Core/Assert.h"
+
+namespace Otter
+{
+    /**
+     * @brief A per-thread cache of small memory blocks, that sits in front of the memory system's global allocator.
+     * Blocks are grouped into a few size classes and are carved out of spans, which are requested from the global
+     * allocator in batches under the memory system's lock. Allocating and freeing a block on the owning thread
+     * does not take any lock.
+     *
+     * @note Blocks freed on a thread other than the owner are pushed to a lock-free remote-free queue of their span,
+     * which the owner drains the next time it runs out of blocks of that size class.
+     * @note When a cache is flushed, spans that still have live blocks are orphaned and are returned to the global
+     * allocator by the thread that frees their last block.
+     */
+    class ThreadCache final
+    {
+    public:
+        /// @brief The size of a span, which is also its alignment.
+        static constexpr UInt64 k_SpanSize = 16 * 1024;
+
+        /// @brief The largest block size that can be served by the cache.
+        static constexpr UInt64 k_MaxBlockSize = 256;
+
+        /// @brief The alignment of every block served by the cache.
+        static constexpr UInt64 k_BlockAlignment = 16;
+
+        /**
+         * @brief A span of memory that is divided into blocks of a single size class.
+         */
+        struct Span
+        {
+            ThreadCache* Owner;
+            Span* Next;
+            UInt64 BlockSize;
+            UInt64 LiveCount;
+            std::atomic<void*> RemoteFrees;
+        };
+
+        /**
+         * @brief Constructor.
+         */
+        ThreadCache()
+            : m_FreeBlocks{ }, m_Spans{ }
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~ThreadCache() = default;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        ThreadCache(const ThreadCache&) = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        ThreadCache& operator=(const ThreadCache&) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        ThreadCache(ThreadCache&&) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        ThreadCache& operator=(ThreadCache&&) = delete;
+
+        /**
+         * @brief Allocates a block from the cache. Must be called from the owning thread.
+         *
+         * @param size The size of the block. Must not be greater than k_MaxBlockSize.
+         *
+         * @return Pointer to the allocated block, or nullptr if no span could be acquired.
+         */
+        void* Allocate(UInt64 size);
+
+        /**
+         * @brief Frees a block that belongs to a span of this cache. Must be called from the owning thread.
+         *
+         * @param block The block to free.
+         */
+        void Free(void* block);
+
+        /**
+         * @brief Returns every span without live blocks to the global allocator and orphans the rest.
+         *
+         * @note The memory system's lock must be held by the caller.
+         */
+        void Flush();
+
+        /**
+         * @brief Checks whether this cache owns a span and can free its blocks without synchronisation.
+         *
+         * @param span The span to check.
+         *
+         * @return True if the span is owned by this cache, false otherwise.
+         */
+        [[nodiscard]] bool Owns(const Span* span) const;
+
+        /**
+         * @brief Pushes a block to the remote-free queue of its span.
+         *
+         * @param block The block to free.
+         *
+         * @return True if the block was queued, false if its span has been orphaned.
+         */
+        static bool TryFreeRemote(void* block);
+
+        /**
+         * @brief Frees a block of an orphaned span, returning the span to the global allocator when it is empty.
+         *
+         * @param block The block to free.
+         *
+         * @note The memory system's lock must be held by the caller.
+         */
+        static void FreeOrphaned(void* block);
+
+        /**
+         * @brief Retrieves the span that a block belongs to.
+         *
+         * @param block The block.
+         *
+         * @return The span of the block.
+         */
+        [[nodiscard]] OTR_INLINE static Span* GetSpan(const void* block)
+        {
+            return (Span*) ((UIntPtr) block & ~(UIntPtr) (k_SpanSize - 1));
+        }
+
+        /**
+         * @brief Retrieves the memory footprint of a block that belongs to a span. The size of the block is the size
+         * class of its span.
+         *
+         * @param block The block.
+         * @param outSize The size of the block.
+         * @param outOffset The offset of the block from the start of its span.
+         * @param outPadding The padding of the block.
+         * @param outAlignment The alignment of the block.
+         */
+        static void GetMemoryFootprint(const void* block,
+                                       UInt64* outSize,
+                                       UInt64* outOffset,
+                                       UInt16* outPadding,
+                                       UInt16* outAlignment);
+
+    private:
+        static constexpr UInt64 k_SizeClasses[]  = { 16, 32, 48, 64, 96, 128, 192, 256 };
+        static constexpr UInt64 k_SizeClassCount = sizeof(k_SizeClasses) / sizeof(k_SizeClasses[0]);
+        static constexpr UInt64 k_SpanHeaderSize = OTR_ALIGNED_OFFSET(sizeof(Span), 64);
+
+        void* m_FreeBlocks[k_SizeClassCount];
+        Span* m_Spans[k_SizeClassCount];
+
+        /**
+         * @brief Refills the free blocks of a size class, first from the remote-free queues of its spans and then
+         * from a new span.
+         *
+         * @param sizeClass The size class to refill.
+         *
+         * @return True if at least one block is available, false otherwise.
+         */
+        bool Refill(UInt64 sizeClass);
+
+        /**
+         * @brief Moves all blocks of a span's remote-free queue to the free blocks of a size class.
+         *
+         * @param span The span to drain.
+         * @param sizeClass The size class of the span.
+         * @param closedQueue The value to leave in the remote-free queue.
+         */
+        void DrainRemoteFrees(Span* span, UInt64 sizeClass, void* closedQueue);
+
+        /**
+         * @brief Retrieves the size class of a block size.
+         *
+         * @param size The size of the block.
+         *
+         * @return The index of the size class.
+         */
+        [[nodiscard]] static UInt64 GetSizeClass(UInt64 size);
+    };
+}
+
+#endif //OTTERENGINE_THREADCACHE_H
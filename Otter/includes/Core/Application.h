@@ -5,6 +5,7 @@
 #include "Core/BaseTypes.h"
 #include "Core/Collections/List.h"
 #include "Core/Layers.h"
+#include "Core/SmartPointers.h"
 #include "Core/Time.h"
 
 namespace Otter
@@ -19,6 +20,9 @@ namespace Otter
         UInt16 Width;
         UInt16 Height;
         UInt64 MemoryRequirements;
+        UInt64 FrameMemoryRequirements;
+        UInt64 StackMemoryRequirements;
+        UInt64 MemoryLimit;
     };
 
     /**
@@ -62,15 +66,17 @@ namespace Otter
         requires IsDerivedFrom<TLayer, Layer>
         void PushLayer(Args&& ... args)
         {
-            m_Layers.Add(New<TLayer>(std::forward<Args>(args)...));
+            // The deleter records the size of the derived layer, so that it is freed with the size it was allocated
+            m_Layers.Add(UniquePtr<Layer>(Pool::New<TLayer>(std::forward<Args>(args)...),
+                                          DefaultDeleter<Layer>(sizeof(TLayer), MemoryTag::Untagged)));
         }
 
     private:
         const ApplicationConfiguration k_Configuration;
 
-        Platform* m_Platform = nullptr;
-        Time    * m_Time     = nullptr;
-        List<Layer*> m_Layers{ };
+        Platform       * m_Platform = nullptr;
+        UniquePtr<Time> m_Time     = nullptr;
+        List<UniquePtr<Layer>> m_Layers{ };
 
         /**
          * @brief Runs the necessary actions before the main loop.
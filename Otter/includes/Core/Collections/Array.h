@@ -35,7 +35,7 @@ namespace Otter
         Array()
         {
             if constexpr (Size > 0)
-                m_Data = Buffer::New<T>(Size);
+                m_Data = Buffer::New<T>(Size, AllocationFlags::Zeroed, MemoryTag::Collections);
         }
 
         /**
@@ -44,7 +44,7 @@ namespace Otter
         ~Array()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, Size);
+                Buffer::Delete<T>(m_Data, Size, MemoryTag::Collections);
 
             m_Data = nullptr;
         }
@@ -75,7 +75,7 @@ namespace Otter
                 return;
             else
             {
-                m_Data = Buffer::New<T>(Size);
+                m_Data = Buffer::New<T>(Size, MemoryTag::Collections);
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, Size * sizeof(T));
             }
         }
@@ -112,9 +112,9 @@ namespace Otter
             else
             {
                 if (IsCreated())
-                    Buffer::Delete<T>(m_Data, Size);
+                    Buffer::Delete<T>(m_Data, Size, MemoryTag::Collections);
 
-                m_Data = Buffer::New<T>(Size);
+                m_Data = Buffer::New<T>(Size, MemoryTag::Collections);
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, Size * sizeof(T));
             }
 
@@ -138,7 +138,7 @@ namespace Otter
             else
             {
                 if (IsCreated())
-                    Buffer::Delete<T>(m_Data, Size);
+                    Buffer::Delete<T>(m_Data, Size, MemoryTag::Collections);
 
                 m_Data = std::move(other.m_Data);
             }
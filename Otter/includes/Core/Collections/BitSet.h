@@ -1,6 +1,8 @@
 #ifndef OTTERENGINE_BITSET_H
 #define OTTERENGINE_BITSET_H
 
+#include <bit>
+
 #include "Core/Memory.h"
 #include "Core/Collections/Iterators/LinearIterator.h"
 
@@ -8,6 +10,13 @@
 #include "Core/Collections/ReadOnly/ReadOnlySpan.h"
 #endif
 
+#if defined(__AVX2__)
+    #define OTR_BITSET_AVX2 1
+    #include <immintrin.h>
+#else
+    #define OTR_BITSET_AVX2 0
+#endif
+
 namespace Otter
 {
 #define UINT64_BITS 64
@@ -31,7 +40,7 @@ namespace Otter
         ~BitSet()
         {
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Data = nullptr;
         }
@@ -66,7 +75,7 @@ namespace Otter
                 return;
             }
 
-            m_Data = Buffer::New<UInt64>(m_Size);
+            m_Data = Buffer::New<UInt64>(m_Size, MemoryTag::Collections);
 
             for (UInt64 i = 0; i < m_Size; i++)
                 m_Data[i] = other.m_Data[i];
@@ -99,7 +108,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Size = other.m_Size;
 
@@ -109,7 +118,7 @@ namespace Otter
                 return *this;
             }
 
-            m_Data = Buffer::New<UInt64>(m_Size);
+            m_Data = Buffer::New<UInt64>(m_Size, MemoryTag::Collections);
 
             for (UInt64 i = 0; i < m_Size; i++)
                 m_Data[i] = other.m_Data[i];
@@ -130,7 +139,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Data = other.m_Data;
             m_Size = other.m_Size;
@@ -213,7 +222,8 @@ namespace Otter
         }
 
         /**
-         * @brief Checks if the bitset includes another bitset.
+         * @brief Checks if the bitset includes another bitset, which means that every bit that is set in the other
+         * bitset is also set in this one. The bitsets do not need to have the same size.
          *
          * @param other The other bitset.
          *
@@ -221,16 +231,220 @@ namespace Otter
          */
         [[nodiscard]] bool Includes(const BitSet& other) const
         {
-            if (m_Size != other.m_Size)
-                return false;
+            const UInt64 commonSize = m_Size < other.m_Size ? m_Size : other.m_Size;
+            UInt64       i          = 0;
 
-            for (UInt64 i = 0; i < m_Size; i++)
-                if ((m_Data[i] & other.m_Data[i]) != other.m_Data[i])
+#if OTR_BITSET_AVX2
+            for (; i + k_WordsPerVector <= commonSize; i += k_WordsPerVector)
+                if (!_mm256_testc_si256(LoadVector(m_Data + i), LoadVector(other.m_Data + i)))
+                    return false;
+#endif
+
+            for (; i < commonSize; i++)
+                if ((other.m_Data[i] & ~m_Data[i]) != 0)
+                    return false;
+
+            // The bits past the end of this bitset are all false, so the other bitset must not have any there
+            for (; i < other.m_Size; i++)
+                if (other.m_Data[i] != 0)
                     return false;
 
             return true;
         }
 
+        /**
+         * @brief Checks if the bitset has any bit set that is also set in another bitset.
+         *
+         * @param other The other bitset.
+         *
+         * @return True if the bitsets have a bit in common, false otherwise.
+         */
+        [[nodiscard]] bool Intersects(const BitSet& other) const
+        {
+            const UInt64 commonSize = m_Size < other.m_Size ? m_Size : other.m_Size;
+            UInt64       i          = 0;
+
+#if OTR_BITSET_AVX2
+            for (; i + k_WordsPerVector <= commonSize; i += k_WordsPerVector)
+                if (!_mm256_testz_si256(LoadVector(m_Data + i), LoadVector(other.m_Data + i)))
+                    return true;
+#endif
+
+            for (; i < commonSize; i++)
+                if ((m_Data[i] & other.m_Data[i]) != 0)
+                    return true;
+
+            return false;
+        }
+
+        /**
+         * @brief Clears every bit that is not set in another bitset.
+         *
+         * @param other The other bitset.
+         */
+        void And(const BitSet& other)
+        {
+            const UInt64 commonSize = m_Size < other.m_Size ? m_Size : other.m_Size;
+            Combine<AndOperation>(m_Data, other.m_Data, commonSize);
+
+            for (UInt64 i = commonSize; i < m_Size; i++)
+                m_Data[i] = 0;
+        }
+
+        /**
+         * @brief Sets every bit that is set in another bitset. The bitset grows to the size of the other one if it is
+         * smaller.
+         *
+         * @param other The other bitset.
+         */
+        void Or(const BitSet& other)
+        {
+            if (other.m_Size > m_Size)
+                Expand((other.m_Size - m_Size) * UINT64_BITS);
+
+            Combine<OrOperation>(m_Data, other.m_Data, other.m_Size);
+        }
+
+        /**
+         * @brief Flips every bit that is set in another bitset. The bitset grows to the size of the other one if it is
+         * smaller.
+         *
+         * @param other The other bitset.
+         */
+        void Xor(const BitSet& other)
+        {
+            if (other.m_Size > m_Size)
+                Expand((other.m_Size - m_Size) * UINT64_BITS);
+
+            Combine<XorOperation>(m_Data, other.m_Data, other.m_Size);
+        }
+
+        /**
+         * @brief Clears every bit that is set in another bitset.
+         *
+         * @param other The other bitset.
+         */
+        void AndNot(const BitSet& other)
+        {
+            Combine<AndNotOperation>(m_Data, other.m_Data, m_Size < other.m_Size ? m_Size : other.m_Size);
+        }
+
+        /**
+         * @brief Creates a bitset with the bits that are set in both of two bitsets.
+         *
+         * @param left The first bitset.
+         * @param right The second bitset.
+         *
+         * @return The new bitset, with the size of the first one.
+         */
+        [[nodiscard]] static BitSet And(const BitSet& left, const BitSet& right)
+        {
+            BitSet result = left;
+            result.And(right);
+
+            return result;
+        }
+
+        /**
+         * @brief Creates a bitset with the bits that are set in either of two bitsets.
+         *
+         * @param left The first bitset.
+         * @param right The second bitset.
+         *
+         * @return The new bitset, with the size of the larger one.
+         */
+        [[nodiscard]] static BitSet Or(const BitSet& left, const BitSet& right)
+        {
+            BitSet result = left;
+            result.Or(right);
+
+            return result;
+        }
+
+        /**
+         * @brief Creates a bitset with the bits that are set in exactly one of two bitsets.
+         *
+         * @param left The first bitset.
+         * @param right The second bitset.
+         *
+         * @return The new bitset, with the size of the larger one.
+         */
+        [[nodiscard]] static BitSet Xor(const BitSet& left, const BitSet& right)
+        {
+            BitSet result = left;
+            result.Xor(right);
+
+            return result;
+        }
+
+        /**
+         * @brief Creates a bitset with the bits that are set in one bitset but not in another.
+         *
+         * @param left The bitset whose bits are kept.
+         * @param right The bitset whose bits are cleared.
+         *
+         * @return The new bitset, with the size of the first one.
+         */
+        [[nodiscard]] static BitSet AndNot(const BitSet& left, const BitSet& right)
+        {
+            BitSet result = left;
+            result.AndNot(right);
+
+            return result;
+        }
+
+        /**
+         * @brief Finds the first bit that is set.
+         *
+         * @return The index of the bit, or the size of the bitset in bits if no bit is set.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 FindFirstSet() const noexcept { return FindNextSet(0); }
+
+        /**
+         * @brief Finds the first bit at or after a given index that is set. Whole words without any set bit are
+         * skipped at once.
+         *
+         * @param index The index to start from.
+         *
+         * @return The index of the bit, or the size of the bitset in bits if there is none.
+         */
+        [[nodiscard]] UInt64 FindNextSet(const UInt64 index) const noexcept
+        {
+            UInt64 i = index / UINT64_BITS;
+            if (i >= m_Size)
+                return GetBitsSize();
+
+            UInt64 word = m_Data[i] & (~0ULL << (index % UINT64_BITS));
+
+            while (word == 0)
+            {
+                if (++i >= m_Size)
+                    return GetBitsSize();
+
+                word = m_Data[i];
+            }
+
+            return i * UINT64_BITS + std::countr_zero(word);
+        }
+
+        /**
+         * @brief Calls a callback for every bit that is set, in ascending order.
+         *
+         * @tparam TCallback The type of the callback.
+         *
+         * @param callback The callback, which takes the index of the bit.
+         */
+        template<typename TCallback>
+        void ForEachSetBit(TCallback&& callback) const
+        {
+            for (UInt64 i = 0; i < m_Size; i++)
+            {
+                // Each pass takes the lowest set bit, and then clears it
+                for (UInt64 word = m_Data[i]; word != 0; word &= word - 1)
+                    callback(i * UINT64_BITS + std::countr_zero(word));
+            }
+        }
+
         /**
          * @brief Used to reserve memory for the bitset.
          *
@@ -252,15 +466,13 @@ namespace Otter
         {
             UInt64 newSize = CalculateExpandSize(bitAmount);
 
-            auto* newData = Buffer::New<UInt64>(newSize);
-
-            for (UInt64 i = 0; i < m_Size; i++)
-                newData[i] = m_Data[i];
-
-            if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
-
-            m_Data = newData;
+            m_Data = IsCreated()
+                     ? Buffer::Reallocate<UInt64>(m_Data,
+                                                  m_Size,
+                                                  newSize,
+                                                  AllocationFlags::Zeroed,
+                                                  MemoryTag::Collections)
+                     : Buffer::New<UInt64>(newSize, AllocationFlags::Zeroed, MemoryTag::Collections);
             m_Size = newSize;
         }
 
@@ -279,13 +491,13 @@ namespace Otter
                 return;
             }
 
-            auto* newData = Buffer::New<UInt64>(newSize);
+            auto* newData = Buffer::New<UInt64>(newSize, MemoryTag::Collections);
 
             for (UInt64 i = 0; i < newSize; i++)
                 newData[i] = m_Data[i];
 
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Data = newData;
             m_Size = newSize;
@@ -306,7 +518,7 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Size = 0;
             m_Data = nullptr;
@@ -400,6 +612,95 @@ namespace Otter
         UInt64* m_Data = nullptr;
         UInt64 m_Size = 0;
 
+#if OTR_BITSET_AVX2
+        /// @brief The number of words that are processed at once with AVX2.
+        static constexpr UInt64 k_WordsPerVector = sizeof(__m256i) / sizeof(UInt64);
+
+        /**
+         * @brief Loads a vector of words, which do not need to be aligned.
+         *
+         * @param words The first word.
+         *
+         * @return The vector.
+         */
+        OTR_INLINE static __m256i LoadVector(const UInt64* const words) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+        }
+#endif
+
+        /// @brief The operation of And, for a word and, with AVX2, for a vector of words.
+        struct AndOperation
+        {
+            OTR_INLINE static UInt64 Apply(const UInt64 left, const UInt64 right) noexcept { return left & right; }
+#if OTR_BITSET_AVX2
+            OTR_INLINE static __m256i Apply(const __m256i left, const __m256i right) noexcept
+            {
+                return _mm256_and_si256(left, right);
+            }
+#endif
+        };
+
+        /// @brief The operation of Or, for a word and, with AVX2, for a vector of words.
+        struct OrOperation
+        {
+            OTR_INLINE static UInt64 Apply(const UInt64 left, const UInt64 right) noexcept { return left | right; }
+#if OTR_BITSET_AVX2
+            OTR_INLINE static __m256i Apply(const __m256i left, const __m256i right) noexcept
+            {
+                return _mm256_or_si256(left, right);
+            }
+#endif
+        };
+
+        /// @brief The operation of Xor, for a word and, with AVX2, for a vector of words.
+        struct XorOperation
+        {
+            OTR_INLINE static UInt64 Apply(const UInt64 left, const UInt64 right) noexcept { return left ^ right; }
+#if OTR_BITSET_AVX2
+            OTR_INLINE static __m256i Apply(const __m256i left, const __m256i right) noexcept
+            {
+                return _mm256_xor_si256(left, right);
+            }
+#endif
+        };
+
+        /// @brief The operation of AndNot, for a word and, with AVX2, for a vector of words.
+        struct AndNotOperation
+        {
+            OTR_INLINE static UInt64 Apply(const UInt64 left, const UInt64 right) noexcept { return left & ~right; }
+#if OTR_BITSET_AVX2
+            OTR_INLINE static __m256i Apply(const __m256i left, const __m256i right) noexcept
+            {
+                return _mm256_andnot_si256(right, left);
+            }
+#endif
+        };
+
+        /**
+         * @brief Combines words with the words of another bitset, in place.
+         *
+         * @tparam TOperation The operation to combine a pair of words with.
+         *
+         * @param words The words to combine into.
+         * @param otherWords The words to combine with.
+         * @param count The number of words.
+         */
+        template<typename TOperation>
+        OTR_INLINE static void Combine(UInt64* const words, const UInt64* const otherWords, const UInt64 count) noexcept
+        {
+            UInt64 i = 0;
+
+#if OTR_BITSET_AVX2
+            for (; i + k_WordsPerVector <= count; i += k_WordsPerVector)
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i),
+                                    TOperation::Apply(LoadVector(words + i), LoadVector(otherWords + i)));
+#endif
+
+            for (; i < count; i++)
+                words[i] = TOperation::Apply(words[i], otherWords[i]);
+        }
+
         /**
          * @brief Recreates the bitset with a given size. Deletes any existing data.
          *
@@ -408,10 +709,10 @@ namespace Otter
         void RecreateEmpty(const UInt64 bitsSize)
         {
             if (IsCreated())
-                Buffer::Delete<UInt64>(m_Data, m_Size);
+                Buffer::Delete<UInt64>(m_Data, m_Size, MemoryTag::Collections);
 
             m_Size = GetActualOrMinimumSize(bitsSize);
-            m_Data = Buffer::New<UInt64>(m_Size);
+            m_Data = Buffer::New<UInt64>(m_Size, AllocationFlags::Zeroed, MemoryTag::Collections);
         }
 
         /**
@@ -477,6 +778,14 @@ namespace Otter
         }
     };
 
+    /**
+     * @brief A bit set only holds a pointer to its words, so moving its bytes is enough to move it.
+     */
+    template<>
+    struct IsTriviallyRelocatable<BitSet> : std::true_type
+    {
+    };
+
 #undef UINT64_BITS
 }
 
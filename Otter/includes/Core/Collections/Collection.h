@@ -34,9 +34,9 @@ namespace Otter
             OTR_INTERNAL_ASSERT_MSG(count > 0, "Count must be greater than 0!")
 
             if (outCollection.m_Data && outCollection.m_Capacity > 0)
-                Buffer::Delete<T>(outCollection.m_Data, outCollection.m_Capacity);
+                Buffer::Delete<T>(outCollection.m_Data, outCollection.m_Capacity, MemoryTag::Collections);
 
-            outCollection.m_Data     = Buffer::New<T>(count);
+            outCollection.m_Data     = Buffer::New<T>(count, MemoryTag::Collections);
             outCollection.m_Capacity = count;
             outCollection.m_Count    = 0;
 
@@ -61,7 +61,7 @@ namespace Otter
         {
             Collection<T> collection;
             collection.m_Capacity = list.size();
-            collection.m_Data     = Buffer::New<T>(collection.m_Capacity);
+            collection.m_Data     = Buffer::New<T>(collection.m_Capacity, MemoryTag::Collections);
 
             collection.m_Count = 0;
             for (const T& item: list)
@@ -82,10 +82,10 @@ namespace Otter
         static void New(InitialiserList<T> list, Collection<T>& outCollection)
         {
             if (outCollection.m_Data && outCollection.m_Capacity > 0)
-                Buffer::Delete<T>(outCollection.m_Data, outCollection.m_Capacity);
+                Buffer::Delete<T>(outCollection.m_Data, outCollection.m_Capacity, MemoryTag::Collections);
 
             outCollection.m_Capacity = list.size();
-            outCollection.m_Data     = Buffer::New<T>(outCollection.m_Capacity);
+            outCollection.m_Data     = Buffer::New<T>(outCollection.m_Capacity, MemoryTag::Collections);
 
             outCollection.m_Count = 0;
             for (const T& item: list)
@@ -118,7 +118,7 @@ namespace Otter
         ~Collection()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
         }
 
         /**
@@ -170,15 +170,21 @@ namespace Otter
         {
             UInt64 newCapacity = CalculateExpandCapacity(amount);
 
-            T* newData = Buffer::New<T>(newCapacity);
-
-            for (UInt64 i = 0; i < m_Count; i++)
-                newData[i] = m_Data[i];
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (IsCreated())
+                {
+                    m_Data     = Buffer::Reallocate<T>(m_Data, m_Capacity, newCapacity, MemoryTag::Collections);
+                    m_Capacity = newCapacity;
+                    return;
+                }
+            }
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                m_Data = Buffer::Relocate<T>(m_Data, m_Capacity, newCapacity, m_Count, 0, MemoryTag::Collections);
+            else
+                m_Data = Buffer::New<T>(newCapacity, MemoryTag::Collections);
 
-            m_Data     = newData;
             m_Capacity = newCapacity;
         }
 
@@ -198,15 +204,21 @@ namespace Otter
                 return;
             }
 
-            T* newData = Buffer::New<T>(newCapacity);
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                if (IsCreated())
+                {
+                    m_Data     = Buffer::Reallocate<T>(m_Data, m_Capacity, newCapacity, MemoryTag::Collections);
+                    m_Capacity = newCapacity;
 
-            for (UInt64 i = 0; i < m_Count && i < newCapacity; i++)
-                newData[i] = m_Data[i];
+                    if (m_Count >= newCapacity)
+                        m_Count = newCapacity;
 
-            if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                    return;
+                }
+            }
 
-            m_Data     = newData;
+            m_Data     = Buffer::Relocate<T>(m_Data, m_Capacity, newCapacity, m_Count, 0, MemoryTag::Collections);
             m_Capacity = newCapacity;
 
             if (m_Count >= newCapacity)
@@ -262,7 +274,7 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Data     = nullptr;
             m_Capacity = 0;
@@ -351,9 +363,9 @@ namespace Otter
         void RecreateEmpty(const UInt64 capacity)
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
-            m_Data     = capacity > 0 ? Buffer::New<T>(capacity) : nullptr;
+            m_Data     = capacity > 0 ? Buffer::New<T>(capacity, MemoryTag::Collections) : nullptr;
             m_Capacity = capacity;
             m_Count    = 0;
         }
@@ -411,27 +423,27 @@ namespace Otter
 
 #define OTR_COLLECTION_CHILD(Type) Type
 
-#define OTR_COLLECTION_CONSTRUCT(Type)                                          \
-    OTR_COLLECTION_CHILD(Type)() : Collection<T>() { }                          \
-    ~OTR_COLLECTION_CHILD(Type)()                                               \
-    {                                                                           \
-        if (base::IsCreated())                                                  \
-            Buffer::Delete<T>(base::m_Data, base::m_Capacity);                  \
-                                                                                \
-        base::m_Data     = nullptr;                                             \
-        base::m_Capacity = 0;                                                   \
-        base::m_Count    = 0;                                                   \
-    }                                                                           \
-                                                                                \
-    OTR_COLLECTION_CHILD(Type)(InitialiserList<T> list)                         \
-        : Collection<T>()                                                       \
-    {                                                                           \
-        base::m_Capacity = list.size();                                         \
-        base::m_Data     = Buffer::New<T>(base::m_Capacity);                    \
-                                                                                \
-        base::m_Count = 0;                                                      \
-        for (const T& item: list)                                               \
-            base::m_Data[base::m_Count++] = item;                               \
+#define OTR_COLLECTION_CONSTRUCT(Type)                                                 \
+    OTR_COLLECTION_CHILD(Type)() : Collection<T>() { }                                 \
+    ~OTR_COLLECTION_CHILD(Type)()                                                      \
+    {                                                                                  \
+        if (base::IsCreated())                                                         \
+            Buffer::Delete<T>(base::m_Data, base::m_Capacity, MemoryTag::Collections); \
+                                                                                       \
+        base::m_Data     = nullptr;                                                    \
+        base::m_Capacity = 0;                                                          \
+        base::m_Count    = 0;                                                          \
+    }                                                                                  \
+                                                                                       \
+    OTR_COLLECTION_CHILD(Type)(InitialiserList<T> list)                                \
+        : Collection<T>()                                                              \
+    {                                                                                  \
+        base::m_Capacity = list.size();                                                \
+        base::m_Data     = Buffer::New<T>(base::m_Capacity, MemoryTag::Collections);   \
+                                                                                       \
+        base::m_Count = 0;                                                             \
+        for (const T& item: list)                                                      \
+            base::m_Data[base::m_Count++] = item;                                      \
     }
 
 #define OTR_COLLECTION_COPY(Type)                                                           \
@@ -443,7 +455,7 @@ namespace Otter
         if (base::m_Capacity == 0)                                                          \
             return;                                                                         \
                                                                                             \
-        base::m_Data = Buffer::New<T>(base::m_Capacity);                                    \
+        base::m_Data = Buffer::New<T>(base::m_Capacity, MemoryTag::Collections);            \
                                                                                             \
         if (base::m_Count > 0)                                                              \
             MemorySystem::MemoryCopy(base::m_Data, other.m_Data, base::m_Count * sizeof(T));\
@@ -455,7 +467,7 @@ namespace Otter
             return *this;                                                                   \
                                                                                             \
         if (base::IsCreated())                                                              \
-            Buffer::Delete<T>(base::m_Data, base::m_Capacity);                              \
+            Buffer::Delete<T>(base::m_Data, base::m_Capacity, MemoryTag::Collections);      \
                                                                                             \
         base::m_Capacity = other.m_Capacity;                                                \
         base::m_Count    = other.m_Count;                                                   \
@@ -463,7 +475,7 @@ namespace Otter
         if (base::m_Capacity == 0)                                                          \
             return *this;                                                                   \
                                                                                             \
-        base::m_Data = Buffer::New<T>(base::m_Capacity);                                    \
+        base::m_Data = Buffer::New<T>(base::m_Capacity, MemoryTag::Collections);            \
                                                                                             \
         if (base::m_Count > 0)                                                              \
             MemorySystem::MemoryCopy(base::m_Data, other.m_Data, base::m_Count * sizeof(T));\
@@ -489,7 +501,7 @@ namespace Otter
             return *this;                                                                       \
                                                                                                 \
         if (base::IsCreated())                                                                  \
-            Buffer::Delete<T>(base::m_Data, base::m_Capacity);                                  \
+            Buffer::Delete<T>(base::m_Data, base::m_Capacity, MemoryTag::Collections);          \
                                                                                                 \
         base::m_Capacity = std::move(other.m_Capacity);                                         \
         base::m_Count    = std::move(other.m_Count);                                            \
@@ -37,7 +37,7 @@ namespace Otter
         ~Deque()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
         }
 
         /**
@@ -49,7 +49,7 @@ namespace Otter
             : Deque()
         {
             m_Capacity = list.size();
-            m_Data     = Buffer::New < T > (m_Capacity);
+            m_Data     = Buffer::New < T > (m_Capacity, MemoryTag::Collections);
 
             m_Count = 0;
             for (const T& item: list)
@@ -69,7 +69,7 @@ namespace Otter
             if (m_Capacity == 0)
                 return;
 
-            m_Data = Buffer::New < T > (m_Capacity);
+            m_Data = Buffer::New < T > (m_Capacity, MemoryTag::Collections);
 
             if (m_Count > 0)
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Count * sizeof(T));
@@ -104,7 +104,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Capacity = other.m_Capacity;
             m_Count    = other.m_Count;
@@ -112,7 +112,7 @@ namespace Otter
             if (m_Capacity == 0)
                 return *this;
 
-            m_Data = Buffer::New < T > (m_Capacity);
+            m_Data = Buffer::New < T > (m_Capacity, MemoryTag::Collections);
 
             if (m_Count > 0)
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Count * sizeof(T));
@@ -133,7 +133,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Capacity = std::move(other.m_Capacity);
             m_Count    = std::move(other.m_Count);
@@ -405,15 +405,11 @@ namespace Otter
             if (capacity <= m_Capacity)
                 return;
 
-            T* newData = Buffer::New < T > (capacity);
-
-            for (UInt64 i = 0; i < m_Count; i++)
-                newData[i] = m_Data[i];
-
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                m_Data = Buffer::Relocate<T>(m_Data, m_Capacity, capacity, m_Count, 0, MemoryTag::Collections);
+            else
+                m_Data = Buffer::New<T>(capacity, MemoryTag::Collections);
 
-            m_Data     = newData;
             m_Capacity = capacity;
         }
 
@@ -432,15 +428,7 @@ namespace Otter
                 return;
             }
 
-            T* newData = Buffer::New < T > (newCapacity);
-
-            for (UInt64 i = 0; i < m_Count; i++)
-                newData[i] = m_Data[i];
-
-            if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
-
-            m_Data     = newData;
+            m_Data     = Buffer::Relocate<T>(m_Data, m_Capacity, newCapacity, m_Count, 0, MemoryTag::Collections);
             m_Capacity = newCapacity;
         }
 
@@ -460,15 +448,7 @@ namespace Otter
                 return;
             }
 
-            T* newData = Buffer::New < T > (newCapacity);
-
-            for (UInt64 i = 0; i < m_Count && i < newCapacity; i++)
-                newData[i] = m_Data[i];
-
-            if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
-
-            m_Data     = newData;
+            m_Data     = Buffer::Relocate<T>(m_Data, m_Capacity, newCapacity, m_Count, 0, MemoryTag::Collections);
             m_Capacity = newCapacity;
             m_Count    = m_Count < newCapacity ? m_Count : newCapacity;
         }
@@ -484,7 +464,7 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Data     = nullptr;
             m_Capacity = 0;
@@ -621,9 +601,9 @@ namespace Otter
         void RecreateEmpty(const UInt64 capacity)
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
-            m_Data     = capacity > 0 ? Buffer::New < T > (capacity) : nullptr;
+            m_Data     = capacity > 0 ? Buffer::New < T > (capacity, MemoryTag::Collections) : nullptr;
             m_Capacity = capacity;
             m_Count    = 0;
         }
@@ -675,6 +655,14 @@ namespace Otter
             return newCapacity;
         }
     };
+
+    /**
+     * @brief A deque never points into itself, so it can be moved bytewise.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable<Deque<T>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_DEQUE_H
@@ -1,10 +1,14 @@
 #ifndef OTTERENGINE_DICTIONARY_H
 #define OTTERENGINE_DICTIONARY_H
 
+#include <cstring>
+#include <new>
+
+#include "Core/Memory.h"
 #include "Core/Function.h"
-#include "Core/Collections/BitSet.h"
-#include "Core/Collections/Utils/HashSlot.h"
-#include "Core/Collections/Utils/HashUtils.h"
+#include "Core/Collections/Collection.h"
+#include "Core/Collections/Utils/HashControl.h"
+#include "Core/Collections/Utils/HashedKey.h"
 #include "Core/Collections/Utils/KeyValuePair.h"
 
 #if !OTR_RUNTIME
@@ -15,25 +19,31 @@ namespace Otter
 {
     /**
      * @brief A collection of unique key/value pairs that are stored in a contiguous block of memory and can be
-     * accessed by their keys' hash. The capacity of the dictionary is automatically expanded to the next prime when
-     * the item count reaches the capacity in order to maintain a low collision rate.
+     * accessed by their keys' hash. The dictionary uses open addressing: every slot has a control byte holding part of
+     * the hash of its key, and a lookup matches a whole group of control bytes at once before comparing any keys. The
+     * capacity is always a power of two and is doubled when the dictionary becomes 7/8 full.
      *
      * @tparam TKey The type of the keys.
      * @tparam TValue The type of the values.
+     *
+     * @note The order of the key/value pairs is unspecified and can change whenever the dictionary is modified.
      */
     template<typename TKey, typename TValue>
     class Dictionary final
     {
-        /// @brief Alias for HashUtils.
-        using HashUtils = Internal::HashUtils;
+        /// @brief Alias for HashControl.
+        using HashControl = Internal::HashControl;
+
+        /// @brief Alias for HashGroup.
+        using HashGroup = Internal::HashGroup;
+
+        /// @brief Alias for HashProbe.
+        using HashProbe = Internal::HashProbe;
 
         /// @brief Alias for a KeyValuePair.
         using Pair = KeyValuePair<TKey, TValue>;
 
-        /// @brief Alias for a slot.
-        using Slot = Slot<Pair>;
-
-        /// @brief Iterator for a collection of Slots.
+        /// @brief Iterator for a collection of slots.
         class SlotIterator;
 
     public:
@@ -59,13 +69,7 @@ namespace Otter
         Dictionary(InitialiserList<Pair> list)
             : Dictionary()
         {
-            m_Capacity             = k_InitialCapacity;
-            m_Slots                = Buffer::New<Slot>(k_InitialCapacity);
-            m_Count                = 0;
-            m_CurrentMaxCollisions = 0;
-
-            for (const Pair& item: list)
-                TryAdd(item.Key, item.Value);
+            TryAddRangeInternal(list.begin(), list.size());
         }
 
         /**
@@ -75,20 +79,7 @@ namespace Otter
          */
         Dictionary(const Dictionary<TKey, TValue>& other)
         {
-            m_Capacity             = other.m_Capacity;
-            m_Count                = other.m_Count;
-            m_CurrentMaxCollisions = other.m_CurrentMaxCollisions;
-            m_SlotsInUse           = other.m_SlotsInUse;
-            m_Collisions           = other.m_Collisions;
-
-            if (m_Capacity == 0)
-                return;
-
-            m_Slots = Buffer::New<Slot>(m_Capacity);
-
-            if (m_Count > 0)
-                for (UInt64 i = 0; i < m_Capacity; i++)
-                    m_Slots[i] = other.m_Slots[i];
+            CopyFrom(other);
         }
 
         /**
@@ -98,17 +89,17 @@ namespace Otter
          */
         Dictionary(Dictionary<TKey, TValue>&& other) noexcept
         {
-            m_Slots                = std::move(other.m_Slots);
-            m_Capacity             = std::move(other.m_Capacity);
-            m_Count                = std::move(other.m_Count);
-            m_CurrentMaxCollisions = std::move(other.m_CurrentMaxCollisions);
-            m_SlotsInUse           = std::move(other.m_SlotsInUse);
-            m_Collisions           = std::move(other.m_Collisions);
-
-            other.m_Slots                = nullptr;
-            other.m_Capacity             = 0;
-            other.m_Count                = 0;
-            other.m_CurrentMaxCollisions = 0;
+            m_Control    = other.m_Control;
+            m_Slots      = other.m_Slots;
+            m_Capacity   = other.m_Capacity;
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
+
+            other.m_Control    = nullptr;
+            other.m_Slots      = nullptr;
+            other.m_Capacity   = 0;
+            other.m_Count      = 0;
+            other.m_GrowthLeft = 0;
         }
 
         /**
@@ -126,20 +117,7 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Capacity             = other.m_Capacity;
-            m_Count                = other.m_Count;
-            m_CurrentMaxCollisions = other.m_CurrentMaxCollisions;
-            m_SlotsInUse           = other.m_SlotsInUse;
-            m_Collisions           = other.m_Collisions;
-
-            if (m_Capacity == 0)
-                return *this;
-
-            m_Slots = Buffer::New<Slot>(m_Capacity);
-
-            if (m_Count > 0)
-                for (UInt64 i = 0; i < m_Capacity; i++)
-                    m_Slots[i] = other.m_Slots[i];
+            CopyFrom(other);
 
             return *this;
         }
@@ -159,17 +137,17 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Slots                = std::move(other.m_Slots);
-            m_Capacity             = std::move(other.m_Capacity);
-            m_Count                = std::move(other.m_Count);
-            m_CurrentMaxCollisions = std::move(other.m_CurrentMaxCollisions);
-            m_SlotsInUse           = std::move(other.m_SlotsInUse);
-            m_Collisions           = std::move(other.m_Collisions);
+            m_Control    = other.m_Control;
+            m_Slots      = other.m_Slots;
+            m_Capacity   = other.m_Capacity;
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
 
-            other.m_Slots                = nullptr;
-            other.m_Capacity             = 0;
-            other.m_Count                = 0;
-            other.m_CurrentMaxCollisions = 0;
+            other.m_Control    = nullptr;
+            other.m_Slots      = nullptr;
+            other.m_Capacity   = 0;
+            other.m_Count      = 0;
+            other.m_GrowthLeft = 0;
 
             return *this;
         }
@@ -179,16 +157,21 @@ namespace Otter
          *
          * @param other The other dictionary.
          *
-         * @return True if the hashsets are equal, false otherwise.
+         * @return True if the dictionaries hold the same key/value pairs, false otherwise.
          */
         bool operator==(const Dictionary<TKey, TValue>& other) const noexcept
         {
             if (m_Count != other.m_Count)
                 return false;
 
-            for (UInt64 i = 0; i < m_Capacity; ++i)
-                if (m_Slots[i] != other.m_Slots[i])
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
+            {
+                UInt64 index;
+                if (!other.Find(m_Slots[i].Key, &index) || !(other.m_Slots[index].Value == m_Slots[i].Value))
                     return false;
+            }
 
             return true;
         }
@@ -198,7 +181,7 @@ namespace Otter
          *
          * @param other The other dictionary.
          *
-         * @return True if the hashsets are not equal, false otherwise.
+         * @return True if the dictionaries do not hold the same key/value pairs, false otherwise.
          */
         bool operator!=(const Dictionary<TKey, TValue>& other) const noexcept { return !(*this == other); }
 
@@ -209,20 +192,39 @@ namespace Otter
          *
          * @return The address of the element for the specified key.
          */
-        [[nodiscard]] TValue* operator[](const TKey key) const
+        [[nodiscard]] TValue* operator[](const TKey& key) const
         {
             if (IsEmpty())
                 return nullptr;
 
             UInt64 index;
-            if (!Exists(key, &index))
+            if (!Find(key, &index))
                 return nullptr;
 
-            return &m_Slots[index].Data.Value;
+            return &m_Slots[index].Value;
         }
 
         /**
-         * @brief Tries to add a key/value pair to the dictionary.
+         * @brief Gets the element for the specified key, with the hash code of the key already computed.
+         *
+         * @param key The hashed key.
+         *
+         * @return The address of the element for the specified key.
+         */
+        [[nodiscard]] TValue* operator[](const HashedKey<TKey>& key) const
+        {
+            if (IsEmpty())
+                return nullptr;
+
+            UInt64 index;
+            if (!Find(key.GetKey(), HashControl::Mix(key.GetHashCode()), &index))
+                return nullptr;
+
+            return &m_Slots[index].Value;
+        }
+
+        /**
+         * @brief Tries to add a key/value pair to the dictionary. If the key already exists, its value is replaced.
          *
          * @param key The key of the pair.
          * @param value The value of the pair.
@@ -231,56 +233,92 @@ namespace Otter
          */
         bool TryAdd(const TKey& key, const TValue& value)
         {
-            if (m_Count >= m_Capacity || m_CurrentMaxCollisions >= k_MaxCollisions)
-                Expand();
-
-            UInt64 hash  = GetHashCode(key) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
+            return TryAddWithHash(key, value, HashKey(key));
+        }
 
-            if (!HasItemStoredAt(index))
-                return TryAddToEmptySlot({ key, value }, hash, index);
+        /**
+         * @brief Tries to add a key/value pair to the dictionary. If the key already exists, its value is replaced.
+         *
+         * @param key The key of the pair.
+         * @param value The value of the pair.
+         *
+         * @return True if the pair was added, false otherwise.
+         */
+        bool TryAdd(TKey&& key, TValue&& value) noexcept
+        {
+            const UInt64 hash = HashKey(key);
 
-            if (m_Slots[index].MatchesKey(key, hash))
+            UInt64 index;
+            if (!IsEmpty() && Find(key, hash, &index))
             {
-                m_Slots[index].Data.Value = value;
+                m_Slots[index].Value = std::move(value);
                 return true;
             }
 
-            if (HasCollisionStoredAt(index))
-                return TryAddToCollisionSlot({ key, value }, hash, index);
+            index = PrepareInsert(hash);
+            new(&m_Slots[index]) Pair(std::move(key), std::move(value));
 
-            return TryAddNewCollision({ key, value }, index, hash);
+            return true;
         }
 
         /**
-         * @brief Tries to add a key/value pair to the dictionary.
+         * @brief Tries to add a key/value pair to the dictionary, with the hash code of the key already computed. If
+         * the key already exists, its value is replaced.
          *
-         * @param key The key of the pair.
+         * @param key The hashed key of the pair.
          * @param value The value of the pair.
          *
          * @return True if the pair was added, false otherwise.
          */
-        bool TryAdd(TKey&& key, TValue&& value) noexcept
+        bool TryAdd(const HashedKey<TKey>& key, const TValue& value)
         {
-            if (m_Count >= m_Capacity || m_CurrentMaxCollisions >= k_MaxCollisions)
-                Expand();
+            return TryAddWithHash(key.GetKey(), value, HashControl::Mix(key.GetHashCode()));
+        }
 
-            UInt64 hash  = GetHashCode(key) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
+        /**
+         * @brief Finds the value associated with a key, adding a default-constructed value for the key first if it
+         * does not exist yet. This takes a single lookup, where checking for the key and then adding it takes two.
+         *
+         * @param key The key.
+         * @param outInserted Set to whether the key was added. Can be null.
+         *
+         * @return The value associated with the key.
+         *
+         * @note The reference is invalidated by the next addition to the dictionary.
+         */
+        TValue& FindOrInsert(const TKey& key, bool* outInserted = nullptr)
+        {
+            return FindOrInsert(HashedKey<TKey>(key), outInserted);
+        }
 
-            if (!HasItemStoredAt(index))
-                return TryAddToEmptySlot(Pair(std::move(key), std::move(value)), hash, index);
+        /**
+         * @brief Finds the value associated with a key, with the hash code of the key already computed, adding a
+         * default-constructed value for the key first if it does not exist yet.
+         *
+         * @param key The hashed key.
+         * @param outInserted Set to whether the key was added. Can be null.
+         *
+         * @return The value associated with the key.
+         *
+         * @note The reference is invalidated by the next addition to the dictionary.
+         */
+        TValue& FindOrInsert(const HashedKey<TKey>& key, bool* outInserted = nullptr)
+        {
+            const UInt64 hash = HashControl::Mix(key.GetHashCode());
 
-            if (m_Slots[index].MatchesKey(key, hash))
+            UInt64 index;
+            const bool found = !IsEmpty() && Find(key.GetKey(), hash, &index);
+
+            if (!found)
             {
-                m_Slots[index].Data.Value = std::move(value);
-                return true;
+                index = PrepareInsert(hash);
+                new(&m_Slots[index]) Pair(key.GetKey(), TValue());
             }
 
-            if (HasCollisionStoredAt(index))
-                return TryAddToCollisionSlot(Pair(std::move(key), std::move(value)), hash, index);
+            if (outInserted)
+                *outInserted = !found;
 
-            return TryAddNewCollision(Pair(std::move(key), std::move(value)), index, hash);
+            return m_Slots[index].Value;
         }
 
         /**
@@ -299,10 +337,51 @@ namespace Otter
                 return false;
 
             UInt64 index;
-            if (!Exists(key, &index))
+            if (!Find(key, &index))
                 return false;
 
-            *outValue = m_Slots[index].Data.Value;
+            *outValue = m_Slots[index].Value;
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to get the value associated with the specified key, with the hash code of the key already
+         * computed.
+         *
+         * @param key The hashed key of the value to get.
+         * @param outValue The value associated with the key.
+         *
+         * @return True if the value was retrieved, false otherwise.
+         */
+        bool TryGet(const HashedKey<TKey>& key, TValue* outValue) const
+        {
+            return TryGetWithHash(key.GetKey(), key.GetHashCode(), outValue);
+        }
+
+        /**
+         * @brief Tries to get the value associated with the specified key, with the hash code of the key already
+         * computed.
+         *
+         * @param key The key of the value to get.
+         * @param hashCode The hash code of the key, as returned by GetHashCode.
+         * @param outValue The value associated with the key.
+         *
+         * @return True if the value was retrieved, false otherwise.
+         */
+        bool TryGetWithHash(const TKey& key, const UInt64 hashCode, TValue* outValue) const
+        {
+            OTR_ASSERT(outValue, "outValue cannot be null.")
+            OTR_ASSERT(hashCode == GetHashCode(key), "Hash code does not match the key.")
+
+            if (IsEmpty())
+                return false;
+
+            UInt64 index;
+            if (!Find(key, HashControl::Mix(hashCode), &index))
+                return false;
+
+            *outValue = m_Slots[index].Value;
 
             return true;
         }
@@ -320,24 +399,10 @@ namespace Otter
                 return false;
 
             UInt64 index;
-            if (!Exists(key, &index))
+            if (!Find(key, &index))
                 return false;
 
-            if (m_Slots[index].Next)
-            {
-                if constexpr (std::is_move_assignable_v<Pair>)
-                    m_Slots[index].Data = std::move(m_Slots[index].Next->Data);
-                else
-                    m_Slots[index].Data = m_Slots[index].Next->Data;
-
-                m_Slots[index].Hash = m_Slots[index].Next->Hash;
-                m_Slots[index].Next = m_Slots[index].Next->Next;
-            }
-
-            m_SlotsInUse.Set(index, false);
-            m_Collisions.Set(index, false);
-
-            m_Count--;
+            EraseAt(index);
 
             return true;
         }
@@ -354,7 +419,24 @@ namespace Otter
             if (IsEmpty())
                 return false;
 
-            return Exists(key);
+            UInt64 index;
+            return Find(key, &index);
+        }
+
+        /**
+         * @brief Checks if the dictionary contains a given key, with the hash code of the key already computed.
+         *
+         * @param key The hashed key of the item to check.
+         *
+         * @return True if the dictionary contains the key, false otherwise.
+         */
+        [[nodiscard]] bool ContainsKey(const HashedKey<TKey>& key) const
+        {
+            if (IsEmpty())
+                return false;
+
+            UInt64 index;
+            return Find(key.GetKey(), HashControl::Mix(key.GetHashCode()), &index);
         }
 
         /**
@@ -372,7 +454,7 @@ namespace Otter
             if (IsEmpty())
                 return false;
 
-            return Exists(key, outIndex);
+            return Find(key, outIndex);
         }
 
         /**
@@ -385,12 +467,11 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                callback(m_Slots[i].Data.Key, m_Slots[i].Data.Value);
+                callback(m_Slots[i].Key, m_Slots[i].Value);
             }
         }
 
@@ -404,17 +485,16 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                callback(m_Slots[i].Data.Key, &m_Slots[i].Data.Value);
+                callback(m_Slots[i].Key, &m_Slots[i].Value);
             }
         }
 
         /**
-         * @brief Performs a given callback on each key in the dictionary.
+         * @brief Performs a given callback on the value of a key in the dictionary.
          *
          * @param key The key to perform the callback on.
          * @param callback The callback to perform.
@@ -427,10 +507,10 @@ namespace Otter
                 return false;
 
             UInt64 index;
-            if (!Exists(key, &index))
+            if (!Find(key, &index))
                 return false;
 
-            callback(m_Slots[index].Data.Value);
+            callback(m_Slots[index].Value);
 
             return true;
         }
@@ -445,12 +525,11 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                callback(m_Slots[i].Data.Key);
+                callback(m_Slots[i].Key);
             }
         }
 
@@ -464,12 +543,11 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                callback(m_Slots[i].Data.Value);
+                callback(m_Slots[i].Value);
             }
         }
 
@@ -483,32 +561,87 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
+                callback(&m_Slots[i].Value);
+            }
+        }
+
+        /**
+         * @brief Tries to add a range of key/value pairs to the dictionary. If a key already exists, its value is
+         * replaced.
+         *
+         * @param pairs The pairs to add.
+         *
+         * @return True if the pairs were added, false otherwise.
+         */
+        bool TryAddRange(InitialiserList<Pair> pairs)
+        {
+            return TryAddRangeInternal(pairs.begin(), pairs.size());
+        }
+
+        /**
+         * @brief Tries to add a collection of key/value pairs to the dictionary. If a key already exists, its value is
+         * replaced.
+         *
+         * @param pairs The pairs to add.
+         *
+         * @return True if the pairs were added, false otherwise.
+         */
+        bool TryAddRange(const Collection<Pair>& pairs)
+        {
+            return TryAddRangeInternal(pairs.GetData(), pairs.GetCount());
+        }
+
+        /**
+         * @brief Reserves room for a given number of key/value pairs, so that they can be added without growing.
+         *
+         * @param count The number of key/value pairs to make room for, including the ones already in the dictionary.
+         */
+        void Reserve(const UInt64 count)
+        {
+            if (m_Capacity > 0 && (count <= m_Count || m_GrowthLeft >= count - m_Count))
+                return;
+
+            const UInt64 newCapacity = HashControl::GetCapacityFor(count,
+                                                                   m_Capacity > 0 ? m_Capacity : k_InitialCapacity);
+
+            if (IsEmpty())
+            {
+                if (IsCreated())
+                    Destroy();
 
-                callback(&m_Slots[i].Data.Value);
+                CreateEmpty(newCapacity);
+                return;
             }
+
+            Resize(newCapacity);
         }
 
         /**
          * @brief Ensures that the dictionary has a given capacity.
          *
-         * @param capacity The capacity to ensure.
+         * @param capacity The capacity to ensure. It is rounded up to the next power of two.
          */
         void EnsureCapacity(const UInt64 capacity)
         {
             if (capacity <= m_Capacity)
                 return;
 
+            const UInt64 newCapacity = std::bit_ceil(capacity < k_InitialCapacity ? k_InitialCapacity : capacity);
+
             if (IsEmpty())
             {
-                RecreateEmpty(HashUtils::GetNextPrime(capacity));
+                if (IsCreated())
+                    Destroy();
+
+                CreateEmpty(newCapacity);
                 return;
             }
 
-            Expand(capacity - m_Capacity);
+            Resize(newCapacity);
         }
 
         /**
@@ -519,8 +652,8 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            m_SlotsInUse.Clear();
-            m_Collisions.Clear();
+            DestroyItems();
+            ResetControl();
 
             m_Count = 0;
         }
@@ -533,9 +666,11 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Slots    = nullptr;
-            m_Capacity = 0;
-            m_Count    = 0;
+            m_Control    = nullptr;
+            m_Slots      = nullptr;
+            m_Capacity   = 0;
+            m_Count      = 0;
+            m_GrowthLeft = 0;
         }
 
 #if !OTR_RUNTIME
@@ -546,23 +681,20 @@ namespace Otter
          *
          * @return The memory footprint of the dictionary.
          */
-        [[nodiscard]] ReadOnlySpan<MemoryFootprint, 3> GetMemoryFootprint(const char* const debugName) const
+        [[nodiscard]] ReadOnlySpan<MemoryFootprint, 1> GetMemoryFootprint(const char* const debugName) const
         {
             MemoryFootprint footprint = { };
             MemorySystem::CheckMemoryFootprint([&]()
                                                {
                                                    MemoryDebugPair pair[1];
-                                                   pair[0] = { debugName, m_Slots };
+                                                   pair[0] = { debugName, m_Control };
 
                                                    return MemoryDebugHandle{ pair, 1 };
                                                },
                                                &footprint,
                                                nullptr);
 
-            auto slotsInUseFootprint = m_SlotsInUse.GetMemoryFootprint(OTR_NAME_OF(BitSet));
-            auto collisionsFootprint = m_Collisions.GetMemoryFootprint(OTR_NAME_OF(BitSet));
-
-            return ReadOnlySpan<MemoryFootprint, 3>{ footprint, slotsInUseFootprint[0], collisionsFootprint[0] };
+            return ReadOnlySpan<MemoryFootprint, 1>{ footprint };
         }
 #endif
 
@@ -595,7 +727,7 @@ namespace Otter
          *
          * @return The resizing factor of the dictionary.
          */
-        [[nodiscard]] OTR_INLINE static constexpr Float16 GetResizingFactor() noexcept { return k_ResizingFactor; }
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetResizingFactor() noexcept { return k_ResizingFactor; }
 
         /**
          * @brief Checks whether the dictionary has been created. A dictionary is created when it has been initialised
@@ -603,7 +735,7 @@ namespace Otter
          *
          * @return True if the dictionary has been created, false otherwise.
          */
-        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Slots && m_Capacity > 0; }
+        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Control && m_Capacity > 0; }
 
         /**
          * @brief Checks whether the dictionary is empty.
@@ -619,15 +751,8 @@ namespace Otter
          */
         SlotIterator begin() const noexcept
         {
-            for (UInt64 i = 0; i < m_Capacity; i++)
-            {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                return SlotIterator(m_Slots, m_Slots + i, m_Capacity, m_SlotsInUse);
-            }
-
-            return SlotIterator(m_Slots, m_Slots + m_Capacity, m_Capacity, m_SlotsInUse);
+            const UInt64 index = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, (Int64) index);
         }
 
         /**
@@ -637,7 +762,7 @@ namespace Otter
          */
         OTR_INLINE SlotIterator end() const noexcept
         {
-            return SlotIterator(m_Slots, m_Slots + m_Capacity, m_Capacity, m_SlotsInUse);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, (Int64) m_Capacity);
         }
 
         /**
@@ -647,15 +772,8 @@ namespace Otter
          */
         SlotIterator rbegin() const noexcept
         {
-            for (UInt64 i = m_Capacity - 1; i > 0; i--)
-            {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                return SlotIterator(m_Slots, m_Slots + i, m_Capacity, m_SlotsInUse);
-            }
-
-            return SlotIterator(m_Slots, m_Slots, m_Capacity, m_SlotsInUse);
+            const Int64 index = HashControl::FindPreviousFull(m_Control, (Int64) m_Capacity - 1, m_Capacity);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, index);
         }
 
         /**
@@ -663,44 +781,37 @@ namespace Otter
          *
          * @return A reverse const iterator to the first element of the dictionary.
          */
-        OTR_INLINE SlotIterator rend() const noexcept
-        {
-            return SlotIterator(m_Slots, m_Slots, m_Capacity, m_SlotsInUse);
-        }
+        OTR_INLINE SlotIterator rend() const noexcept { return SlotIterator(m_Control, m_Slots, m_Capacity, -1); }
 
     private:
-        static constexpr Int64   k_63BitMask       = 0x7FFFFFFFFFFFFFFF;
-        static constexpr UInt64  k_MaxCollisions   = 2;
-        static constexpr UInt16  k_InitialCapacity = 3;
-        static constexpr Float16 k_ResizingFactor  = static_cast<Float16>(1.5);
-
-        Slot* m_Slots = nullptr;
-        UInt64 m_Capacity             = 0;
-        UInt64 m_Count                = 0;
-        UInt64 m_CurrentMaxCollisions = 0;
-
-        BitSet m_SlotsInUse{ };
-        BitSet m_Collisions{ };
+        static constexpr UInt16 k_InitialCapacity = 4;
+        static constexpr UInt64 k_ResizingFactor  = 2;
+        static constexpr UInt64 k_SlotAlignment   = alignof(Pair) > OTR_PLATFORM_MEMORY_ALIGNMENT
+                                                    ? alignof(Pair)
+                                                    : OTR_PLATFORM_MEMORY_ALIGNMENT;
+
+        Int8* m_Control = nullptr;
+        Pair* m_Slots   = nullptr;
+        UInt64 m_Capacity   = 0;
+        UInt64 m_Count      = 0;
+        UInt64 m_GrowthLeft = 0;
 
         /**
-         * @brief Iterator for a collection of Slots.
+         * @brief Iterator for a collection of slots.
          */
-        struct SlotIterator final
+        class SlotIterator final
         {
         public:
             /**
              * @brief Constructor.
              *
-             * @param head The head of the Slot array.
-             * @param ptr The current Slot.
-             * @param capacity The capacity of the Slot array.
-             * @param slotsInUse The BitSet of the Slots in use.
+             * @param control The control bytes of the slots.
+             * @param slots The slots.
+             * @param capacity The number of slots.
+             * @param index The index of the current slot.
              */
-            SlotIterator(Slot* head,
-                         Slot* ptr,
-                         const UInt64 capacity,
-                         const BitSet& slotsInUse) // NOLINT(*-pass-by-value)
-                : k_Head(head), k_Capacity(capacity), k_SlotsInUse(slotsInUse), m_Ptr(ptr)
+            SlotIterator(const Int8* const control, Pair* const slots, const UInt64 capacity, const Int64 index)
+                : k_Control(control), k_Slots(slots), k_Capacity((Int64) capacity), m_Index(index)
             {
             }
 
@@ -711,11 +822,7 @@ namespace Otter
              */
             OTR_INLINE SlotIterator& operator++()
             {
-                m_Ptr++;
-
-                if (!k_SlotsInUse.Get(m_Ptr - k_Head))
-                    while (m_Ptr - k_Head < k_Capacity && !k_SlotsInUse.Get(m_Ptr - k_Head))
-                        m_Ptr++;
+                m_Index = (Int64) HashControl::FindNextFull(k_Control, m_Index + 1, k_Capacity);
 
                 return *this;
             }
@@ -739,11 +846,7 @@ namespace Otter
              */
             OTR_INLINE SlotIterator& operator--()
             {
-                m_Ptr--;
-
-                if (!k_SlotsInUse.Get(m_Ptr - k_Head))
-                    while (m_Ptr != k_Head && !k_SlotsInUse.Get(m_Ptr - k_Head))
-                        m_Ptr--;
+                m_Index = HashControl::FindPreviousFull(k_Control, m_Index - 1, k_Capacity);
 
                 return *this;
             }
@@ -767,7 +870,7 @@ namespace Otter
              */
             OTR_INLINE KeyValuePair<const TKey, TValue>& operator*() const
             {
-                return reinterpret_cast<KeyValuePair<const TKey, TValue>&>(m_Ptr->Data);
+                return reinterpret_cast<KeyValuePair<const TKey, TValue>&>(k_Slots[m_Index]);
             }
 
             /**
@@ -777,7 +880,10 @@ namespace Otter
              *
              * @return True if the iterators are equal, false otherwise.
              */
-            OTR_INLINE bool operator==(const SlotIterator& other) const { return m_Ptr == other.m_Ptr; }
+            OTR_INLINE bool operator==(const SlotIterator& other) const
+            {
+                return k_Slots == other.k_Slots && m_Index == other.m_Index;
+            }
 
             /**
              * @brief Inequality operator.
@@ -789,252 +895,422 @@ namespace Otter
             OTR_INLINE bool operator!=(const SlotIterator& other) const { return !(*this == other); }
 
         private:
-            const Slot* const k_Head;
-            const UInt64 k_Capacity;
-            const BitSet k_SlotsInUse;
+            const Int8* k_Control;
+            Pair* k_Slots;
+            Int64 k_Capacity;
 
-            Slot* m_Ptr;
+            Int64 m_Index;
         };
 
         /**
-         * @brief Tries to add a key/value pair to an empty slot in the dictionary.
+         * @brief Hashes a key.
+         *
+         * @param key The key to hash.
          *
-         * @param pair The key/value pair to add.
-         * @param hash The hash of the key.
-         * @param index The index it should be added to.
+         * @return The scrambled hash of the key.
+         */
+        [[nodiscard]] OTR_INLINE static UInt64 HashKey(const TKey& key) { return HashControl::Mix(GetHashCode(key)); }
+
+        /**
+         * @brief Gets the offset of the slots from the control bytes in the allocation of a table.
          *
-         * @return True if the key/value pair was added, false otherwise.
+         * @param capacity The capacity of the table.
          *
-         * @note This function assumes that the slot is empty, so it always returns true.
+         * @return The offset of the slots.
          */
-        bool TryAddToEmptySlot(const Pair& pair, const UInt64 hash, const UInt64 index)
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetSlotsOffset(const UInt64 capacity)
         {
-            m_Slots[index].Set(pair, hash);
-            m_SlotsInUse.Set(index, true);
-            m_Collisions.Set(index, false);
-
-            m_Count++;
-
-            return true;
+            const UInt64 controlSize = HashControl::GetControlSize(capacity);
+            return OTR_ALIGNED_OFFSET(controlSize, k_SlotAlignment);
         }
 
         /**
-         * @brief Tries to add a key/value pair to a slot that already has a collision stored in it.
-         *
-         * @param pair The key/value pair to add.
-         * @param hash The hash of the key.
-         * @param index The index it should be added to.
+         * @brief Gets the size of the allocation of a table.
          *
-         * @return True if the key/value pair was added, false otherwise.
+         * @param capacity The capacity of the table.
          *
-         * @note This function assumes that the slot has a collision stored in it, so it always returns true. This is
-         * a destructive operation, so the collision stored in the slot will be overwritten.
-         * @note The function finds the original slot that the key/value pair in the collision slot collides with.
-         * It then removes the collision from the linked list. The new key/value pair is then added to the collision
-         * slot (which is now empty) and re-adds the original collision to the dictionary.
+         * @return The size of the allocation.
          */
-        bool TryAddToCollisionSlot(const Pair& pair, const UInt64 hash, const UInt64 index)
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetAllocationSize(const UInt64 capacity)
         {
-            auto collisionData = m_Slots[index].Data;
-            auto* slot = &m_Slots[m_Slots[index].Hash % m_Capacity];
-
-            while (slot->Next && slot->Next != &m_Slots[index])
-                slot = slot->Next;
-
-            if (slot->Next)
-                slot->Next = slot->Next->Next;
-
-            m_Slots[index].Set(pair, hash);
-            m_SlotsInUse.Set(index, true);
-            m_Collisions.Set(index, false);
-
-            return TryAdd(collisionData.Key, collisionData.Value);
+            return GetSlotsOffset(capacity) + capacity * sizeof(Pair);
         }
 
         /**
-         * @brief Tries to add a collision to the dictionary.
+         * @brief Tries to add a key/value pair to the dictionary, with the hash of its key already computed.
          *
-         * @param pair The collision to add.
-         * @param collisionIndex The index of the collision.
-         * @param hash The hash of the collision.
+         * @param key The key of the pair.
+         * @param value The value of the pair.
+         * @param hash The scrambled hash of the key.
          *
-         * @return True if the collision was added, false otherwise.
+         * @return True if the pair was added, false otherwise.
          */
-        bool TryAddNewCollision(const Pair& pair, const UInt64 collisionIndex, const UInt64 hash)
+        bool TryAddWithHash(const TKey& key, const TValue& value, const UInt64 hash)
         {
-            auto* slot = &m_Slots[collisionIndex];
-            auto collisionCount = 0;
-
-            while (slot)
+            UInt64 index;
+            if (!IsEmpty() && Find(key, hash, &index))
             {
-                collisionCount++;
-
-                if (HasItemStoredAt(slot - m_Slots) && slot->Matches(pair, hash))
-                    return false;
+                m_Slots[index].Value = value;
+                return true;
+            }
 
-                if (!slot->Next)
-                    break;
+            index = PrepareInsert(hash);
+            new(&m_Slots[index]) Pair(key, value);
 
-                slot = slot->Next;
-            }
+            return true;
+        }
 
-            if (collisionCount > m_CurrentMaxCollisions)
-                m_CurrentMaxCollisions = collisionCount;
+        /**
+         * @brief Tries to add a range of key/value pairs to the dictionary. Room for all of them is reserved up front,
+         * and the keys are hashed in batches, so that the first group of each key's probe sequence is already being
+         * fetched while the previous keys are placed.
+         *
+         * @param pairs The pairs to add.
+         * @param count The number of pairs.
+         *
+         * @return True if the pairs were added, false otherwise.
+         */
+        bool TryAddRangeInternal(const Pair* const pairs, const UInt64 count)
+        {
+            if (!pairs || count == 0)
+                return false;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
-            {
-                if (HasItemStoredAt(i))
-                    continue;
+            Reserve(m_Count + count);
 
-                m_Slots[i].Set(pair, hash);
-                m_SlotsInUse.Set(i, true);
-                m_Collisions.Set(i, true);
+            constexpr UInt64 k_BatchSize = 16;
+            UInt64           hashes[k_BatchSize];
 
-                slot->Next = &m_Slots[i];
+            for (UInt64 start = 0; start < count; start += k_BatchSize)
+            {
+                const UInt64 batchSize = count - start < k_BatchSize ? count - start : k_BatchSize;
 
-                m_Count++;
+                for (UInt64 i = 0; i < batchSize; i++)
+                {
+                    hashes[i] = HashKey(pairs[start + i].Key);
+                    OTR_PREFETCH(m_Control + GetFirstGroupOffset(hashes[i]));
+                }
 
-                return true;
+                for (UInt64 i = 0; i < batchSize; i++)
+                    TryAddWithHash(pairs[start + i].Key, pairs[start + i].Value, hashes[i]);
             }
 
-            return false;
+            return true;
         }
 
         /**
-         * @brief Checks whether a slot has a key/value pair stored in it.
+         * @brief Gets the index of the first slot of the group where the probe sequence of a hash starts.
          *
-         * @param index The index of the slot.
+         * @param hash The scrambled hash.
          *
-         * @return True if the slot has a key/value pair stored in it, false otherwise.
+         * @return The index of the slot.
          */
-        [[nodiscard]] bool HasItemStoredAt(const UInt64 index) const { return m_SlotsInUse.Get(index); }
+        [[nodiscard]] OTR_INLINE UInt64 GetFirstGroupOffset(const UInt64 hash) const
+        {
+            return HashProbe(HashControl::GetH1(hash), HashControl::GetGroupCount(m_Capacity)).GetOffset();
+        }
 
         /**
-         * @brief Checks whether a slot has a collision stored in it.
+         * @brief Checks a key's presence in the dictionary.
          *
-         * @param index The index of the slot.
+         * @param key The key to find.
+         * @param outIndex The index of the key.
+         *
+         * @return True if the key was found, false otherwise.
          *
-         * @return True if the slot has a collision stored in it, false otherwise.
+         * @note It assumes the dictionary is not empty.
          */
-        [[nodiscard]] bool HasCollisionStoredAt(const UInt64 index) const { return m_Collisions.Get(index); }
+        bool Find(const TKey& key, UInt64* outIndex) const { return Find(key, HashKey(key), outIndex); }
 
         /**
-         * @brief Checks an key's presence in the dictionary.
+         * @brief Checks a key's presence in the dictionary.
          *
-         * @param key The key to get the index of.
+         * @param key The key to find.
+         * @param hash The scrambled hash of the key.
          * @param outIndex The index of the key.
          *
          * @return True if the key was found, false otherwise.
          *
          * @note It assumes the dictionary is not empty.
          */
-        bool Exists(const TKey& key, UInt64* outIndex = nullptr) const
+        bool Find(const TKey& key, const UInt64 hash, UInt64* outIndex) const
         {
-            UInt64 hash  = GetHashCode(key) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
-
-            if (!HasItemStoredAt(index))
-                return false;
+            const Int8   h2         = HashControl::GetH2(hash);
+            const UInt64 groupCount = HashControl::GetGroupCount(m_Capacity);
+            const UInt32 groupMask  = HashControl::GetGroupMask(m_Capacity);
 
-            auto* slot = &m_Slots[index];
+            HashProbe probe(HashControl::GetH1(hash), groupCount);
 
-            while (HasItemStoredAt(slot - m_Slots) && !slot->MatchesKey(key, hash))
+            for (UInt64 i = 0; i < groupCount; i++)
             {
-                if (!slot->Next)
+                const UInt64    offset = probe.GetOffset();
+                const HashGroup group(m_Control + offset);
+
+                for (UInt32 match = group.Match(h2) & groupMask; match != 0; match &= match - 1)
+                {
+                    const UInt64 index = offset + std::countr_zero(match);
+
+                    if (m_Slots[index].Key == key)
+                    {
+                        *outIndex = index;
+                        return true;
+                    }
+                }
+
+                if ((group.MatchEmpty() & groupMask) != 0)
                     return false;
 
-                slot = slot->Next;
+                probe.Next();
             }
 
-            if (outIndex)
-                *outIndex = slot - m_Slots;
+            return false;
+        }
 
-            return true;
+        /**
+         * @brief Finds the first slot along the probe sequence of a hash that does not hold an item.
+         *
+         * @param hash The scrambled hash.
+         *
+         * @return The index of the slot.
+         *
+         * @note It assumes that the table has at least one slot that does not hold an item.
+         */
+        [[nodiscard]] UInt64 FindFirstAvailable(const UInt64 hash) const
+        {
+            const UInt64 groupCount = HashControl::GetGroupCount(m_Capacity);
+            const UInt32 groupMask  = HashControl::GetGroupMask(m_Capacity);
+
+            HashProbe probe(HashControl::GetH1(hash), groupCount);
+
+            while (true)
+            {
+                const UInt64 offset = probe.GetOffset();
+                const UInt32 match  = HashGroup(m_Control + offset).MatchEmptyOrDeleted() & groupMask;
+
+                if (match != 0)
+                    return offset + std::countr_zero(match);
+
+                probe.Next();
+            }
         }
 
         /**
-         * @brief Used to expand the size of the dictionary.
+         * @brief Claims a slot for a new key/value pair, growing or rehashing the dictionary if it is out of room.
+         *
+         * @param hash The scrambled hash of the key.
          *
-         * @param amount The amount to expand the dictionary by.
+         * @return The index of the slot. The slot is marked as full, but the pair still has to be constructed in it.
          */
-        void Expand(const UInt64 amount = 0)
+        UInt64 PrepareInsert(const UInt64 hash)
         {
-            UInt64 newCapacity = CalculateExpandCapacity(amount);
+            if (m_Capacity == 0)
+                CreateEmpty(k_InitialCapacity);
 
-            if (IsEmpty())
+            UInt64 index = FindFirstAvailable(hash);
+
+            if (m_GrowthLeft == 0 && m_Control[index] == HashControl::k_Empty)
             {
-                RecreateEmpty(newCapacity);
-                return;
+                // Reclaim the deleted slots if they make up a large part of the table, otherwise grow
+                if (m_Count <= HashControl::GetGrowthLimit(m_Capacity) / 2)
+                    RehashInPlace();
+                else
+                    Resize(m_Capacity * k_ResizingFactor);
+
+                index = FindFirstAvailable(hash);
             }
 
-            Dictionary<TKey, TValue> newDictionary;
-            newDictionary.RecreateEmpty(newCapacity);
+            if (m_Control[index] == HashControl::k_Empty)
+                m_GrowthLeft--;
 
+            m_Control[index] = HashControl::GetH2(hash);
+            m_Count++;
+
+            return index;
+        }
+
+        /**
+         * @brief Removes the key/value pair stored in a slot.
+         *
+         * @param index The index of the slot.
+         */
+        void EraseAt(const UInt64 index)
+        {
+            m_Slots[index].~Pair();
+            m_Count--;
+
+            // A lookup only probes past a group that has no empty slots, so if the group of the slot still has one,
+            // no lookup can have passed through it and the slot can become empty again instead of deleted
+            const UInt64 offset = index & ~(HashControl::k_GroupSize - 1);
+
+            if (HashControl::GetGroupCount(m_Capacity) == 1
+                || (HashGroup(m_Control + offset).MatchEmpty() & HashControl::GetGroupMask(m_Capacity)) != 0)
+            {
+                m_Control[index] = HashControl::k_Empty;
+                m_GrowthLeft++;
+            }
+            else
+            {
+                m_Control[index] = HashControl::k_Deleted;
+            }
+        }
+
+        /**
+         * @brief Moves every key/value pair to a new table with a given capacity.
+         *
+         * @param capacity The capacity of the new table. Must be a power of two.
+         */
+        void Resize(const UInt64 capacity)
+        {
+            Int8* const  oldControl  = m_Control;
+            Pair* const  oldSlots    = m_Slots;
+            const UInt64 oldCapacity = m_Capacity;
+            const UInt64 count       = m_Count;
+
+            CreateEmpty(capacity);
+
+            for (UInt64 i = HashControl::FindNextFull(oldControl, 0, oldCapacity);
+                 i < oldCapacity;
+                 i = HashControl::FindNextFull(oldControl, i + 1, oldCapacity))
+            {
+                const UInt64 hash  = HashKey(oldSlots[i].Key);
+                const UInt64 index = FindFirstAvailable(hash);
+
+                m_Control[index] = HashControl::GetH2(hash);
+                new(&m_Slots[index]) Pair(std::move(oldSlots[i]));
+                oldSlots[i].~Pair();
+            }
+
+            m_Count = count;
+            m_GrowthLeft -= count;
+
+            if (oldControl)
+                MemorySystem::Free(oldControl, GetAllocationSize(oldCapacity), MemoryTag::Collections);
+        }
+
+        /**
+         * @brief Rehashes the dictionary without growing it, which turns every deleted slot back into an empty one.
+         */
+        void RehashInPlace()
+        {
+            // Mark every full slot as deleted and every deleted slot as empty, then move each pair still marked as
+            // deleted to the first slot available along its probe sequence
             for (UInt64 i = 0; i < m_Capacity; i++)
+                m_Control[i] = HashControl::IsFull(m_Control[i]) ? HashControl::k_Deleted : HashControl::k_Empty;
+
+            UInt64 i = 0;
+            while (i < m_Capacity)
             {
-                if (!HasItemStoredAt(i))
+                if (m_Control[i] != HashControl::k_Deleted)
+                {
+                    i++;
                     continue;
+                }
 
-                newDictionary.TryAdd(m_Slots[i].Data.Key, m_Slots[i].Data.Value);
-            }
+                const UInt64 hash   = HashKey(m_Slots[i].Key);
+                const Int8   h2     = HashControl::GetH2(hash);
+                const UInt64 target = FindFirstAvailable(hash);
 
-            if (IsCreated())
-                Destroy();
+                // The pair is already in the first group that its probe sequence reaches with room for it
+                if (target / HashControl::k_GroupSize == i / HashControl::k_GroupSize)
+                {
+                    m_Control[i] = h2;
+                    i++;
+                    continue;
+                }
 
-            m_Slots = Buffer::New<Slot>
-                (newCapacity);
+                if (m_Control[target] == HashControl::k_Empty)
+                {
+                    new(&m_Slots[target]) Pair(std::move(m_Slots[i]));
+                    m_Slots[i].~Pair();
 
-            for (UInt64 i = 0; i < newCapacity; i++)
-                if (newDictionary.HasItemStoredAt(i))
-                    m_Slots[i] = std::move(newDictionary.m_Slots[i]);
+                    m_Control[target] = h2;
+                    m_Control[i]      = HashControl::k_Empty;
+                    i++;
+                    continue;
+                }
 
-            m_Capacity             = newDictionary.m_Capacity;
-            m_CurrentMaxCollisions = newDictionary.m_CurrentMaxCollisions;
+                // The target holds a pair that has not been placed yet, so swap them and place that pair next
+                Pair temp(std::move(m_Slots[target]));
+                m_Slots[target] = std::move(m_Slots[i]);
+                m_Slots[i]      = std::move(temp);
+
+                m_Control[target] = h2;
+            }
 
-            m_SlotsInUse = std::move(newDictionary.m_SlotsInUse);
-            m_Collisions = std::move(newDictionary.m_Collisions);
+            m_GrowthLeft = HashControl::GetGrowthLimit(m_Capacity) - m_Count;
         }
 
         /**
-         * @brief Recreates the dictionary with a given capacity. Deletes any existing data.
+         * @brief Creates an empty table with a given capacity.
          *
-         * @param capacity The capacity to recreate the dictionary with.
+         * @param capacity The capacity of the table. Must be a power of two.
+         *
+         * @note No checks are performed to see if the dictionary has been created. Any existing table is not freed.
          */
-        void RecreateEmpty(const UInt64 capacity)
+        void CreateEmpty(const UInt64 capacity)
         {
-            if (IsCreated())
-                Destroy();
-
-            m_Slots    = capacity > 0 ? Buffer::New<Slot>(capacity) : nullptr;
+            auto* const block = (Byte*) MemorySystem::Allocate(GetAllocationSize(capacity),
+                                                               (UInt16) k_SlotAlignment,
+                                                               AllocationFlags::Uninitialised,
+                                                               MemoryTag::Collections).Pointer;
+            OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Failed to allocate memory for the dictionary table")
+
+            m_Control  = (Int8*) block;
+            m_Slots    = (Pair*) (block + GetSlotsOffset(capacity));
             m_Capacity = capacity;
             m_Count    = 0;
 
-            if (capacity == 0)
-                return;
+            ResetControl();
+        }
 
-            m_SlotsInUse.Reserve(capacity);
-            m_Collisions.Reserve(capacity);
+        /**
+         * @brief Marks every slot of the table as empty.
+         */
+        void ResetControl()
+        {
+            std::memset(m_Control, (UInt8) HashControl::k_Empty, HashControl::GetControlSize(m_Capacity));
+            m_GrowthLeft = HashControl::GetGrowthLimit(m_Capacity);
         }
 
         /**
-         * @brief Calculates the new capacity when expanding the dictionary.
+         * @brief Copies the table of another dictionary, keeping every key/value pair in the same slot.
          *
-         * @param expandAmount The amount to expand the dictionary by.
+         * @param other The dictionary to copy.
          *
-         * @return The new capacity.
+         * @note No checks are performed to see if the dictionary has been created.
          */
-        [[nodiscard]] UInt64 CalculateExpandCapacity(const UInt64 expandAmount) const
+        void CopyFrom(const Dictionary<TKey, TValue>& other)
         {
-            UInt64 newCapacity;
+            m_Control    = nullptr;
+            m_Slots      = nullptr;
+            m_Capacity   = 0;
+            m_Count      = 0;
+            m_GrowthLeft = 0;
 
-            if (expandAmount == 0)
-                newCapacity = m_Capacity == 0
-                              ? k_InitialCapacity
-                              : HashUtils::GetNextPrime(m_Capacity * k_ResizingFactor);
-            else
-                newCapacity = HashUtils::GetNextPrime(m_Capacity + expandAmount);
+            if (!other.IsCreated())
+                return;
+
+            CreateEmpty(other.m_Capacity);
+            std::memcpy(m_Control, other.m_Control, HashControl::GetControlSize(m_Capacity));
+
+            for (UInt64 i = 0; i < m_Capacity; i++)
+                if (HashControl::IsFull(m_Control[i]))
+                    new(&m_Slots[i]) Pair(other.m_Slots[i]);
+
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
+        }
+
+        /**
+         * @brief Destroys every key/value pair in the dictionary, without touching the control bytes.
+         */
+        void DestroyItems()
+        {
+            if constexpr (std::is_trivially_destructible_v<Pair>)
+                return;
 
-            return newCapacity;
+            for (UInt64 i = 0; i < m_Capacity; i++)
+                if (HashControl::IsFull(m_Control[i]))
+                    m_Slots[i].~Pair();
         }
 
         /**
@@ -1044,13 +1320,21 @@ namespace Otter
          */
         void Destroy()
         {
-            Buffer::Delete<Slot>(m_Slots, m_Capacity);
-            m_Slots = nullptr;
+            DestroyItems();
+            MemorySystem::Free(m_Control, GetAllocationSize(m_Capacity), MemoryTag::Collections);
 
-            m_SlotsInUse.ClearDestructive();
-            m_Collisions.ClearDestructive();
+            m_Control = nullptr;
+            m_Slots   = nullptr;
         }
     };
+
+    /**
+     * @brief The control bytes and slots of a dictionary live on the heap, so it can be moved bytewise.
+     */
+    template<typename TKey, typename TValue>
+    struct IsTriviallyRelocatable<Dictionary<TKey, TValue>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_DICTIONARY_H
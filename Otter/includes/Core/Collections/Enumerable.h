@@ -36,7 +36,7 @@ namespace Otter
                 return;
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Count);
+                Buffer::Delete<T>(m_Data, m_Count, MemoryTag::Collections);
         }
 
         /**
@@ -81,7 +81,7 @@ namespace Otter
             if (list.size() == 0)
                 return enumerable;
 
-            enumerable.m_Data     = Buffer::New < T > (list.size());
+            enumerable.m_Data     = Buffer::New < T > (list.size(), MemoryTag::Collections);
             enumerable.m_Count    = 0;
             enumerable.m_OwnsData = true;
 
@@ -108,7 +108,7 @@ namespace Otter
             if (enumerable.m_Count == 0)
                 return enumerable;
 
-            enumerable.m_Data = Buffer::New < T > (enumerable.m_Count);
+            enumerable.m_Data = Buffer::New < T > (enumerable.m_Count, MemoryTag::Collections);
             MemorySystem::MemoryCopy(enumerable.m_Data, data, enumerable.m_Count * sizeof(T));
 
             enumerable.m_OwnsData = true;
@@ -143,7 +143,7 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated() && OwnsData())
-                Buffer::Delete<T>(m_Data, m_Count);
+                Buffer::Delete<T>(m_Data, m_Count, MemoryTag::Collections);
 
             m_Data  = nullptr;
             m_Count = 0;
@@ -1,10 +1,13 @@
 #ifndef OTTERENGINE_HASHSET_H
 #define OTTERENGINE_HASHSET_H
 
+#include <cstring>
+#include <new>
+
+#include "Core/Memory.h"
 #include "Core/Function.h"
-#include "Core/Collections/BitSet.h"
-#include "Core/Collections/Utils/HashSlot.h"
-#include "Core/Collections/Utils/HashUtils.h"
+#include "Core/Collections/Collection.h"
+#include "Core/Collections/Utils/HashControl.h"
 
 #if !OTR_RUNTIME
 #include "Core/Collections/ReadOnly/ReadOnlySpan.h"
@@ -14,21 +17,27 @@ namespace Otter
 {
     /**
      * @brief A collection of unique items that are stored in a contiguous block of memory and can be accessed by
-     * their hash. The capacity of the hashset is automatically expanded to the next prime when the item count
-     * reaches the capacity in order to maintain a low collision rate.
+     * their hash. The hashset uses open addressing: every slot has a control byte holding part of the hash of its
+     * item, and a lookup matches a whole group of control bytes at once before comparing any items. The capacity is
+     * always a power of two and is doubled when the hashset becomes 7/8 full.
      *
      * @tparam T The type of the items in the hashset.
+     *
+     * @note The order of the items is unspecified and can change whenever the hashset is modified.
      */
     template<typename T>
     class HashSet final
     {
-        /// @brief Alias for HashUtils.
-        using HashUtils = Internal::HashUtils;
+        /// @brief Alias for HashControl.
+        using HashControl = Internal::HashControl;
 
-        /// @brief Alias for a slot.
-        using Slot = Slot<T>;
+        /// @brief Alias for HashGroup.
+        using HashGroup = Internal::HashGroup;
 
-        /// @brief Iterator for a collection of Slots.
+        /// @brief Alias for HashProbe.
+        using HashProbe = Internal::HashProbe;
+
+        /// @brief Iterator for a collection of slots.
         class SlotIterator;
 
     public:
@@ -54,13 +63,7 @@ namespace Otter
         HashSet(InitialiserList<T> list)
             : HashSet()
         {
-            m_Capacity             = k_InitialCapacity;
-            m_Slots                = Buffer::New<Slot>(m_Capacity);
-            m_Count                = 0;
-            m_CurrentMaxCollisions = 0;
-
-            for (const T& item: list)
-                TryAdd(item);
+            TryAddRangeInternal(list.begin(), list.size());
         }
 
         /**
@@ -70,20 +73,7 @@ namespace Otter
          */
         HashSet(const HashSet<T>& other)
         {
-            m_Capacity             = other.m_Capacity;
-            m_Count                = other.m_Count;
-            m_CurrentMaxCollisions = other.m_CurrentMaxCollisions;
-            m_SlotsInUse           = other.m_SlotsInUse;
-            m_Collisions           = other.m_Collisions;
-
-            if (m_Capacity == 0)
-                return;
-
-            m_Slots = Buffer::New<Slot>(m_Capacity);
-
-            if (m_Count > 0)
-                for (UInt64 i = 0; i < m_Capacity; i++)
-                    m_Slots[i] = other.m_Slots[i];
+            CopyFrom(other);
         }
 
         /**
@@ -93,17 +83,17 @@ namespace Otter
          */
         HashSet(HashSet<T>&& other) noexcept
         {
-            m_Slots                = std::move(other.m_Slots);
-            m_Capacity             = std::move(other.m_Capacity);
-            m_Count                = std::move(other.m_Count);
-            m_CurrentMaxCollisions = std::move(other.m_CurrentMaxCollisions);
-            m_SlotsInUse           = std::move(other.m_SlotsInUse);
-            m_Collisions           = std::move(other.m_Collisions);
-
-            other.m_Slots                = nullptr;
-            other.m_Capacity             = 0;
-            other.m_Count                = 0;
-            other.m_CurrentMaxCollisions = 0;
+            m_Control    = other.m_Control;
+            m_Slots      = other.m_Slots;
+            m_Capacity   = other.m_Capacity;
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
+
+            other.m_Control    = nullptr;
+            other.m_Slots      = nullptr;
+            other.m_Capacity   = 0;
+            other.m_Count      = 0;
+            other.m_GrowthLeft = 0;
         }
 
         /**
@@ -121,20 +111,7 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Capacity             = other.m_Capacity;
-            m_Count                = other.m_Count;
-            m_CurrentMaxCollisions = other.m_CurrentMaxCollisions;
-            m_SlotsInUse           = other.m_SlotsInUse;
-            m_Collisions           = other.m_Collisions;
-
-            if (m_Capacity == 0)
-                return *this;
-
-            m_Slots = Buffer::New<Slot>(m_Capacity);
-
-            if (m_Count > 0)
-                for (UInt64 i = 0; i < m_Capacity; i++)
-                    m_Slots[i] = other.m_Slots[i];
+            CopyFrom(other);
 
             return *this;
         }
@@ -154,17 +131,17 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Slots                = std::move(other.m_Slots);
-            m_Capacity             = std::move(other.m_Capacity);
-            m_Count                = std::move(other.m_Count);
-            m_CurrentMaxCollisions = std::move(other.m_CurrentMaxCollisions);
-            m_SlotsInUse           = std::move(other.m_SlotsInUse);
-            m_Collisions           = std::move(other.m_Collisions);
+            m_Control    = other.m_Control;
+            m_Slots      = other.m_Slots;
+            m_Capacity   = other.m_Capacity;
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
 
-            other.m_Slots                = nullptr;
-            other.m_Capacity             = 0;
-            other.m_Count                = 0;
-            other.m_CurrentMaxCollisions = 0;
+            other.m_Control    = nullptr;
+            other.m_Slots      = nullptr;
+            other.m_Capacity   = 0;
+            other.m_Count      = 0;
+            other.m_GrowthLeft = 0;
 
             return *this;
         }
@@ -174,16 +151,21 @@ namespace Otter
          *
          * @param other The other hashset.
          *
-         * @return True if the hashsets are equal, false otherwise.
+         * @return True if the hashsets hold the same items, false otherwise.
          */
         bool operator==(const HashSet<T>& other) const noexcept
         {
             if (m_Count != other.m_Count)
                 return false;
 
-            for (UInt64 i = 0; i < m_Capacity; ++i)
-                if (m_Slots[i] != other.m_Slots[i])
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
+            {
+                UInt64 index;
+                if (!other.Find(m_Slots[i], &index))
                     return false;
+            }
 
             return true;
         }
@@ -193,7 +175,7 @@ namespace Otter
          *
          * @param other The other hashset.
          *
-         * @return True if the hashsets are not equal, false otherwise.
+         * @return True if the hashsets do not hold the same items, false otherwise.
          */
         bool operator!=(const HashSet<T>& other) const noexcept { return !(*this == other); }
 
@@ -202,26 +184,11 @@ namespace Otter
          *
          * @param item The item to add.
          *
-         * @return True if the item was added, false otherwise.
+         * @return True if the item was added, false if it was already in the hashset.
          */
         bool TryAdd(const T& item)
         {
-            if (m_Count >= m_Capacity || m_CurrentMaxCollisions >= k_MaxCollisions)
-                Expand();
-
-            UInt64 hash  = GetHashCode(item) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
-
-            if (!HasItemStoredAt(index))
-                return TryAddToEmptySlot(item, hash, index);
-
-            if (m_Slots[index].Matches(item, hash))
-                return false;
-
-            if (HasCollisionStoredAt(index))
-                return TryAddToCollisionSlot(item, hash, index);
-
-            return TryAddNewCollision(item, index, hash);
+            return TryAddWithHash(item, HashItem(item));
         }
 
         /**
@@ -229,26 +196,20 @@ namespace Otter
          *
          * @param item The item to add.
          *
-         * @return True if the item was added, false otherwise.
+         * @return True if the item was added, false if it was already in the hashset.
          */
         bool TryAdd(T&& item) noexcept
         {
-            if (m_Count >= m_Capacity || m_CurrentMaxCollisions >= k_MaxCollisions)
-                Expand();
-
-            UInt64 hash  = GetHashCode(item) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
+            const UInt64 hash = HashItem(item);
 
-            if (!HasItemStoredAt(index))
-                return TryAddToEmptySlot(std::move(item), hash, index);
-
-            if (m_Slots[index].Matches(item, hash))
+            UInt64 index;
+            if (!IsEmpty() && Find(item, hash, &index))
                 return false;
 
-            if (HasCollisionStoredAt(index))
-                return TryAddToCollisionSlot(std::move(item), hash, index);
+            index = PrepareInsert(hash);
+            new(&m_Slots[index]) T(std::move(item));
 
-            return TryAddNewCollision(std::move(item), index, hash);
+            return true;
         }
 
         /**
@@ -264,24 +225,10 @@ namespace Otter
                 return false;
 
             UInt64 index;
-            if (!Exists(item, &index))
+            if (!Find(item, &index))
                 return false;
 
-            if (m_Slots[index].Next)
-            {
-                if constexpr (std::is_move_assignable_v<T>)
-                    m_Slots[index].Data = std::move(m_Slots[index].Next->Data);
-                else
-                    m_Slots[index].Data = m_Slots[index].Next->Data;
-
-                m_Slots[index].Hash = m_Slots[index].Next->Hash;
-                m_Slots[index].Next = m_Slots[index].Next->Next;
-            }
-
-            m_SlotsInUse.Set(index, false);
-            m_Collisions.Set(index, false);
-
-            m_Count--;
+            EraseAt(index);
 
             return true;
         }
@@ -298,7 +245,8 @@ namespace Otter
             if (IsEmpty())
                 return false;
 
-            return Exists(item);
+            UInt64 index;
+            return Find(item, &index);
         }
 
         /**
@@ -316,7 +264,7 @@ namespace Otter
             if (IsEmpty())
                 return false;
 
-            return Exists(item, outIndex);
+            return Find(item, outIndex);
         }
 
         /**
@@ -329,32 +277,85 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 i = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+                 i < m_Capacity;
+                 i = HashControl::FindNextFull(m_Control, i + 1, m_Capacity))
             {
-                if (!HasItemStoredAt(i))
-                    continue;
+                callback(m_Slots[i]);
+            }
+        }
+
+        /**
+         * @brief Tries to add a range of items to the hashset.
+         *
+         * @param items The items to add.
+         *
+         * @return True if every item was added, false if any of them was already in the hashset.
+         */
+        bool TryAddRange(InitialiserList<T> items)
+        {
+            return TryAddRangeInternal(items.begin(), items.size());
+        }
+
+        /**
+         * @brief Tries to add a collection of items to the hashset.
+         *
+         * @param items The items to add.
+         *
+         * @return True if every item was added, false if any of them was already in the hashset.
+         */
+        bool TryAddRange(const Collection<T>& items)
+        {
+            return TryAddRangeInternal(items.GetData(), items.GetCount());
+        }
+
+        /**
+         * @brief Reserves room for a given number of items, so that they can be added without growing.
+         *
+         * @param count The number of items to make room for, including the ones already in the hashset.
+         */
+        void Reserve(const UInt64 count)
+        {
+            if (m_Capacity > 0 && (count <= m_Count || m_GrowthLeft >= count - m_Count))
+                return;
+
+            const UInt64 newCapacity = HashControl::GetCapacityFor(count,
+                                                                   m_Capacity > 0 ? m_Capacity : k_InitialCapacity);
+
+            if (IsEmpty())
+            {
+                if (IsCreated())
+                    Destroy();
 
-                callback(m_Slots[i].Data);
+                CreateEmpty(newCapacity);
+                return;
             }
+
+            Resize(newCapacity);
         }
 
         /**
          * @brief Ensures that the hashset has a given capacity.
          *
-         * @param capacity The capacity to ensure.
+         * @param capacity The capacity to ensure. It is rounded up to the next power of two.
          */
         void EnsureCapacity(const UInt64 capacity)
         {
             if (capacity <= m_Capacity)
                 return;
 
+            const UInt64 newCapacity = std::bit_ceil(capacity < k_InitialCapacity ? k_InitialCapacity : capacity);
+
             if (IsEmpty())
             {
-                RecreateEmpty(HashUtils::GetNextPrime(capacity));
+                if (IsCreated())
+                    Destroy();
+
+                CreateEmpty(newCapacity);
                 return;
             }
 
-            Expand(capacity - m_Capacity);
+            Resize(newCapacity);
         }
 
         /**
@@ -365,8 +366,8 @@ namespace Otter
             if (IsEmpty())
                 return;
 
-            m_SlotsInUse.Clear();
-            m_Collisions.Clear();
+            DestroyItems();
+            ResetControl();
 
             m_Count = 0;
         }
@@ -379,9 +380,11 @@ namespace Otter
             if (IsCreated())
                 Destroy();
 
-            m_Slots    = nullptr;
-            m_Capacity = 0;
-            m_Count    = 0;
+            m_Control    = nullptr;
+            m_Slots      = nullptr;
+            m_Capacity   = 0;
+            m_Count      = 0;
+            m_GrowthLeft = 0;
         }
 
 #if !OTR_RUNTIME
@@ -392,23 +395,20 @@ namespace Otter
          *
          * @return The memory footprint of the hashset.
          */
-        [[nodiscard]] ReadOnlySpan<MemoryFootprint, 3> GetMemoryFootprint(const char* const debugName) const
+        [[nodiscard]] ReadOnlySpan<MemoryFootprint, 1> GetMemoryFootprint(const char* const debugName) const
         {
             MemoryFootprint footprint = { };
             MemorySystem::CheckMemoryFootprint([&]()
                                                {
                                                    MemoryDebugPair pair[1];
-                                                   pair[0] = { debugName, m_Slots };
+                                                   pair[0] = { debugName, m_Control };
 
                                                    return MemoryDebugHandle{ pair, 1 };
                                                },
                                                &footprint,
                                                nullptr);
 
-            auto slotsInUseFootprint = m_SlotsInUse.GetMemoryFootprint(OTR_NAME_OF(BitSet));
-            auto collisionsFootprint = m_Collisions.GetMemoryFootprint(OTR_NAME_OF(BitSet));
-
-            return ReadOnlySpan<MemoryFootprint, 3>{ footprint, slotsInUseFootprint[0], collisionsFootprint[0] };
+            return ReadOnlySpan<MemoryFootprint, 1>{ footprint };
         }
 #endif
 
@@ -441,7 +441,7 @@ namespace Otter
          *
          * @return The resizing factor of the hashset.
          */
-        [[nodiscard]] OTR_INLINE static constexpr Float16 GetResizingFactor() noexcept { return k_ResizingFactor; }
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetResizingFactor() noexcept { return k_ResizingFactor; }
 
         /**
          * @brief Checks whether the hashset has been created. A hashset is created when it has been initialised
@@ -449,7 +449,7 @@ namespace Otter
          *
          * @return True if the hashset has been created, false otherwise.
          */
-        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Slots && m_Capacity > 0; }
+        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Control && m_Capacity > 0; }
 
         /**
          * @brief Checks whether the hashset is empty.
@@ -465,15 +465,8 @@ namespace Otter
          */
         SlotIterator begin() const noexcept
         {
-            for (UInt64 i = 0; i < m_Capacity; i++)
-            {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                return SlotIterator(m_Slots, m_Slots + i, m_Capacity, m_SlotsInUse);
-            }
-
-            return SlotIterator(m_Slots, m_Slots + m_Capacity, m_Capacity, m_SlotsInUse);
+            const UInt64 index = HashControl::FindNextFull(m_Control, 0, m_Capacity);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, (Int64) index);
         }
 
         /**
@@ -483,7 +476,7 @@ namespace Otter
          */
         OTR_INLINE SlotIterator end() const noexcept
         {
-            return SlotIterator(m_Slots, m_Slots + m_Capacity, m_Capacity, m_SlotsInUse);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, (Int64) m_Capacity);
         }
 
         /**
@@ -493,15 +486,8 @@ namespace Otter
          */
         SlotIterator rbegin() const noexcept
         {
-            for (UInt64 i = m_Capacity - 1; i > 0; i--)
-            {
-                if (!HasItemStoredAt(i))
-                    continue;
-
-                return SlotIterator(m_Slots, m_Slots + i, m_Capacity, m_SlotsInUse);
-            }
-
-            return SlotIterator(m_Slots, m_Slots, m_Capacity, m_SlotsInUse);
+            const Int64 index = HashControl::FindPreviousFull(m_Control, (Int64) m_Capacity - 1, m_Capacity);
+            return SlotIterator(m_Control, m_Slots, m_Capacity, index);
         }
 
         /**
@@ -509,44 +495,37 @@ namespace Otter
          *
          * @return A reverse const iterator to the first element of the hash set.
          */
-        OTR_INLINE SlotIterator rend() const noexcept
-        {
-            return SlotIterator(m_Slots, m_Slots, m_Capacity, m_SlotsInUse);
-        }
+        OTR_INLINE SlotIterator rend() const noexcept { return SlotIterator(m_Control, m_Slots, m_Capacity, -1); }
 
     private:
-        static constexpr Int64   k_63BitMask       = 0x7FFFFFFFFFFFFFFF;
-        static constexpr UInt64  k_MaxCollisions   = 2;
-        static constexpr UInt16  k_InitialCapacity = 3;
-        static constexpr Float16 k_ResizingFactor  = static_cast<Float16>(1.5);
-
-        Slot* m_Slots = nullptr;
-        UInt64 m_Capacity             = 0;
-        UInt64 m_Count                = 0;
-        UInt64 m_CurrentMaxCollisions = 0;
-
-        BitSet m_SlotsInUse{ };
-        BitSet m_Collisions{ };
+        static constexpr UInt16 k_InitialCapacity = 4;
+        static constexpr UInt64 k_ResizingFactor  = 2;
+        static constexpr UInt64 k_SlotAlignment   = alignof(T) > OTR_PLATFORM_MEMORY_ALIGNMENT
+                                                    ? alignof(T)
+                                                    : OTR_PLATFORM_MEMORY_ALIGNMENT;
+
+        Int8* m_Control = nullptr;
+        T* m_Slots   = nullptr;
+        UInt64 m_Capacity   = 0;
+        UInt64 m_Count      = 0;
+        UInt64 m_GrowthLeft = 0;
 
         /**
-         * @brief Iterator for a collection of Slots.
+         * @brief Iterator for a collection of slots.
          */
-        struct SlotIterator final
+        class SlotIterator final
         {
         public:
             /**
              * @brief Constructor.
              *
-             * @param head The head of the Slot array.
-             * @param ptr The current Slot.
-             * @param capacity The capacity of the Slot array.
-             * @param slotsInUse The BitSet of the Slots in use.
+             * @param control The control bytes of the slots.
+             * @param slots The slots.
+             * @param capacity The number of slots.
+             * @param index The index of the current slot.
              */
-            SlotIterator(Slot* head,
-                         Slot* ptr,
-                         const UInt64 capacity,
-                         const BitSet& slotsInUse) // NOLINT(*-pass-by-value)
-                : k_Head(head), k_Capacity(capacity), k_SlotsInUse(slotsInUse), m_Ptr(ptr)
+            SlotIterator(const Int8* const control, T* const slots, const UInt64 capacity, const Int64 index)
+                : k_Control(control), k_Slots(slots), k_Capacity((Int64) capacity), m_Index(index)
             {
             }
 
@@ -557,13 +536,7 @@ namespace Otter
              */
             OTR_INLINE SlotIterator& operator++()
             {
-                m_Ptr++;
-
-                auto index = m_Ptr - k_Head;
-
-                if (!k_SlotsInUse.Get(m_Ptr - k_Head))
-                    while (m_Ptr - k_Head < k_Capacity && !k_SlotsInUse.Get(m_Ptr - k_Head))
-                        m_Ptr++;
+                m_Index = (Int64) HashControl::FindNextFull(k_Control, m_Index + 1, k_Capacity);
 
                 return *this;
             }
@@ -587,11 +560,7 @@ namespace Otter
              */
             OTR_INLINE SlotIterator& operator--()
             {
-                m_Ptr--;
-
-                if (!k_SlotsInUse.Get(m_Ptr - k_Head))
-                    while (m_Ptr != k_Head && !k_SlotsInUse.Get(m_Ptr - k_Head))
-                        m_Ptr--;
+                m_Index = HashControl::FindPreviousFull(k_Control, m_Index - 1, k_Capacity);
 
                 return *this;
             }
@@ -613,7 +582,7 @@ namespace Otter
              *
              * @return The dereferenced object.
              */
-            OTR_INLINE const T& operator*() const { return m_Ptr->Data; }
+            OTR_INLINE const T& operator*() const { return k_Slots[m_Index]; }
 
             /**
              * @brief Equality operator.
@@ -622,7 +591,10 @@ namespace Otter
              *
              * @return True if the iterators are equal, false otherwise.
              */
-            OTR_INLINE bool operator==(const SlotIterator& other) const { return m_Ptr == other.m_Ptr; }
+            OTR_INLINE bool operator==(const SlotIterator& other) const
+            {
+                return k_Slots == other.k_Slots && m_Index == other.m_Index;
+            }
 
             /**
              * @brief Inequality operator.
@@ -634,251 +606,419 @@ namespace Otter
             OTR_INLINE bool operator!=(const SlotIterator& other) const { return !(*this == other); }
 
         private:
-            const Slot* const k_Head;
-            const UInt64 k_Capacity;
-            const BitSet k_SlotsInUse;
+            const Int8* k_Control;
+            T* k_Slots;
+            Int64 k_Capacity;
 
-            Slot* m_Ptr;
+            Int64 m_Index;
         };
 
         /**
-         * @brief Tries to add an item to an empty slot in the hashset.
+         * @brief Hashes an item.
          *
-         * @param item The item to add.
-         * @param hash The hash of the item.
-         * @param index The index it should be added to.
+         * @param item The item to hash.
+         *
+         * @return The scrambled hash of the item.
+         */
+        [[nodiscard]] OTR_INLINE static UInt64 HashItem(const T& item) { return HashControl::Mix(GetHashCode(item)); }
+
+        /**
+         * @brief Gets the offset of the slots from the control bytes in the allocation of a table.
          *
-         * @return True if the item was added, false otherwise.
+         * @param capacity The capacity of the table.
          *
-         * @note This function assumes that the slot is empty, so it always returns true.
+         * @return The offset of the slots.
          */
-        bool TryAddToEmptySlot(const T& item, const UInt64 hash, const UInt64 index)
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetSlotsOffset(const UInt64 capacity)
         {
-            m_Slots[index].Set(item, hash);
-            m_SlotsInUse.Set(index, true);
-            m_Collisions.Set(index, false);
-
-            m_Count++;
+            const UInt64 controlSize = HashControl::GetControlSize(capacity);
+            return OTR_ALIGNED_OFFSET(controlSize, k_SlotAlignment);
+        }
 
-            return true;
+        /**
+         * @brief Gets the size of the allocation of a table.
+         *
+         * @param capacity The capacity of the table.
+         *
+         * @return The size of the allocation.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetAllocationSize(const UInt64 capacity)
+        {
+            return GetSlotsOffset(capacity) + capacity * sizeof(T);
         }
 
         /**
-         * @brief Tries to add an item to a slot that already has a collision stored in it.
+         * @brief Tries to add an item to the hashset, with its hash already computed.
          *
          * @param item The item to add.
-         * @param hash The hash of the item.
-         * @param index The index it should be added to.
-         *
-         * @return True if the item was added, false otherwise.
+         * @param hash The scrambled hash of the item.
          *
-         * @note This function assumes that the slot has a collision stored in it, so it always returns true. This is
-         * a destructive operation, so the collision stored in the slot will be overwritten.
-         * @note The function finds the original slot that the item in the collision slot collides with. It then removes
-         * the collision from the linked list. The new item is then added to the collision slot (which is now empty) and
-         * re-adds the original collision to the hashset.
+         * @return True if the item was added, false if it was already in the hashset.
          */
-        bool TryAddToCollisionSlot(const T& item, const UInt64 hash, const UInt64 index)
+        bool TryAddWithHash(const T& item, const UInt64 hash)
         {
-            auto collisionData = m_Slots[index].Data;
-            auto* slot = &m_Slots[m_Slots[index].Hash % m_Capacity];
-
-            while (slot->Next && slot->Next != &m_Slots[index])
-                slot = slot->Next;
-
-            if (slot->Next)
-                slot->Next = slot->Next->Next;
+            UInt64 index;
+            if (!IsEmpty() && Find(item, hash, &index))
+                return false;
 
-            m_Slots[index].Set(item, hash);
-            m_SlotsInUse.Set(index, true);
-            m_Collisions.Set(index, false);
+            index = PrepareInsert(hash);
+            new(&m_Slots[index]) T(item);
 
-            return TryAdd(std::move(collisionData));
+            return true;
         }
 
         /**
-         * @brief Tries to add a collision to the hashset.
+         * @brief Tries to add a range of items to the hashset. Room for all of them is reserved up front, and the
+         * items are hashed in batches, so that the first group of each item's probe sequence is already being fetched
+         * while the previous items are placed.
          *
-         * @param item The collision to add.
-         * @param collisionIndex The index of the collision.
-         * @param hash The hash of the collision.
+         * @param items The items to add.
+         * @param count The number of items.
          *
-         * @return True if the collision was added, false otherwise.
+         * @return True if every item was added, false if any of them was already in the hashset.
          */
-        bool TryAddNewCollision(const T& item, const UInt64 collisionIndex, const UInt64 hash)
+        bool TryAddRangeInternal(const T* const items, const UInt64 count)
         {
-            auto* slot = &m_Slots[collisionIndex];
-            auto collisionCount = 0;
-
-            while (slot)
-            {
-                collisionCount++;
-
-                if (HasItemStoredAt(slot - m_Slots) && slot->Matches(item, hash))
-                    return false;
-
-                if (!slot->Next)
-                    break;
+            if (!items || count == 0)
+                return false;
 
-                slot = slot->Next;
-            }
+            Reserve(m_Count + count);
 
-            if (collisionCount > m_CurrentMaxCollisions)
-                m_CurrentMaxCollisions = collisionCount;
+            constexpr UInt64 k_BatchSize = 16;
+            UInt64           hashes[k_BatchSize];
+            bool             addedAll = true;
 
-            for (UInt64 i = 0; i < m_Capacity; i++)
+            for (UInt64 start = 0; start < count; start += k_BatchSize)
             {
-                if (HasItemStoredAt(i))
-                    continue;
-
-                m_Slots[i].Set(item, hash);
-                m_SlotsInUse.Set(i, true);
-                m_Collisions.Set(i, true);
-
-                slot->Next = &m_Slots[i];
+                const UInt64 batchSize = count - start < k_BatchSize ? count - start : k_BatchSize;
 
-                m_Count++;
+                for (UInt64 i = 0; i < batchSize; i++)
+                {
+                    hashes[i] = HashItem(items[start + i]);
+                    OTR_PREFETCH(m_Control + GetFirstGroupOffset(hashes[i]));
+                }
 
-                return true;
+                for (UInt64 i = 0; i < batchSize; i++)
+                    addedAll &= TryAddWithHash(items[start + i], hashes[i]);
             }
 
-            return false;
+            return addedAll;
         }
 
         /**
-         * @brief Checks whether a slot has an item stored in it.
+         * @brief Gets the index of the first slot of the group where the probe sequence of a hash starts.
          *
-         * @param index The index of the slot.
+         * @param hash The scrambled hash.
          *
-         * @return True if the slot has an item stored in it, false otherwise.
+         * @return The index of the slot.
          */
-        [[nodiscard]] bool HasItemStoredAt(const UInt64 index) const { return m_SlotsInUse.Get(index); }
+        [[nodiscard]] OTR_INLINE UInt64 GetFirstGroupOffset(const UInt64 hash) const
+        {
+            return HashProbe(HashControl::GetH1(hash), HashControl::GetGroupCount(m_Capacity)).GetOffset();
+        }
 
         /**
-         * @brief Checks whether a slot has a collision stored in it.
+         * @brief Checks an item's presence in the hashset.
          *
-         * @param index The index of the slot.
+         * @param item The item to find.
+         * @param outIndex The index of the item.
          *
-         * @return True if the slot has a collision stored in it, false otherwise.
+         * @return True if the item was found, false otherwise.
+         *
+         * @note It assumes the hashset is not empty.
          */
-        [[nodiscard]] bool HasCollisionStoredAt(const UInt64 index) const { return m_Collisions.Get(index); }
+        bool Find(const T& item, UInt64* outIndex) const { return Find(item, HashItem(item), outIndex); }
 
         /**
          * @brief Checks an item's presence in the hashset.
          *
-         * @param item The item to get the index of.
+         * @param item The item to find.
+         * @param hash The scrambled hash of the item.
          * @param outIndex The index of the item.
          *
          * @return True if the item was found, false otherwise.
          *
          * @note It assumes the hashset is not empty.
          */
-        bool Exists(const T& item, UInt64* outIndex = nullptr) const
+        bool Find(const T& item, const UInt64 hash, UInt64* outIndex) const
         {
-            UInt64 hash  = GetHashCode(item) & k_63BitMask;
-            UInt64 index = hash % m_Capacity;
+            const Int8   h2         = HashControl::GetH2(hash);
+            const UInt64 groupCount = HashControl::GetGroupCount(m_Capacity);
+            const UInt32 groupMask  = HashControl::GetGroupMask(m_Capacity);
 
-            if (!HasItemStoredAt(index))
-                return false;
-
-            auto* slot = &m_Slots[index];
+            HashProbe probe(HashControl::GetH1(hash), groupCount);
 
-            while (HasItemStoredAt(slot - m_Slots) && !slot->Matches(item, hash))
+            for (UInt64 i = 0; i < groupCount; i++)
             {
-                if (!slot->Next)
+                const UInt64    offset = probe.GetOffset();
+                const HashGroup group(m_Control + offset);
+
+                for (UInt32 match = group.Match(h2) & groupMask; match != 0; match &= match - 1)
+                {
+                    const UInt64 index = offset + std::countr_zero(match);
+
+                    if (m_Slots[index] == item)
+                    {
+                        *outIndex = index;
+                        return true;
+                    }
+                }
+
+                if ((group.MatchEmpty() & groupMask) != 0)
                     return false;
 
-                slot = slot->Next;
+                probe.Next();
             }
 
-            if (outIndex)
-                *outIndex = slot - m_Slots;
+            return false;
+        }
 
-            return true;
+        /**
+         * @brief Finds the first slot along the probe sequence of a hash that does not hold an item.
+         *
+         * @param hash The scrambled hash.
+         *
+         * @return The index of the slot.
+         *
+         * @note It assumes that the table has at least one slot that does not hold an item.
+         */
+        [[nodiscard]] UInt64 FindFirstAvailable(const UInt64 hash) const
+        {
+            const UInt64 groupCount = HashControl::GetGroupCount(m_Capacity);
+            const UInt32 groupMask  = HashControl::GetGroupMask(m_Capacity);
+
+            HashProbe probe(HashControl::GetH1(hash), groupCount);
+
+            while (true)
+            {
+                const UInt64 offset = probe.GetOffset();
+                const UInt32 match  = HashGroup(m_Control + offset).MatchEmptyOrDeleted() & groupMask;
+
+                if (match != 0)
+                    return offset + std::countr_zero(match);
+
+                probe.Next();
+            }
         }
 
         /**
-         * @brief Used to expand the size of the hashset.
+         * @brief Claims a slot for a new item, growing or rehashing the hashset if it is out of room.
          *
-         * @param amount The amount to expand the hashset by.
+         * @param hash The scrambled hash of the item.
+         *
+         * @return The index of the slot. The slot is marked as full, but the item still has to be constructed in it.
          */
-        void Expand(const UInt64 amount = 0)
+        UInt64 PrepareInsert(const UInt64 hash)
         {
-            UInt64 newCapacity = CalculateExpandCapacity(amount);
+            if (m_Capacity == 0)
+                CreateEmpty(k_InitialCapacity);
 
-            if (IsEmpty())
+            UInt64 index = FindFirstAvailable(hash);
+
+            if (m_GrowthLeft == 0 && m_Control[index] == HashControl::k_Empty)
             {
-                RecreateEmpty(newCapacity);
-                return;
+                // Reclaim the deleted slots if they make up a large part of the table, otherwise grow
+                if (m_Count <= HashControl::GetGrowthLimit(m_Capacity) / 2)
+                    RehashInPlace();
+                else
+                    Resize(m_Capacity * k_ResizingFactor);
+
+                index = FindFirstAvailable(hash);
             }
 
-            HashSet<T> newHashSet;
-            newHashSet.RecreateEmpty(newCapacity);
+            if (m_Control[index] == HashControl::k_Empty)
+                m_GrowthLeft--;
+
+            m_Control[index] = HashControl::GetH2(hash);
+            m_Count++;
 
+            return index;
+        }
+
+        /**
+         * @brief Removes the item stored in a slot.
+         *
+         * @param index The index of the slot.
+         */
+        void EraseAt(const UInt64 index)
+        {
+            m_Slots[index].~T();
+            m_Count--;
+
+            // A lookup only probes past a group that has no empty slots, so if the group of the slot still has one,
+            // no lookup can have passed through it and the slot can become empty again instead of deleted
+            const UInt64 offset = index & ~(HashControl::k_GroupSize - 1);
+
+            if (HashControl::GetGroupCount(m_Capacity) == 1
+                || (HashGroup(m_Control + offset).MatchEmpty() & HashControl::GetGroupMask(m_Capacity)) != 0)
+            {
+                m_Control[index] = HashControl::k_Empty;
+                m_GrowthLeft++;
+            }
+            else
+            {
+                m_Control[index] = HashControl::k_Deleted;
+            }
+        }
+
+        /**
+         * @brief Moves every item to a new table with a given capacity.
+         *
+         * @param capacity The capacity of the new table. Must be a power of two.
+         */
+        void Resize(const UInt64 capacity)
+        {
+            Int8* const  oldControl  = m_Control;
+            T* const  oldSlots    = m_Slots;
+            const UInt64 oldCapacity = m_Capacity;
+            const UInt64 count       = m_Count;
+
+            CreateEmpty(capacity);
+
+            for (UInt64 i = HashControl::FindNextFull(oldControl, 0, oldCapacity);
+                 i < oldCapacity;
+                 i = HashControl::FindNextFull(oldControl, i + 1, oldCapacity))
+            {
+                const UInt64 hash  = HashItem(oldSlots[i]);
+                const UInt64 index = FindFirstAvailable(hash);
+
+                m_Control[index] = HashControl::GetH2(hash);
+                new(&m_Slots[index]) T(std::move(oldSlots[i]));
+                oldSlots[i].~T();
+            }
+
+            m_Count = count;
+            m_GrowthLeft -= count;
+
+            if (oldControl)
+                MemorySystem::Free(oldControl, GetAllocationSize(oldCapacity), MemoryTag::Collections);
+        }
+
+        /**
+         * @brief Rehashes the hashset without growing it, which turns every deleted slot back into an empty one.
+         */
+        void RehashInPlace()
+        {
+            // Mark every full slot as deleted and every deleted slot as empty, then move each item still marked as
+            // deleted to the first slot available along its probe sequence
             for (UInt64 i = 0; i < m_Capacity; i++)
+                m_Control[i] = HashControl::IsFull(m_Control[i]) ? HashControl::k_Deleted : HashControl::k_Empty;
+
+            UInt64 i = 0;
+            while (i < m_Capacity)
             {
-                if (!HasItemStoredAt(i))
+                if (m_Control[i] != HashControl::k_Deleted)
+                {
+                    i++;
                     continue;
+                }
 
-                newHashSet.TryAdd(m_Slots[i].Data);
-            }
+                const UInt64 hash   = HashItem(m_Slots[i]);
+                const Int8   h2     = HashControl::GetH2(hash);
+                const UInt64 target = FindFirstAvailable(hash);
 
-            if (IsCreated())
-                Destroy();
+                // The item is already in the first group that its probe sequence reaches with room for it
+                if (target / HashControl::k_GroupSize == i / HashControl::k_GroupSize)
+                {
+                    m_Control[i] = h2;
+                    i++;
+                    continue;
+                }
 
-            m_Slots = Buffer::New<Slot>(newCapacity);
+                if (m_Control[target] == HashControl::k_Empty)
+                {
+                    new(&m_Slots[target]) T(std::move(m_Slots[i]));
+                    m_Slots[i].~T();
 
-            for (UInt64 i = 0; i < newCapacity; i++)
-                if (newHashSet.HasItemStoredAt(i))
-                    m_Slots[i] = std::move(newHashSet.m_Slots[i]);
+                    m_Control[target] = h2;
+                    m_Control[i]      = HashControl::k_Empty;
+                    i++;
+                    continue;
+                }
 
-            m_Capacity             = newHashSet.m_Capacity;
-            m_CurrentMaxCollisions = newHashSet.m_CurrentMaxCollisions;
+                // The target holds an item that has not been placed yet, so swap them and place that item next
+                T temp(std::move(m_Slots[target]));
+                m_Slots[target] = std::move(m_Slots[i]);
+                m_Slots[i]      = std::move(temp);
 
-            m_SlotsInUse = std::move(newHashSet.m_SlotsInUse);
-            m_Collisions = std::move(newHashSet.m_Collisions);
+                m_Control[target] = h2;
+            }
+
+            m_GrowthLeft = HashControl::GetGrowthLimit(m_Capacity) - m_Count;
         }
 
         /**
-         * @brief Recreates the hashset with a given capacity. Deletes any existing data.
+         * @brief Creates an empty table with a given capacity.
+         *
+         * @param capacity The capacity of the table. Must be a power of two.
          *
-         * @param capacity The capacity to recreate the hashset with.
+         * @note No checks are performed to see if the hashset has been created. Any existing table is not freed.
          */
-        void RecreateEmpty(const UInt64 capacity)
+        void CreateEmpty(const UInt64 capacity)
         {
-            if (IsCreated())
-                Destroy();
-
-            m_Slots    = capacity > 0 ? Buffer::New<Slot>(capacity) : nullptr;
+            auto* const block = (Byte*) MemorySystem::Allocate(GetAllocationSize(capacity),
+                                                               (UInt16) k_SlotAlignment,
+                                                               AllocationFlags::Uninitialised,
+                                                               MemoryTag::Collections).Pointer;
+            OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Failed to allocate memory for the hashset table")
+
+            m_Control  = (Int8*) block;
+            m_Slots    = (T*) (block + GetSlotsOffset(capacity));
             m_Capacity = capacity;
             m_Count    = 0;
 
-            if (capacity == 0)
-                return;
+            ResetControl();
+        }
 
-            m_SlotsInUse.Reserve(capacity);
-            m_Collisions.Reserve(capacity);
+        /**
+         * @brief Marks every slot of the table as empty.
+         */
+        void ResetControl()
+        {
+            std::memset(m_Control, (UInt8) HashControl::k_Empty, HashControl::GetControlSize(m_Capacity));
+            m_GrowthLeft = HashControl::GetGrowthLimit(m_Capacity);
         }
 
         /**
-         * @brief Calculates the new capacity when expanding the hashset.
+         * @brief Copies the table of another hashset, keeping every item in the same slot.
          *
-         * @param expandAmount The amount to expand the hashset by.
+         * @param other The hashset to copy.
          *
-         * @return The new capacity.
+         * @note No checks are performed to see if the hashset has been created.
          */
-        [[nodiscard]] UInt64 CalculateExpandCapacity(const UInt64 expandAmount) const
+        void CopyFrom(const HashSet<T>& other)
         {
-            UInt64 newCapacity;
+            m_Control    = nullptr;
+            m_Slots      = nullptr;
+            m_Capacity   = 0;
+            m_Count      = 0;
+            m_GrowthLeft = 0;
 
-            if (expandAmount == 0)
-                newCapacity = m_Capacity == 0
-                              ? k_InitialCapacity
-                              : HashUtils::GetNextPrime(m_Capacity * k_ResizingFactor);
-            else
-                newCapacity = HashUtils::GetNextPrime(m_Capacity + expandAmount);
+            if (!other.IsCreated())
+                return;
+
+            CreateEmpty(other.m_Capacity);
+            std::memcpy(m_Control, other.m_Control, HashControl::GetControlSize(m_Capacity));
+
+            for (UInt64 i = 0; i < m_Capacity; i++)
+                if (HashControl::IsFull(m_Control[i]))
+                    new(&m_Slots[i]) T(other.m_Slots[i]);
 
-            return newCapacity;
+            m_Count      = other.m_Count;
+            m_GrowthLeft = other.m_GrowthLeft;
+        }
+
+        /**
+         * @brief Destroys every item in the hashset, without touching the control bytes.
+         */
+        void DestroyItems()
+        {
+            if constexpr (std::is_trivially_destructible_v<T>)
+                return;
+
+            for (UInt64 i = 0; i < m_Capacity; i++)
+                if (HashControl::IsFull(m_Control[i]))
+                    m_Slots[i].~T();
         }
 
         /**
@@ -888,12 +1028,21 @@ namespace Otter
          */
         void Destroy()
         {
-            Buffer::Delete<Slot>(m_Slots, m_Capacity);
+            DestroyItems();
+            MemorySystem::Free(m_Control, GetAllocationSize(m_Capacity), MemoryTag::Collections);
 
-            m_SlotsInUse.ClearDestructive();
-            m_Collisions.ClearDestructive();
+            m_Control = nullptr;
+            m_Slots   = nullptr;
         }
     };
+
+    /**
+     * @brief The control bytes and slots of a hash set live on the heap, so it can be moved bytewise.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable<HashSet<T>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_HASHSET_H
@@ -0,0 +1,478 @@
+#ifndef OTTERENGINE_INLINELIST_H
+#define OTTERENGINE_INLINELIST_H
+
+#include "Core/Memory.h"
+#include "Core/Collections/Iterators/LinearIterator.h"
+
+namespace Otter
+{
+    /**
+     * @brief A list of items that stores up to a fixed number of items inline, and only moves them to a heap
+     * allocation once it outgrows them. Lists that usually hold a handful of items, such as the bookkeeping of the
+     * ECS, never touch the allocator at all.
+     *
+     * @tparam T The type of the items in the list.
+     * @tparam InlineCapacity The number of items that are stored inline.
+     *
+     * @note Moving a list that has not spilled moves its items one by one, instead of stealing a pointer.
+     */
+    template<typename T, UInt64 InlineCapacity>
+    class InlineList final
+    {
+        OTR_STATIC_ASSERT(InlineCapacity > 0, "The inline capacity must be greater than 0.")
+
+        /// @brief An alias for an iterator for the list.
+        using Iterator = LinearIterator<T>;
+
+        /// @brief An alias for a const iterator for the list.
+        using ConstIterator = LinearIterator<const T>;
+
+    public:
+        /**
+         * @brief Constructor.
+         */
+        InlineList() = default;
+
+        /**
+         * @brief Destructor.
+         */
+        ~InlineList()
+        {
+            if (IsSpilled())
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
+
+            m_Data     = nullptr;
+            m_Capacity = 0;
+            m_Count    = 0;
+        }
+
+        /**
+         * @brief Creates a list from an initialiser list.
+         *
+         * @param list The initialiser list.
+         */
+        InlineList(InitialiserList<T> list)
+        {
+            EnsureCapacity(list.size());
+
+            for (const T& item: list)
+                m_Data[m_Count++] = item;
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param other The list to copy.
+         */
+        InlineList(const InlineList<T, InlineCapacity>& other)
+        {
+            CopyFrom(other);
+        }
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The list to move.
+         */
+        InlineList(InlineList<T, InlineCapacity>&& other) noexcept
+        {
+            MoveFrom(std::move(other));
+        }
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The list to copy.
+         *
+         * @return A reference to this list.
+         */
+        InlineList<T, InlineCapacity>& operator=(const InlineList<T, InlineCapacity>& other)
+        {
+            if (this == &other)
+                return *this;
+
+            ClearDestructive();
+            CopyFrom(other);
+
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The list to move.
+         *
+         * @return A reference to this list.
+         */
+        InlineList<T, InlineCapacity>& operator=(InlineList<T, InlineCapacity>&& other) noexcept
+        {
+            if (this == &other)
+                return *this;
+
+            ClearDestructive();
+            MoveFrom(std::move(other));
+
+            return *this;
+        }
+
+        /**
+         * @brief Equality operator.
+         *
+         * @param other The list to compare to.
+         *
+         * @return True if the lists hold the same items in the same order, false otherwise.
+         */
+        bool operator==(const InlineList<T, InlineCapacity>& other) const
+        {
+            if (m_Count != other.m_Count)
+                return false;
+
+            for (UInt64 i = 0; i < m_Count; i++)
+                if (!(m_Data[i] == other.m_Data[i]))
+                    return false;
+
+            return true;
+        }
+
+        /**
+         * @brief Inequality operator.
+         *
+         * @param other The list to compare to.
+         *
+         * @return True if the lists do not hold the same items in the same order, false otherwise.
+         */
+        bool operator!=(const InlineList<T, InlineCapacity>& other) const { return !(*this == other); }
+
+        /**
+         * @brief Gets the element at the specified index.
+         *
+         * @param index The index.
+         *
+         * @return The element at the specified index.
+         */
+        [[nodiscard]] T& operator[](const UInt64 index)
+        {
+            OTR_ASSERT(index < m_Count, "List index out of bounds")
+            return m_Data[index];
+        }
+
+        /**
+         * @brief Gets the element at the specified index.
+         *
+         * @param index The index.
+         *
+         * @return The element at the specified index.
+         */
+        [[nodiscard]] const T& operator[](const UInt64 index) const
+        {
+            OTR_ASSERT(index < m_Count, "List index out of bounds")
+            return m_Data[index];
+        }
+
+        /**
+         * @brief Adds an item to the list.
+         *
+         * @param item The item to add.
+         */
+        void Add(const T& item)
+        {
+            if (m_Count >= m_Capacity)
+                EnsureCapacity(m_Capacity * 2);
+
+            m_Data[m_Count++] = item;
+        }
+
+        /**
+         * @brief Adds an item to the list.
+         *
+         * @param item The item to add.
+         */
+        void Add(T&& item) noexcept
+        {
+            if (m_Count >= m_Capacity)
+                EnsureCapacity(m_Capacity * 2);
+
+            m_Data[m_Count++] = std::move(item);
+        }
+
+        /**
+         * @brief Tries to add a range of items to the list.
+         *
+         * @param items The items to add.
+         *
+         * @return True if the items were added, false otherwise.
+         */
+        bool TryAddRange(InitialiserList<T> items)
+        {
+            if (items.size() == 0)
+                return false;
+
+            EnsureCapacity(m_Count + items.size());
+
+            for (const T& item: items)
+                m_Data[m_Count++] = item;
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to remove an item from the list.
+         *
+         * @param item The item to remove.
+         *
+         * @return True if the item was removed, false otherwise.
+         */
+        bool TryRemove(const T& item)
+        {
+            for (UInt64 i = 0; i < m_Count; i++)
+                if (m_Data[i] == item)
+                    return TryRemoveAt(i);
+
+            return false;
+        }
+
+        /**
+         * @brief Tries to remove an item from the list at the specified index. The last item of the list takes its
+         * place.
+         *
+         * @param index The index at which to remove the item.
+         *
+         * @return True if the item was removed, false otherwise.
+         */
+        bool TryRemoveAt(const UInt64 index)
+        {
+            if (index >= m_Count)
+                return false;
+
+            if (index != m_Count - 1)
+                m_Data[index] = std::move(m_Data[m_Count - 1]);
+
+            m_Count--;
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if the list contains a given item.
+         *
+         * @param item The item to check for.
+         *
+         * @return True if the list contains the item, false otherwise.
+         */
+        [[nodiscard]] bool Contains(const T& item) const
+        {
+            for (UInt64 i = 0; i < m_Count; i++)
+                if (m_Data[i] == item)
+                    return true;
+
+            return false;
+        }
+
+        /**
+         * @brief Tries to get the index of a given item.
+         *
+         * @param item The item to get the index of.
+         * @param outIndex The index of the item.
+         *
+         * @return True if the item was found, false otherwise.
+         */
+        [[nodiscard]] bool TryGetIndexOf(const T& item, UInt64* outIndex) const
+        {
+            OTR_ASSERT(outIndex, "Out index must not be null")
+
+            for (UInt64 i = 0; i < m_Count; i++)
+                if (m_Data[i] == item)
+                {
+                    *outIndex = i;
+                    return true;
+                }
+
+            return false;
+        }
+
+        /**
+         * @brief Makes sure that the list can hold a given number of items without growing. Unlike the reserve of
+         * other collections, the items of the list are kept.
+         *
+         * @param capacity The number of items.
+         */
+        void EnsureCapacity(const UInt64 capacity)
+        {
+            if (capacity <= m_Capacity)
+                return;
+
+            T* newData = Buffer::New<T>(capacity, MemoryTag::Collections);
+
+            for (UInt64 i = 0; i < m_Count; i++)
+                newData[i] = std::move(m_Data[i]);
+
+            if (IsSpilled())
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
+
+            m_Data     = newData;
+            m_Capacity = capacity;
+        }
+
+        /**
+         * @brief Clears the list.
+         */
+        OTR_INLINE void Clear() { m_Count = 0; }
+
+        /**
+         * @brief Clears the list and releases its heap allocation, if it has one. Inline items are reset, so that any
+         * memory they own is released as well.
+         */
+        void ClearDestructive()
+        {
+            if (IsSpilled())
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
+            else
+                for (UInt64 i = 0; i < m_Count; i++)
+                    m_Inline[i] = T();
+
+            m_Data     = m_Inline;
+            m_Capacity = InlineCapacity;
+            m_Count    = 0;
+        }
+
+        /**
+         * @brief Gets a pointer to the data of the list.
+         *
+         * @return A pointer to the data of the list.
+         */
+        [[nodiscard]] OTR_INLINE const T* GetData() const noexcept { return m_Data; }
+
+        /**
+         * @brief Gets the capacity of the list.
+         *
+         * @return The capacity of the list.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetCapacity() const noexcept { return m_Capacity; }
+
+        /**
+         * @brief Gets the item count of the list.
+         *
+         * @return The item count of the list.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetCount() const noexcept { return m_Count; }
+
+        /**
+         * @brief Checks whether the list is empty.
+         *
+         * @return True if the list is empty, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool IsEmpty() const noexcept { return m_Count == 0; }
+
+        /**
+         * @brief Checks whether the list has outgrown its inline items and moved them to the heap.
+         *
+         * @return True if the items are stored on the heap, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool IsSpilled() const noexcept { return m_Data != m_Inline; }
+
+        /**
+         * @brief Gets an iterator to the first element of the list.
+         *
+         * @return An iterator to the first element of the list.
+         */
+        OTR_INLINE Iterator begin() const noexcept { return Iterator(m_Data); }
+
+        /**
+         * @brief Gets an iterator to the last element of the list.
+         *
+         * @return An iterator to the last element of the list.
+         */
+        OTR_INLINE Iterator end() const noexcept { return Iterator(m_Data + m_Count); }
+
+        /**
+         * @brief Gets a reverse iterator to the last element of the list.
+         *
+         * @return A reverse iterator to the last element of the list.
+         */
+        OTR_INLINE Iterator rbegin() const noexcept { return Iterator(m_Data + m_Count - 1); }
+
+        /**
+         * @brief Gets a reverse iterator to the first element of the list.
+         *
+         * @return A reverse iterator to the first element of the list.
+         */
+        OTR_INLINE Iterator rend() const noexcept { return Iterator(m_Data - 1); }
+
+        /**
+         * @brief Gets a const iterator to the first element of the list.
+         *
+         * @return A const iterator to the first element of the list.
+         */
+        OTR_INLINE ConstIterator cbegin() const noexcept { return ConstIterator(m_Data); }
+
+        /**
+         * @brief Gets a const iterator to the last element of the list.
+         *
+         * @return A const iterator to the last element of the list.
+         */
+        OTR_INLINE ConstIterator cend() const noexcept { return ConstIterator(m_Data + m_Count); }
+
+        /**
+         * @brief Gets a reverse const iterator to the last element of the list.
+         *
+         * @return A reverse const iterator to the last element of the list.
+         */
+        OTR_INLINE ConstIterator crbegin() const noexcept { return ConstIterator(m_Data + m_Count - 1); }
+
+        /**
+         * @brief Gets a reverse const iterator to the first element of the list.
+         *
+         * @return A reverse const iterator to the first element of the list.
+         */
+        OTR_INLINE ConstIterator crend() const noexcept { return ConstIterator(m_Data - 1); }
+
+    private:
+        T m_Inline[InlineCapacity]{ };
+        T* m_Data = m_Inline;
+        UInt64 m_Capacity = InlineCapacity;
+        UInt64 m_Count    = 0;
+
+        /**
+         * @brief Copies the items of another list into this one, which must be empty and not spilled.
+         *
+         * @param other The list to copy.
+         */
+        void CopyFrom(const InlineList<T, InlineCapacity>& other)
+        {
+            EnsureCapacity(other.m_Count);
+
+            for (UInt64 i = 0; i < other.m_Count; i++)
+                m_Data[i] = other.m_Data[i];
+
+            m_Count = other.m_Count;
+        }
+
+        /**
+         * @brief Moves the items of another list into this one, which must be empty and not spilled. A spilled list
+         * hands over its heap allocation, the items of a list that has not spilled are moved one by one.
+         *
+         * @param other The list to move.
+         */
+        void MoveFrom(InlineList<T, InlineCapacity>&& other) noexcept
+        {
+            if (other.IsSpilled())
+            {
+                m_Data     = other.m_Data;
+                m_Capacity = other.m_Capacity;
+            }
+            else
+            {
+                for (UInt64 i = 0; i < other.m_Count; i++)
+                    m_Inline[i] = std::move(other.m_Inline[i]);
+            }
+
+            m_Count = other.m_Count;
+
+            other.m_Data     = other.m_Inline;
+            other.m_Capacity = InlineCapacity;
+            other.m_Count    = 0;
+        }
+    };
+}
+
+#endif //OTTERENGINE_INLINELIST_H
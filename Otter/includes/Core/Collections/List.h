@@ -272,6 +272,14 @@ namespace Otter
             return true;
         }
     };
+
+    /**
+     * @brief A list only holds a pointer to its heap buffer, so moving its bytes is enough to move it.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable<List<T>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_LIST_H
@@ -0,0 +1,256 @@
+#ifndef OTTERENGINE_MPMCQUEUE_H
+#define OTTERENGINE_MPMCQUEUE_H
+
+#include <atomic>
+
+#include "Core/Defines.h"
+#include "Core/BaseTypes.h"
+#include "Core/Assert.h"
+
+namespace Otter
+{
+    /**
+     * @brief A FIFO (First In First Out) collection with a fixed capacity, that any number of threads can enqueue
+     * into and dequeue from, without any lock. The items are stored inline, in a circular buffer.
+     *
+     * @tparam T The type of the items in the queue.
+     * @tparam Capacity The number of items that the queue can hold. Must be a power of two.
+     *
+     * @note Every slot has a sequence number, which tells a producer whether the slot is free for its position and
+     * a consumer whether the slot holds the item of its position. Threads claim a position with a single
+     * compare-and-swap, and then only touch their own slot.
+     */
+    template<typename T, UInt64 Capacity>
+    class MpmcQueue final
+    {
+        OTR_STATIC_ASSERT(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.")
+
+    public:
+        /**
+         * @brief Constructor.
+         */
+        MpmcQueue()
+        {
+            for (UInt64 i = 0; i < Capacity; i++)
+                m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~MpmcQueue() = default;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        MpmcQueue(const MpmcQueue<T, Capacity>& other) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        MpmcQueue(MpmcQueue<T, Capacity>&& other) noexcept = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        MpmcQueue<T, Capacity>& operator=(const MpmcQueue<T, Capacity>& other) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        MpmcQueue<T, Capacity>& operator=(MpmcQueue<T, Capacity>&& other) noexcept = delete;
+
+        /**
+         * @brief Tries to enqueue an item into the queue.
+         *
+         * @param item The item to enqueue.
+         *
+         * @return True if the item was enqueued, false if the queue is full.
+         */
+        bool TryEnqueue(const T& item)
+        {
+            UInt64 position;
+            if (!TryClaimEnqueue(&position))
+                return false;
+
+            Slot& slot = m_Slots[position & k_Mask];
+            slot.Item = item;
+            slot.Sequence.store(position + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to enqueue an item into the queue.
+         *
+         * @param item The item to enqueue.
+         *
+         * @return True if the item was enqueued, false if the queue is full.
+         */
+        bool TryEnqueue(T&& item) noexcept
+        {
+            UInt64 position;
+            if (!TryClaimEnqueue(&position))
+                return false;
+
+            Slot& slot = m_Slots[position & k_Mask];
+            slot.Item = std::move(item);
+            slot.Sequence.store(position + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to dequeue an item from the queue.
+         *
+         * @return True if an item was dequeued, false if the queue is empty.
+         */
+        bool TryDequeue()
+        {
+            UInt64 position;
+            if (!TryClaimDequeue(&position))
+                return false;
+
+            m_Slots[position & k_Mask].Sequence.store(position + Capacity, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to dequeue an item from the queue.
+         *
+         * @param outItem The item that was dequeued.
+         *
+         * @return True if an item was dequeued, false if the queue is empty.
+         */
+        bool TryDequeue(T* outItem)
+        {
+            UInt64 position;
+            if (!TryClaimDequeue(&position))
+                return false;
+
+            Slot& slot = m_Slots[position & k_Mask];
+            *outItem = std::move(slot.Item);
+            slot.Sequence.store(position + Capacity, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Gets the capacity of the queue.
+         *
+         * @return The capacity of the queue.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetCapacity() noexcept { return Capacity; }
+
+        /**
+         * @brief Gets the number of items in the queue.
+         *
+         * @return The number of items in the queue.
+         *
+         * @note While other threads are running, the count may already be out of date when it is returned. It also
+         * counts the items that are still being enqueued or dequeued.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetCount() const noexcept
+        {
+            const UInt64 dequeuePosition = m_DequeuePosition.load(std::memory_order_acquire);
+            const UInt64 enqueuePosition = m_EnqueuePosition.load(std::memory_order_acquire);
+
+            return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @return True if the queue is empty, false otherwise.
+         *
+         * @note While other threads are running, the result may already be out of date when it is returned.
+         */
+        [[nodiscard]] OTR_INLINE bool IsEmpty() const noexcept { return GetCount() == 0; }
+
+    private:
+        /**
+         * @brief A slot of the queue. Its sequence equals the position that may enqueue into it next, or that
+         * position plus one once the item of that position is in it.
+         */
+        struct Slot
+        {
+            std::atomic<UInt64> Sequence;
+            T                   Item{ };
+        };
+
+        static constexpr UInt64 k_Mask = Capacity - 1;
+
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) std::atomic<UInt64> m_EnqueuePosition{ 0 };
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) std::atomic<UInt64> m_DequeuePosition{ 0 };
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) Slot m_Slots[Capacity];
+
+        /**
+         * @brief Claims the next enqueue position, whose slot is free.
+         *
+         * @param outPosition The claimed position.
+         *
+         * @return True if a position was claimed, false if the queue is full.
+         */
+        bool TryClaimEnqueue(UInt64* outPosition) noexcept
+        {
+            UInt64 position = m_EnqueuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Slot& slot = m_Slots[position & k_Mask];
+                const Int64 difference = (Int64) (slot.Sequence.load(std::memory_order_acquire) - position);
+
+                // The slot still holds an item of the previous lap, so the queue is full
+                if (difference < 0)
+                    return false;
+
+                if (difference == 0 && m_EnqueuePosition.compare_exchange_weak(position,
+                                                                               position + 1,
+                                                                               std::memory_order_relaxed))
+                {
+                    *outPosition = position;
+                    return true;
+                }
+
+                if (difference > 0)
+                    position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Claims the next dequeue position, whose slot holds an item.
+         *
+         * @param outPosition The claimed position.
+         *
+         * @return True if a position was claimed, false if the queue is empty.
+         */
+        bool TryClaimDequeue(UInt64* outPosition) noexcept
+        {
+            UInt64 position = m_DequeuePosition.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                Slot& slot = m_Slots[position & k_Mask];
+                const Int64 difference = (Int64) (slot.Sequence.load(std::memory_order_acquire) - (position + 1));
+
+                // The item of this position has not been enqueued yet, so the queue is empty
+                if (difference < 0)
+                    return false;
+
+                if (difference == 0 && m_DequeuePosition.compare_exchange_weak(position,
+                                                                               position + 1,
+                                                                               std::memory_order_relaxed))
+                {
+                    *outPosition = position;
+                    return true;
+                }
+
+                if (difference > 0)
+                    position = m_DequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    };
+}
+
+#endif //OTTERENGINE_MPMCQUEUE_H
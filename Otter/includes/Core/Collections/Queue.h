@@ -33,7 +33,7 @@ namespace Otter
         ~Queue()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
         }
 
         /**
@@ -45,7 +45,7 @@ namespace Otter
             : Queue()
         {
             m_Capacity   = list.size();
-            m_Data       = Buffer::New<T>(m_Capacity);
+            m_Data       = Buffer::New<T>(m_Capacity, MemoryTag::Collections);
             m_Count      = 0;
             m_StartIndex = 0;
 
@@ -67,7 +67,7 @@ namespace Otter
             if (m_Capacity == 0)
                 return;
 
-            m_Data = Buffer::New<T>(m_Capacity);
+            m_Data = Buffer::New<T>(m_Capacity, MemoryTag::Collections);
 
             if (m_Count > 0)
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Capacity * sizeof(T));
@@ -104,7 +104,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Capacity   = other.m_Capacity;
             m_Count      = other.m_Count;
@@ -113,7 +113,7 @@ namespace Otter
             if (m_Capacity == 0)
                 return *this;
 
-            m_Data = Buffer::New<T>(m_Capacity);
+            m_Data = Buffer::New<T>(m_Capacity, MemoryTag::Collections);
 
             if (m_Count > 0)
                 MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Capacity * sizeof(T));
@@ -134,7 +134,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Data       = std::move(other.m_Data);
             m_Capacity   = std::move(other.m_Capacity);
@@ -322,28 +322,12 @@ namespace Otter
                 return;
             }
 
-            T* newData = Buffer::New<T>(newCapacity);
-
-            if (m_StartIndex + m_Count < m_Capacity)
-            {
-                for (UInt64 i = 0; i < m_Count; i++)
-                    newData[i] = m_Data[i + m_StartIndex];
-            }
-            else
-            {
-                const auto endIndex = m_StartIndex + m_Count - m_Capacity;
-
-                for (UInt64 i = 0; i < m_Capacity - m_StartIndex; i++)
-                    newData[i] = m_Data[i + m_StartIndex];
-
-                for (UInt64 i = 0; i < endIndex; i++)
-                    newData[i + m_Capacity - m_StartIndex] = m_Data[i];
-            }
-
-            if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
-
-            m_Data       = newData;
+            m_Data       = Buffer::Relocate<T>(m_Data,
+                                               m_Capacity,
+                                               newCapacity,
+                                               m_Count,
+                                               m_StartIndex,
+                                               MemoryTag::Collections);
             m_Capacity   = newCapacity;
             m_StartIndex = 0;
         }
@@ -364,28 +348,12 @@ namespace Otter
                 return;
             }
 
-            T* newData = Buffer::New<T>(newCapacity);
-
-            if (m_StartIndex + m_Count < m_Capacity)
-            {
-                for (UInt64 i = 0; i < m_Count && i < newCapacity; i++)
-                    newData[i] = m_Data[i + m_StartIndex];
-            }
-            else
-            {
-                const auto endIndex = m_StartIndex + m_Count - m_Capacity;
-
-                for (UInt64 i = 0; i < m_Capacity - m_StartIndex && i < newCapacity; i++)
-                    newData[i] = m_Data[i + m_StartIndex];
-
-                for (UInt64 i = 0; i < endIndex && i < newCapacity; i++)
-                    newData[i + m_Capacity - m_StartIndex] = m_Data[i];
-            }
-
-            if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
-
-            m_Data       = newData;
+            m_Data       = Buffer::Relocate<T>(m_Data,
+                                               m_Capacity,
+                                               newCapacity,
+                                               m_Count,
+                                               m_StartIndex,
+                                               MemoryTag::Collections);
             m_Capacity   = newCapacity;
             m_Count      = m_Count < newCapacity ? m_Count : newCapacity;
             m_StartIndex = 0;
@@ -437,7 +405,7 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
             m_Data       = nullptr;
             m_Capacity   = 0;
@@ -513,9 +481,9 @@ namespace Otter
         void RecreateEmpty(const UInt64 capacity)
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, m_Capacity);
+                Buffer::Delete<T>(m_Data, m_Capacity, MemoryTag::Collections);
 
-            m_Data       = capacity > 0 ? Buffer::New<T>(capacity) : nullptr;
+            m_Data       = capacity > 0 ? Buffer::New<T>(capacity, MemoryTag::Collections) : nullptr;
             m_Capacity   = capacity;
             m_Count      = 0;
             m_StartIndex = 0;
@@ -568,6 +536,14 @@ namespace Otter
             return newCapacity;
         }
     };
+
+    /**
+     * @brief The ring buffer of a queue is addressed by index, so the queue can be moved bytewise.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable<Queue<T>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_QUEUE_H
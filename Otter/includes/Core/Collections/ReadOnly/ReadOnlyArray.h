@@ -32,7 +32,7 @@ namespace Otter
         ReadOnlyArray()
         {
             if constexpr (Size > 0)
-                m_Data = Buffer::New<T>(Size);
+                m_Data = Buffer::New<T>(Size, AllocationFlags::Zeroed, MemoryTag::Collections);
         }
 
         /**
@@ -41,7 +41,7 @@ namespace Otter
         ~ReadOnlyArray()
         {
             if (IsCreated())
-                Buffer::Delete<T>(m_Data, Size);
+                Buffer::Delete<T>(m_Data, Size, MemoryTag::Collections);
 
             m_Data = nullptr;
         }
@@ -0,0 +1,263 @@
+#ifndef OTTERENGINE_SPSCQUEUE_H
+#define OTTERENGINE_SPSCQUEUE_H
+
+#include <atomic>
+
+#include "Core/Defines.h"
+#include "Core/BaseTypes.h"
+#include "Core/Assert.h"
+
+namespace Otter
+{
+    /**
+     * @brief A FIFO (First In First Out) collection with a fixed capacity, that one thread enqueues into while
+     * another thread dequeues from, without any lock. The items are stored inline, in a circular buffer.
+     *
+     * @tparam T The type of the items in the queue.
+     * @tparam Capacity The number of items that the queue can hold. Must be a power of two.
+     *
+     * @note Only one thread may enqueue and only one thread may dequeue at a time. The producer and the consumer
+     * each own an index on its own cache line, and keep a cached copy of the other's index, so that they only touch
+     * each other's cache line when the queue looks full or empty.
+     */
+    template<typename T, UInt64 Capacity>
+    class SpscQueue final
+    {
+        OTR_STATIC_ASSERT(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.")
+
+    public:
+        /**
+         * @brief Constructor.
+         */
+        SpscQueue() = default;
+
+        /**
+         * @brief Destructor.
+         */
+        ~SpscQueue() = default;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        SpscQueue(const SpscQueue<T, Capacity>& other) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        SpscQueue(SpscQueue<T, Capacity>&& other) noexcept = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        SpscQueue<T, Capacity>& operator=(const SpscQueue<T, Capacity>& other) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        SpscQueue<T, Capacity>& operator=(SpscQueue<T, Capacity>&& other) noexcept = delete;
+
+        /**
+         * @brief Tries to enqueue an item into the queue. Must only be called from the producer thread.
+         *
+         * @param item The item to enqueue.
+         *
+         * @return True if the item was enqueued, false if the queue is full.
+         */
+        bool TryEnqueue(const T& item)
+        {
+            const UInt64 tail = m_Tail.load(std::memory_order_relaxed);
+            if (!HasSpace(tail, 1))
+                return false;
+
+            m_Items[tail & k_Mask] = item;
+            m_Tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to enqueue an item into the queue. Must only be called from the producer thread.
+         *
+         * @param item The item to enqueue.
+         *
+         * @return True if the item was enqueued, false if the queue is full.
+         */
+        bool TryEnqueue(T&& item) noexcept
+        {
+            const UInt64 tail = m_Tail.load(std::memory_order_relaxed);
+            if (!HasSpace(tail, 1))
+                return false;
+
+            m_Items[tail & k_Mask] = std::move(item);
+            m_Tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Enqueues as many items of a range as fit into the queue, and publishes them to the consumer at once.
+         * Must only be called from the producer thread.
+         *
+         * @param items The items to enqueue.
+         * @param count The number of items.
+         *
+         * @return The number of items that were enqueued, from the start of the range.
+         */
+        UInt64 TryEnqueueRange(const T* const items, UInt64 count)
+        {
+            const UInt64 tail = m_Tail.load(std::memory_order_relaxed);
+            if (!HasSpace(tail, count))
+                count = Capacity - (tail - m_CachedHead);
+
+            for (UInt64 i = 0; i < count; i++)
+                m_Items[(tail + i) & k_Mask] = items[i];
+
+            if (count > 0)
+                m_Tail.store(tail + count, std::memory_order_release);
+
+            return count;
+        }
+
+        /**
+         * @brief Tries to dequeue an item from the queue. Must only be called from the consumer thread.
+         *
+         * @return True if an item was dequeued, false if the queue is empty.
+         */
+        bool TryDequeue()
+        {
+            const UInt64 head = m_Head.load(std::memory_order_relaxed);
+            if (!HasItems(head, 1))
+                return false;
+
+            m_Head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Tries to dequeue an item from the queue. Must only be called from the consumer thread.
+         *
+         * @param outItem The item that was dequeued.
+         *
+         * @return True if an item was dequeued, false if the queue is empty.
+         */
+        bool TryDequeue(T* outItem)
+        {
+            const UInt64 head = m_Head.load(std::memory_order_relaxed);
+            if (!HasItems(head, 1))
+                return false;
+
+            *outItem = std::move(m_Items[head & k_Mask]);
+            m_Head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * @brief Dequeues up to a number of items from the queue, and hands their slots back to the producer at once.
+         * Must only be called from the consumer thread.
+         *
+         * @param outItems The items that were dequeued. Must have room for the given number of items.
+         * @param count The largest number of items to dequeue.
+         *
+         * @return The number of items that were dequeued.
+         */
+        UInt64 TryDequeueRange(T* const outItems, UInt64 count)
+        {
+            const UInt64 head = m_Head.load(std::memory_order_relaxed);
+            if (!HasItems(head, count))
+                count = m_CachedTail - head;
+
+            for (UInt64 i = 0; i < count; i++)
+                outItems[i] = std::move(m_Items[(head + i) & k_Mask]);
+
+            if (count > 0)
+                m_Head.store(head + count, std::memory_order_release);
+
+            return count;
+        }
+
+        /**
+         * @brief Gets the capacity of the queue.
+         *
+         * @return The capacity of the queue.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetCapacity() noexcept { return Capacity; }
+
+        /**
+         * @brief Gets the number of items in the queue.
+         *
+         * @return The number of items in the queue.
+         *
+         * @note While the other thread is running, the count may already be out of date when it is returned.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetCount() const noexcept
+        {
+            const UInt64 head = m_Head.load(std::memory_order_acquire);
+            const UInt64 tail = m_Tail.load(std::memory_order_acquire);
+
+            return tail - head;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @return True if the queue is empty, false otherwise.
+         *
+         * @note While the other thread is running, the result may already be out of date when it is returned.
+         */
+        [[nodiscard]] OTR_INLINE bool IsEmpty() const noexcept { return GetCount() == 0; }
+
+    private:
+        static constexpr UInt64 k_Mask = Capacity - 1;
+
+        // The indices only ever grow, and are wrapped into the buffer when an item is accessed
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) std::atomic<UInt64> m_Tail{ 0 };
+        UInt64 m_CachedHead = 0;
+
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) std::atomic<UInt64> m_Head{ 0 };
+        UInt64 m_CachedTail = 0;
+
+        alignas(OTR_PLATFORM_CACHE_LINE_SIZE) T m_Items[Capacity]{ };
+
+        /**
+         * @brief Checks on the producer thread whether a number of items fit into the queue. The consumer's index is
+         * only loaded again when the cached one says that they do not.
+         *
+         * @param tail The producer's index.
+         * @param count The number of items.
+         *
+         * @return True if the items fit, false otherwise.
+         */
+        OTR_INLINE bool HasSpace(const UInt64 tail, const UInt64 count) noexcept
+        {
+            if (Capacity - (tail - m_CachedHead) >= count)
+                return true;
+
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+
+            return Capacity - (tail - m_CachedHead) >= count;
+        }
+
+        /**
+         * @brief Checks on the consumer thread whether the queue holds a number of items. The producer's index is
+         * only loaded again when the cached one says that it does not.
+         *
+         * @param head The consumer's index.
+         * @param count The number of items.
+         *
+         * @return True if the queue holds the items, false otherwise.
+         */
+        OTR_INLINE bool HasItems(const UInt64 head, const UInt64 count) noexcept
+        {
+            if (m_CachedTail - head >= count)
+                return true;
+
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+
+            return m_CachedTail - head >= count;
+        }
+    };
+}
+
+#endif //OTTERENGINE_SPSCQUEUE_H
@@ -171,6 +171,14 @@ namespace Otter
          */
         OTR_INLINE ConstIterator crend() const noexcept { return ConstIterator(base::m_Data - 1); }
     };
+
+    /**
+     * @brief The items of a stack live on the heap, so moving its bytes moves the stack.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable<Stack<T>> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_STACK_H
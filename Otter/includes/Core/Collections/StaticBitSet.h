@@ -0,0 +1,251 @@
+#ifndef OTTERENGINE_STATICBITSET_H
+#define OTTERENGINE_STATICBITSET_H
+
+#include <bit>
+
+#include "Core/Defines.h"
+#include "Core/BaseTypes.h"
+#include "Core/Assert.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define OTR_STATIC_BITSET_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define OTR_STATIC_BITSET_SSE2 0
+#endif
+
+namespace Otter
+{
+    /**
+     * @brief A bitset whose size is fixed at compile time. The bits are stored inline, so the bitset never allocates
+     * and is trivially copyable, which makes it cheap to copy around and to use as the key of a hash collection.
+     *
+     * @tparam BitCount The number of bits.
+     *
+     * @note Under the hood, the bitset uses an array of 64-bit unsigned integers, which are compared two at a time
+     * with SSE2 where it is available.
+     */
+    template<UInt64 BitCount>
+    class StaticBitSet final
+    {
+        OTR_STATIC_ASSERT(BitCount > 0, "StaticBitSet must have at least one bit.")
+
+    public:
+        /**
+         * @brief Constructor.
+         */
+        StaticBitSet() = default;
+
+        /**
+         * @brief Equality operator.
+         *
+         * @param other StaticBitSet to compare to.
+         *
+         * @return True if the bitsets are equal, false otherwise.
+         */
+        [[nodiscard]] bool operator==(const StaticBitSet<BitCount>& other) const noexcept
+        {
+            UInt64 i = 0;
+
+#if OTR_STATIC_BITSET_SSE2
+            __m128i difference = _mm_setzero_si128();
+            for (; i + k_WordsPerVector <= k_WordCount; i += k_WordsPerVector)
+                difference = _mm_or_si128(difference, _mm_xor_si128(LoadVector(m_Words + i),
+                                                                     LoadVector(other.m_Words + i)));
+
+            if (!IsZero(difference))
+                return false;
+#endif
+
+            for (; i < k_WordCount; i++)
+                if (m_Words[i] != other.m_Words[i])
+                    return false;
+
+            return true;
+        }
+
+        /**
+         * @brief Inequality operator.
+         *
+         * @param other StaticBitSet to compare to.
+         *
+         * @return True if the bitsets are not equal, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool operator!=(const StaticBitSet<BitCount>& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Gets the bit at the specified index.
+         *
+         * @param index The index.
+         *
+         * @return The bit at the specified index.
+         */
+        [[nodiscard]] OTR_INLINE bool Get(const UInt64 index) const
+        {
+            OTR_INTERNAL_ASSERT_MSG(index < BitCount, "Index out of range")
+
+            return (m_Words[index / 64] & (1ULL << (index % 64))) != 0;
+        }
+
+        /**
+         * @brief Sets the bit at the specified index.
+         *
+         * @param index The index.
+         * @param value The value to set.
+         */
+        OTR_INLINE void Set(const UInt64 index, const bool value)
+        {
+            OTR_INTERNAL_ASSERT_MSG(index < BitCount, "Index out of range")
+
+            if (value)
+                m_Words[index / 64] |= (1ULL << (index % 64));
+            else
+                m_Words[index / 64] &= ~(1ULL << (index % 64));
+        }
+
+        /**
+         * @brief Checks if the bitset includes another bitset, which means that every bit that is set in the other
+         * bitset is also set in this one.
+         *
+         * @param other The other bitset.
+         *
+         * @return True if the bitset includes the other bitset, false otherwise.
+         */
+        [[nodiscard]] bool Includes(const StaticBitSet<BitCount>& other) const noexcept
+        {
+            UInt64 i = 0;
+
+#if OTR_STATIC_BITSET_SSE2
+            __m128i missing = _mm_setzero_si128();
+            for (; i + k_WordsPerVector <= k_WordCount; i += k_WordsPerVector)
+                missing = _mm_or_si128(missing, _mm_andnot_si128(LoadVector(m_Words + i),
+                                                                 LoadVector(other.m_Words + i)));
+
+            if (!IsZero(missing))
+                return false;
+#endif
+
+            for (; i < k_WordCount; i++)
+                if ((other.m_Words[i] & ~m_Words[i]) != 0)
+                    return false;
+
+            return true;
+        }
+
+        /**
+         * @brief Checks if the bitset has any bit set that is also set in another bitset.
+         *
+         * @param other The other bitset.
+         *
+         * @return True if the bitsets have a bit in common, false otherwise.
+         */
+        [[nodiscard]] bool Intersects(const StaticBitSet<BitCount>& other) const noexcept
+        {
+            for (UInt64 i = 0; i < k_WordCount; i++)
+                if ((m_Words[i] & other.m_Words[i]) != 0)
+                    return true;
+
+            return false;
+        }
+
+        /**
+         * @brief Calls a callback for every bit that is set, in ascending order.
+         *
+         * @tparam TCallback The type of the callback.
+         *
+         * @param callback The callback, which takes the index of the bit.
+         */
+        template<typename TCallback>
+        void ForEachSetBit(TCallback&& callback) const
+        {
+            for (UInt64 i = 0; i < k_WordCount; i++)
+                for (UInt64 word = m_Words[i]; word != 0; word &= word - 1)
+                    callback(i * 64 + std::countr_zero(word));
+        }
+
+        /**
+         * @brief Clears the bitset.
+         */
+        OTR_INLINE void Clear() noexcept
+        {
+            for (UInt64& word: m_Words)
+                word = 0;
+        }
+
+        /**
+         * @brief Gets the size of the bitset in bits.
+         *
+         * @return The size of the bitset in bits.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetBitsSize() noexcept { return BitCount; }
+
+        /**
+         * @brief Gets the amount of bits set to true.
+         *
+         * @return The amount of bits set to true.
+         */
+        [[nodiscard]] UInt64 GetTrueCount() const noexcept
+        {
+            UInt64 count = 0;
+
+            for (const UInt64 word: m_Words)
+                count += std::popcount(word);
+
+            return count;
+        }
+
+        /**
+         * @brief Gets the hash code of the bitset. Each word is mixed in with one xor and one multiply.
+         *
+         * @return Hash code of the bitset.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetHashCode() const noexcept
+        {
+            UInt64 hash = 0;
+
+            for (const UInt64 word: m_Words)
+                hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+
+            return hash;
+        }
+
+    private:
+        static constexpr UInt64 k_WordCount = (BitCount + 63) / 64;
+
+        UInt64 m_Words[k_WordCount]{ };
+
+#if OTR_STATIC_BITSET_SSE2
+        /// @brief The number of words that are compared at once with SSE2.
+        static constexpr UInt64 k_WordsPerVector = sizeof(__m128i) / sizeof(UInt64);
+
+        /**
+         * @brief Loads a vector of words, which do not need to be aligned.
+         *
+         * @param words The first word.
+         *
+         * @return The vector.
+         */
+        OTR_INLINE static __m128i LoadVector(const UInt64* const words) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(words));
+        }
+
+        /**
+         * @brief Checks whether every bit of a vector is zero.
+         *
+         * @param vector The vector.
+         *
+         * @return True if every bit is zero, false otherwise.
+         */
+        OTR_INLINE static bool IsZero(const __m128i vector) noexcept
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(vector, _mm_setzero_si128())) == 0xFFFF;
+        }
+#endif
+    };
+}
+
+#endif //OTTERENGINE_STATICBITSET_H
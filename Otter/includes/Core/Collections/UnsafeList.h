@@ -13,6 +13,8 @@ namespace Otter
     /**
      * @brief An unsafe list of items. The items are stored in a contiguous memory block on the heap. Use only when
      * the type of the items is known beforehand but the use of a templated list is not wanted.
+     *
+     * @note The memory block is relocatable, so pointers to the items are invalidated by MemorySystem::Defragment.
      */
     class UnsafeList final
     {
@@ -28,9 +30,7 @@ namespace Otter
         ~UnsafeList()
         {
             if (IsCreated())
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
-
-            m_Data = nullptr;
+                MemorySystem::FreeRelocatable(m_Data);
         }
 
         /**
@@ -47,11 +47,10 @@ namespace Otter
             if (m_Capacity == 0)
                 return;
 
-            auto handle = Unsafe::New(m_Capacity * m_Offset);
-            m_Data = (Byte*) handle.Pointer;
+            m_Data = AllocateData(m_Capacity * m_Offset);
 
             if (other.IsCreated() && !other.IsEmpty())
-                MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Count * m_Offset);
+                MemorySystem::MemoryCopy(GetData(), other.GetData(), m_Count * m_Offset);
         }
 
         /**
@@ -66,7 +65,7 @@ namespace Otter
             m_Count    = other.m_Count;
             m_Offset   = other.m_Offset;
 
-            other.m_Data     = nullptr;
+            other.m_Data     = { };
             other.m_Capacity = 0;
             other.m_Count    = 0;
             other.m_Offset   = 0;
@@ -81,7 +80,7 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
+                MemorySystem::FreeRelocatable(m_Data);
 
             m_Capacity = other.m_Capacity;
             m_Count    = other.m_Count;
@@ -90,11 +89,10 @@ namespace Otter
             if (m_Capacity == 0)
                 return *this;
 
-            auto handle = Unsafe::New(m_Capacity * m_Offset);
-            m_Data = (Byte*) handle.Pointer;
+            m_Data = AllocateData(m_Capacity * m_Offset);
 
             if (other.IsCreated() && !other.IsEmpty())
-                MemorySystem::MemoryCopy(m_Data, other.m_Data, m_Count * m_Offset);
+                MemorySystem::MemoryCopy(GetData(), other.GetData(), m_Count * m_Offset);
 
             return *this;
         }
@@ -108,14 +106,14 @@ namespace Otter
                 return *this;
 
             if (IsCreated())
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
+                MemorySystem::FreeRelocatable(m_Data);
 
             m_Data     = other.m_Data;
             m_Capacity = other.m_Capacity;
             m_Count    = other.m_Count;
             m_Offset   = other.m_Offset;
 
-            other.m_Data     = nullptr;
+            other.m_Data     = { };
             other.m_Capacity = 0;
             other.m_Count    = 0;
             other.m_Offset   = 0;
@@ -163,7 +161,7 @@ namespace Otter
         {
             OTR_ASSERT(index < m_Count, "Index out of range")
 
-            return reinterpret_cast<T*>(m_Data + (index * m_Offset));
+            return reinterpret_cast<T*>(GetData<Byte>() + (index * m_Offset));
         }
 
         /**
@@ -197,10 +195,9 @@ namespace Otter
             if (unsafeList.m_Capacity == 0)
                 return unsafeList;
 
-            auto handle = Unsafe::New(unsafeList.m_Capacity * unsafeList.m_Offset);
-            unsafeList.m_Data = (Byte*) handle.Pointer;
+            unsafeList.m_Data = AllocateData(unsafeList.m_Capacity * unsafeList.m_Offset);
 
-            MemorySystem::MemoryCopy(unsafeList.m_Data, list.begin(), unsafeList.m_Count * unsafeList.m_Offset);
+            MemorySystem::MemoryCopy(unsafeList.GetData(), list.begin(), unsafeList.m_Count * unsafeList.m_Offset);
 
             return unsafeList;
         }
@@ -227,7 +224,7 @@ namespace Otter
             if (index >= m_Count)
                 return false;
 
-            *outItem = *reinterpret_cast<const T*>(m_Data + (index * m_Offset));
+            *outItem = *reinterpret_cast<const T*>(GetData<Byte>() + (index * m_Offset));
 
             return true;
         }
@@ -250,7 +247,7 @@ namespace Otter
             if (index >= m_Count)
                 return false;
 
-            MemorySystem::MemoryCopy(outItem, m_Data + (index * m_Offset), m_Offset);
+            MemorySystem::MemoryCopy(outItem, GetData<Byte>() + (index * m_Offset), m_Offset);
 
             return true;
         }
@@ -282,7 +279,7 @@ namespace Otter
             if (m_Count >= m_Capacity)
                 Expand();
 
-            MemorySystem::MemoryCopy(m_Data + (m_Count * m_Offset), data, m_Offset);
+            MemorySystem::MemoryCopy(GetData<Byte>() + (m_Count * m_Offset), data, m_Offset);
             m_Count++;
         }
 
@@ -313,7 +310,7 @@ namespace Otter
             if (m_Count >= m_Capacity)
                 Expand();
 
-            MemorySystem::MemoryCopy((void*) (m_Data + (m_Count * m_Offset)), (void*) &item, m_Offset);
+            MemorySystem::MemoryCopy((void*) (GetData<Byte>() + (m_Count * m_Offset)), (void*) &item, m_Offset);
             m_Count++;
         }
 
@@ -344,7 +341,7 @@ namespace Otter
             if (m_Count >= m_Capacity)
                 Expand();
 
-            MemorySystem::MemoryCopy((void*) (m_Data + (m_Count * m_Offset)), (void*) &item, m_Offset);
+            MemorySystem::MemoryCopy((void*) (GetData<Byte>() + (m_Count * m_Offset)), (void*) &item, m_Offset);
             m_Count++;
         }
 
@@ -378,11 +375,11 @@ namespace Otter
             if (index >= m_Capacity - 1 || m_Count >= m_Capacity - 1)
                 return false;
 
-            MemorySystem::MemoryMove(m_Data + ((index + 1) * m_Offset),
-                                     m_Data + (index * m_Offset),
+            MemorySystem::MemoryMove(GetData<Byte>() + ((index + 1) * m_Offset),
+                                     GetData<Byte>() + (index * m_Offset),
                                      (m_Count - index) * m_Offset);
 
-            MemorySystem::MemoryCopy(m_Data + (index * m_Offset), &item, m_Offset);
+            MemorySystem::MemoryCopy(GetData<Byte>() + (index * m_Offset), &item, m_Offset);
             m_Count++;
 
             return true;
@@ -418,11 +415,11 @@ namespace Otter
             if (index >= m_Capacity || m_Count >= m_Capacity)
                 return false;
 
-            MemorySystem::MemoryMove(m_Data + ((index + 1) * m_Offset),
-                                     m_Data + (index * m_Offset),
+            MemorySystem::MemoryMove(GetData<Byte>() + ((index + 1) * m_Offset),
+                                     GetData<Byte>() + (index * m_Offset),
                                      (m_Count - index) * m_Offset);
 
-            MemorySystem::MemoryCopy(m_Data + (index * m_Offset), &item, m_Offset);
+            MemorySystem::MemoryCopy(GetData<Byte>() + (index * m_Offset), &item, m_Offset);
             m_Count++;
 
             return true;
@@ -541,7 +538,7 @@ namespace Otter
             )
 
             for (UInt64 i = 0; i < m_Count; i++)
-                if (*reinterpret_cast<T*>(m_Data + (i * m_Offset)) == item)
+                if (*reinterpret_cast<T*>(GetData<Byte>() + (i * m_Offset)) == item)
                     return TryRemoveAt(i);
 
             return false;
@@ -560,8 +557,8 @@ namespace Otter
                 return false;
 
             if (index != m_Count - 1)
-                MemorySystem::MemoryCopy(m_Data + (index * m_Offset),
-                                         m_Data + ((m_Count - 1) * m_Offset),
+                MemorySystem::MemoryCopy(GetData<Byte>() + (index * m_Offset),
+                                         GetData<Byte>() + ((m_Count - 1) * m_Offset),
                                          m_Offset);
 
             m_Count--;
@@ -596,7 +593,7 @@ namespace Otter
             )
 
             for (UInt64 i = 0; i < m_Count; i++)
-                if (*reinterpret_cast<T*>(m_Data + (i * m_Offset)) == item)
+                if (*reinterpret_cast<T*>(GetData<Byte>() + (i * m_Offset)) == item)
                     return true;
 
             return false;
@@ -630,7 +627,7 @@ namespace Otter
             )
 
             for (UInt64 i = 0; i < m_Count; i++)
-                if (*reinterpret_cast<T*>(m_Data + (i * m_Offset)) == item)
+                if (*reinterpret_cast<T*>(GetData<Byte>() + (i * m_Offset)) == item)
                 {
                     *outIndex = i;
                     return true;
@@ -660,17 +657,13 @@ namespace Otter
         {
             UInt64 newCapacity = CalculateExpandCapacity(amount);
 
-            auto handle = Unsafe::New(newCapacity * m_Offset);
-
             if (IsCreated())
-            {
-                if (!IsEmpty())
-                    MemorySystem::MemoryCopy(handle.Pointer, m_Data, m_Count * m_Offset);
-
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
-            }
+                MemorySystem::ReallocateRelocatable(m_Data,
+                                                    OTR_ALIGNED_OFFSET(newCapacity * m_Offset,
+                                                                       OTR_PLATFORM_MEMORY_ALIGNMENT));
+            else
+                m_Data = AllocateData(newCapacity * m_Offset);
 
-            m_Data     = (Byte*) handle.Pointer;
             m_Capacity = newCapacity;
         }
 
@@ -690,19 +683,13 @@ namespace Otter
                 return;
             }
 
-            auto handle = Unsafe::New(newCapacity * m_Offset);
-
             if (IsCreated())
-            {
-                auto minCount = m_Count < newCapacity
-                                ? m_Count
-                                : newCapacity;
-
-                MemorySystem::MemoryCopy(handle.Pointer, m_Data, minCount * m_Offset);
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
-            }
+                MemorySystem::ReallocateRelocatable(m_Data,
+                                                    OTR_ALIGNED_OFFSET(newCapacity * m_Offset,
+                                                                       OTR_PLATFORM_MEMORY_ALIGNMENT));
+            else
+                m_Data = AllocateData(newCapacity * m_Offset);
 
-            m_Data     = (Byte*) handle.Pointer;
             m_Capacity = newCapacity;
 
             if (m_Count >= newCapacity)
@@ -720,9 +707,9 @@ namespace Otter
         void ClearDestructive()
         {
             if (IsCreated())
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
+                MemorySystem::FreeRelocatable(m_Data);
 
-            m_Data     = nullptr;
+            m_Data     = { };
             m_Capacity = 0;
             m_Count    = 0;
         }
@@ -741,7 +728,7 @@ namespace Otter
             MemorySystem::CheckMemoryFootprint([&]()
                                                {
                                                    MemoryDebugPair pair[1];
-                                                   pair[0] = { debugName, m_Data };
+                                                   pair[0] = { debugName, GetData() };
 
                                                    return MemoryDebugHandle{ pair, 1 };
                                                },
@@ -766,9 +753,9 @@ namespace Otter
         [[nodiscard]] OTR_INLINE T* GetData() const noexcept
         {
             if constexpr (IsVoid<T>)
-                return (void*) m_Data;
+                return m_Data.Get();
             else
-                return reinterpret_cast<T*>(m_Data);
+                return reinterpret_cast<T*>(m_Data.Get());
         }
 
         /**
@@ -798,7 +785,7 @@ namespace Otter
          *
          * @return True if the list has been created, false otherwise.
          */
-        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Data && m_Capacity > 0; }
+        [[nodiscard]] OTR_INLINE bool IsCreated() const noexcept { return m_Data.IsValid() && m_Capacity > 0; }
 
         /**
          * @brief Checks whether the list is empty.
@@ -819,11 +806,26 @@ namespace Otter
             OTR_ASSERT(offset > 0, "The offset of the list items must be greater than 0.")
         }
 
-        Byte* m_Data = nullptr;
+        RelocatableHandle m_Data;
         UInt64 m_Count    = 0;
         UInt64 m_Capacity = 0;
         UInt64 m_Offset   = 0;
 
+        /**
+         * @brief Allocates a relocatable block for the data of the list.
+         *
+         * @param size The size of the block in bytes.
+         *
+         * @return The handle to the block.
+         */
+        OTR_INLINE static RelocatableHandle AllocateData(const UInt64 size)
+        {
+            return MemorySystem::AllocateRelocatable(OTR_ALIGNED_OFFSET(size, OTR_PLATFORM_MEMORY_ALIGNMENT),
+                                                     OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                     AllocationFlags::Uninitialised,
+                                                     MemoryTag::Collections);
+        }
+
         /**
          * @brief Tries to add data to the buffer.
          *
@@ -849,7 +851,7 @@ namespace Otter
                 Expand(size - (m_Capacity - m_Count));
             }
 
-            MemorySystem::MemoryCopy(m_Data + (m_Count * m_Offset), data, size * m_Offset);
+            MemorySystem::MemoryCopy(GetData<Byte>() + (m_Count * m_Offset), data, size * m_Offset);
             m_Count += size;
 
             return true;
@@ -863,7 +865,7 @@ namespace Otter
         void RecreateEmpty(const UInt64 capacity)
         {
             if (IsCreated())
-                Unsafe::Delete({ m_Data, m_Capacity * m_Offset });
+                MemorySystem::FreeRelocatable(m_Data);
 
             m_Capacity = capacity;
             m_Count    = 0;
@@ -871,8 +873,7 @@ namespace Otter
             if (m_Capacity == 0)
                 return;
 
-            auto handle = Unsafe::New(m_Capacity * m_Offset);
-            m_Data = (Byte*) handle.Pointer;
+            m_Data = AllocateData(m_Capacity * m_Offset);
         }
 
         /**
@@ -924,6 +925,14 @@ namespace Otter
             return newCapacity;
         }
     };
+
+    /**
+     * @brief The handle of an unsafe list stays valid wherever the list lives, so it can be moved bytewise.
+     */
+    template<>
+    struct IsTriviallyRelocatable<UnsafeList> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_UNSAFELIST_H
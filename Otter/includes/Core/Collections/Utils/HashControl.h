@@ -0,0 +1,357 @@
+#ifndef OTTERENGINE_HASHCONTROL_H
+#define OTTERENGINE_HASHCONTROL_H
+
+#include <bit>
+
+#include "Core/BaseTypes.h"
+#include "Core/Defines.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define OTR_HASH_GROUP_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define OTR_HASH_GROUP_SSE2 0
+#endif
+
+namespace Otter::Internal
+{
+    /**
+     * @brief Utilities for the control bytes of an open-addressing hash table. Every slot of the table has a control
+     * byte that is either empty, deleted, or holds the low 7 bits of the hash of the item in the slot, so that a
+     * lookup only compares the items whose control byte matches.
+     */
+    class HashControl final
+    {
+    public:
+        /// @brief The control byte of a slot that has never held an item since the table was last rehashed.
+        static constexpr Int8 k_Empty = -128;
+
+        /// @brief The control byte of a slot whose item was removed while a lookup may still probe past it.
+        static constexpr Int8 k_Deleted = -2;
+
+        /// @brief The number of slots whose control bytes are matched at once.
+        static constexpr UInt64 k_GroupSize = 16;
+
+        /**
+         * @brief Scrambles a hash code, so that hash codes that only differ in their high bits, such as the
+         * identity hash of small integers, still spread across the whole table.
+         *
+         * @param hash The hash code.
+         *
+         * @return The scrambled hash.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 Mix(UInt64 hash) noexcept
+        {
+            hash ^= hash >> 33;
+            hash *= 0xFF51AFD7ED558CCDull;
+            hash ^= hash >> 33;
+
+            return hash;
+        }
+
+        /**
+         * @brief Gets the part of a hash that selects the group where probing starts.
+         *
+         * @param hash The scrambled hash.
+         *
+         * @return The group part of the hash.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetH1(const UInt64 hash) noexcept { return hash >> 7; }
+
+        /**
+         * @brief Gets the part of a hash that is stored in the control byte of a slot.
+         *
+         * @param hash The scrambled hash.
+         *
+         * @return The control byte of a slot that holds an item with the hash.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr Int8 GetH2(const UInt64 hash) noexcept
+        {
+            return (Int8) (hash & 0x7F);
+        }
+
+        /**
+         * @brief Checks whether a control byte belongs to a slot that holds an item.
+         *
+         * @param control The control byte.
+         *
+         * @return True if the slot holds an item, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr bool IsFull(const Int8 control) noexcept { return control >= 0; }
+
+        /**
+         * @brief Gets the number of control bytes of a table. Tables smaller than a group still have a whole group
+         * of control bytes, the ones past the capacity stay empty.
+         *
+         * @param capacity The capacity of the table.
+         *
+         * @return The number of control bytes.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetControlSize(const UInt64 capacity) noexcept
+        {
+            return capacity < k_GroupSize ? k_GroupSize : capacity;
+        }
+
+        /**
+         * @brief Gets the number of groups of a table.
+         *
+         * @param capacity The capacity of the table.
+         *
+         * @return The number of groups.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetGroupCount(const UInt64 capacity) noexcept
+        {
+            return capacity < k_GroupSize ? 1 : capacity / k_GroupSize;
+        }
+
+        /**
+         * @brief Gets the mask of the slots of a group that lie within the capacity of a table.
+         *
+         * @param capacity The capacity of the table.
+         *
+         * @return The mask of the slots.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt32 GetGroupMask(const UInt64 capacity) noexcept
+        {
+            return capacity < k_GroupSize ? (1u << capacity) - 1 : 0xFFFF;
+        }
+
+        /**
+         * @brief Gets the number of items that a table can hold before it has to grow. The table is kept at most 7/8
+         * full, so that probing stays short.
+         *
+         * @param capacity The capacity of the table.
+         *
+         * @return The number of items.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetGrowthLimit(const UInt64 capacity) noexcept
+        {
+            return capacity - (capacity < 8 ? 1 : capacity / 8);
+        }
+
+        /**
+         * @brief Gets the smallest capacity of a table that can hold a number of items without growing.
+         *
+         * @param count The number of items.
+         * @param minCapacity The smallest capacity to return. Must be a power of two.
+         *
+         * @return The capacity, a power of two.
+         */
+        [[nodiscard]] OTR_INLINE static constexpr UInt64 GetCapacityFor(const UInt64 count,
+                                                                        const UInt64 minCapacity) noexcept
+        {
+            UInt64 capacity = minCapacity;
+            while (GetGrowthLimit(capacity) < count)
+                capacity *= 2;
+
+            return capacity;
+        }
+
+        /**
+         * @brief Finds the first slot at or after a given index that holds an item. The control bytes are scanned a
+         * whole group at a time.
+         *
+         * @param control The control bytes of the table.
+         * @param index The index to start from.
+         * @param capacity The capacity of the table.
+         *
+         * @return The index of the slot, or the capacity if there is none.
+         */
+        [[nodiscard]] static UInt64 FindNextFull(const Int8* control, UInt64 index, UInt64 capacity) noexcept;
+
+        /**
+         * @brief Finds the last slot at or before a given index that holds an item. The control bytes are scanned a
+         * whole group at a time.
+         *
+         * @param control The control bytes of the table.
+         * @param index The index to start from.
+         * @param capacity The capacity of the table.
+         *
+         * @return The index of the slot, or -1 if there is none.
+         */
+        [[nodiscard]] static Int64 FindPreviousFull(const Int8* control, Int64 index, UInt64 capacity) noexcept;
+
+    private:
+        /**
+         * @brief Constructor.
+         */
+        HashControl() = default;
+
+        /**
+         * @brief Destructor.
+         */
+        ~HashControl() = default;
+    };
+
+    /**
+     * @brief A group of control bytes that are matched at once, with SSE2 where it is available. Each match returns
+     * a bit mask, where bit i is set if the i-th slot of the group matches.
+     */
+    class HashGroup final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param control The first control byte of the group.
+         */
+        explicit HashGroup(const Int8* const control) noexcept
+#if OTR_HASH_GROUP_SSE2
+            : m_Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control)))
+#else
+            : m_Control(control)
+#endif
+        {
+        }
+
+        /**
+         * @brief Matches the slots whose control byte holds the given part of a hash.
+         *
+         * @param h2 The part of the hash that is stored in control bytes.
+         *
+         * @return The mask of the matching slots.
+         */
+        [[nodiscard]] OTR_INLINE UInt32 Match(const Int8 h2) const noexcept
+        {
+#if OTR_HASH_GROUP_SSE2
+            return (UInt32) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Control));
+#else
+            UInt32 mask = 0;
+            for (UInt64 i = 0; i < HashControl::k_GroupSize; i++)
+                mask |= (UInt32) (m_Control[i] == h2) << i;
+
+            return mask;
+#endif
+        }
+
+        /**
+         * @brief Matches the empty slots.
+         *
+         * @return The mask of the empty slots.
+         */
+        [[nodiscard]] OTR_INLINE UInt32 MatchEmpty() const noexcept { return Match(HashControl::k_Empty); }
+
+        /**
+         * @brief Matches the slots that do not hold an item.
+         *
+         * @return The mask of the empty and deleted slots.
+         */
+        [[nodiscard]] OTR_INLINE UInt32 MatchEmptyOrDeleted() const noexcept
+        {
+#if OTR_HASH_GROUP_SSE2
+            // Both empty and deleted control bytes have their sign bit set, full ones do not
+            return (UInt32) _mm_movemask_epi8(m_Control);
+#else
+            UInt32 mask = 0;
+            for (UInt64 i = 0; i < HashControl::k_GroupSize; i++)
+                mask |= (UInt32) !HashControl::IsFull(m_Control[i]) << i;
+
+            return mask;
+#endif
+        }
+
+        /**
+         * @brief Matches the slots that hold an item.
+         *
+         * @return The mask of the full slots.
+         */
+        [[nodiscard]] OTR_INLINE UInt32 MatchFull() const noexcept { return ~MatchEmptyOrDeleted() & 0xFFFF; }
+
+    private:
+#if OTR_HASH_GROUP_SSE2
+        __m128i m_Control;
+#else
+        const Int8* m_Control;
+#endif
+    };
+
+    OTR_INLINE UInt64 HashControl::FindNextFull(const Int8* const control,
+                                                UInt64 index,
+                                                const UInt64 capacity) noexcept
+    {
+        // Dense tables mostly have their next item in the very next slot
+        if (index < capacity && IsFull(control[index]))
+            return index;
+
+        const UInt32 groupMask = GetGroupMask(capacity);
+
+        while (index < capacity)
+        {
+            const UInt64 offset = index & ~(k_GroupSize - 1);
+            const UInt32 full   = HashGroup(control + offset).MatchFull() & groupMask & (0xFFFFu << (index - offset));
+
+            if (full != 0)
+                return offset + std::countr_zero(full);
+
+            index = offset + k_GroupSize;
+        }
+
+        return capacity;
+    }
+
+    OTR_INLINE Int64 HashControl::FindPreviousFull(const Int8* const control,
+                                                   Int64 index,
+                                                   const UInt64 capacity) noexcept
+    {
+        if (index >= 0 && IsFull(control[index]))
+            return index;
+
+        const UInt32 groupMask = GetGroupMask(capacity);
+
+        while (index >= 0)
+        {
+            const Int64  offset = index & ~(Int64) (k_GroupSize - 1);
+            const UInt32 tail   = 0xFFFFu >> (k_GroupSize - 1 - (index - offset));
+            const UInt32 full   = HashGroup(control + offset).MatchFull() & groupMask & tail;
+
+            if (full != 0)
+                return offset + 31 - std::countl_zero(full);
+
+            index = offset - 1;
+        }
+
+        return -1;
+    }
+
+    /**
+     * @brief The sequence of groups that a lookup visits. Groups are visited with triangular steps, which visit every
+     * group of a table exactly once when the number of groups is a power of two.
+     */
+    class HashProbe final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param h1 The part of the hash that selects the first group.
+         * @param groupCount The number of groups of the table. Must be a power of two.
+         */
+        HashProbe(const UInt64 h1, const UInt64 groupCount) noexcept
+            : m_Group(h1 & (groupCount - 1)), m_GroupMask(groupCount - 1)
+        {
+        }
+
+        /**
+         * @brief Gets the index of the first slot of the current group.
+         *
+         * @return The index of the slot.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetOffset() const noexcept { return m_Group * HashControl::k_GroupSize; }
+
+        /**
+         * @brief Moves to the next group of the sequence.
+         */
+        OTR_INLINE void Next() noexcept
+        {
+            m_Stride++;
+            m_Group = (m_Group + m_Stride) & m_GroupMask;
+        }
+
+    private:
+        UInt64 m_Group;
+        UInt64 m_GroupMask;
+        UInt64 m_Stride = 0;
+    };
+}
+
+#endif //OTTERENGINE_HASHCONTROL_H
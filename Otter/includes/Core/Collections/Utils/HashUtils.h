@@ -17,6 +17,9 @@ namespace Otter::Internal
          * @param value The value to get the next prime number after.
          *
          * @return The next prime number after the given value.
+         *
+         * @note Small values are looked up in a table of primes that grow by roughly 20% each. Values past the end of
+         * the table are searched for at runtime, so the result is the closest prime rather than the next table entry.
          */
         [[nodiscard]] static UInt64 GetNextPrime(UInt64 value);
 
@@ -26,6 +29,8 @@ namespace Otter::Internal
          * @param value The value to get the previous prime number before.
          *
          * @return The previous prime number before the given value.
+         *
+         * @note Values past the end of the table of primes are searched for at runtime.
          */
         [[nodiscard]] static UInt64 GetPreviousPrime(UInt64 value);
 
@@ -0,0 +1,62 @@
+#ifndef OTTERENGINE_HASHEDKEY_H
+#define OTTERENGINE_HASHEDKEY_H
+
+#include "Core/BaseTypes.h"
+#include "Core/Defines.h"
+
+namespace Otter
+{
+    /**
+     * @brief A key whose hash code is computed once, so that it can be looked up in several hash collections without
+     * hashing it again. This is worth it for keys whose hash loops over their contents, such as bit sets.
+     *
+     * @tparam TKey The type of the key.
+     *
+     * @note It only refers to the key, so the key must outlive it and must not change while it is in use.
+     */
+    template<typename TKey>
+    class HashedKey final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param key The key.
+         */
+        explicit HashedKey(const TKey& key)
+            : m_Key(key), m_HashCode(::GetHashCode(key))
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param key The key.
+         * @param hashCode The hash code of the key, as returned by GetHashCode.
+         */
+        HashedKey(const TKey& key, const UInt64 hashCode)
+            : m_Key(key), m_HashCode(hashCode)
+        {
+        }
+
+        /**
+         * @brief Gets the key.
+         *
+         * @return The key.
+         */
+        [[nodiscard]] OTR_INLINE const TKey& GetKey() const noexcept { return m_Key; }
+
+        /**
+         * @brief Gets the hash code of the key.
+         *
+         * @return The hash code.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetHashCode() const noexcept { return m_HashCode; }
+
+    private:
+        const TKey& m_Key;
+        UInt64 m_HashCode;
+    };
+}
+
+#endif //OTTERENGINE_HASHEDKEY_H
@@ -26,14 +26,7 @@ namespace Otter
         /**
          * @brief Destructor.
          */
-        ~KeyValuePair()
-        {
-            if constexpr (!std::is_trivially_destructible_v<TKey>)
-                Key.~TKey();
-
-            if constexpr (!std::is_trivially_destructible_v<TValue>)
-                Value.~TValue();
-        }
+        ~KeyValuePair() = default;
 
         /**
          * @brief Constructor.
@@ -29,7 +29,6 @@
     #error "Android is currently not supported!"
 #elif defined(__linux__)
     #define OTR_PLATFORM_LINUX 1
-    #error "Linux is currently not supported!"
 #else
     #error "Unsupported platform!"
 #endif
@@ -59,6 +58,7 @@
 #endif
 
 #define OTR_PLATFORM_MEMORY_ALIGNMENT 8
+#define OTR_PLATFORM_CACHE_LINE_SIZE 64
 
 // HELP: Compiler detection.
 
@@ -68,6 +68,8 @@
     #define OTR_DLLIMPORT
     #define OTR_INLINE inline
     #define OTR_DEBUG_BREAK() __builtin_trap()
+    #define OTR_RETURN_ADDRESS() __builtin_return_address(0)
+    #define OTR_PREFETCH(address) __builtin_prefetch(address)
 
 #elif defined(__clang__)
 
@@ -75,6 +77,8 @@
     #define OTR_DLLIMPORT
     #define OTR_INLINE inline
     #define OTR_DEBUG_BREAK() __builtin_trap()
+    #define OTR_RETURN_ADDRESS() __builtin_return_address(0)
+    #define OTR_PREFETCH(address) __builtin_prefetch(address)
 
 #elif defined(_MSC_VER)
 
@@ -86,6 +90,8 @@
     #define OTR_DLLIMPORT __declspec(dllimport)
     #define OTR_INLINE __forceinline
     #define OTR_DEBUG_BREAK() __debugbreak()
+    #define OTR_RETURN_ADDRESS() _ReturnAddress()
+    #define OTR_PREFETCH(address) _mm_prefetch((const char*) (address), 1)
 
 #else
 
@@ -7,14 +7,81 @@
 #include "Core/Function.h"
 
 #include "Core/Allocators/FreeListAllocator.h"
+#include "Core/Allocators/FrameAllocator.h"
+#include "Core/Allocators/PoolAllocator.h"
+#include "Core/Allocators/StackAllocator.h"
 #include "Core/Allocators/MemoryFootprint.h"
 
+// The list is left defined, so that tools that read memory traces can expand it into the tag names
+#define MEMORY_TAG_LIST                 \
+    REPLACE_WITH(ECS, 0x01)             \
+    REPLACE_WITH(Collections, 0x02)     \
+    REPLACE_WITH(Graphics, 0x03)        \
+    REPLACE_WITH(Events, 0x04)          \
+    REPLACE_WITH(Logger, 0x05)          \
+    REPLACE_WITH(User, 0x06)
+
 #define OTR_ALLOCATED_MEMORY(type, count)                                       \
     count * OTR_ALIGNED_OFFSET(sizeof(type), OTR_PLATFORM_MEMORY_ALIGNMENT) +   \
     Otter::FreeListAllocator::GetAllocatorHeaderSize()
 
 namespace Otter
 {
+    /**
+     * @brief Describes the initial contents of a newly allocated block of memory.
+     */
+    enum class AllocationFlags : UInt8
+    {
+        /// @brief The block is left as it is. Its contents are undefined and must be written before they are read.
+        Uninitialised = 0,
+        /// @brief The block is filled with zeroes.
+        Zeroed        = 1
+    };
+
+    /**
+     * @brief The category that an allocation is accounted to. The memory system keeps statistics and an optional
+     * budget for each tag, except for untagged allocations.
+     *
+     * @note A tagged block must be freed with the same tag and size that it was allocated with.
+     */
+    enum class MemoryTag : UInt8
+    {
+        /// @brief The allocation is not accounted to any category.
+        Untagged = 0x00,
+
+#define REPLACE_WITH(Item, Value) Item = Value,
+        MEMORY_TAG_LIST
+#undef REPLACE_WITH
+    };
+
+    /**
+     * @brief Describes what happens when an allocation would exceed the budget of its tag.
+     */
+    enum class MemoryBudgetPolicy : UInt8
+    {
+        /// @brief The allocation is performed and a warning is logged when the budget is first exceeded.
+        Warn = 0,
+        /// @brief The allocation is refused.
+        Fail = 1
+    };
+
+    /**
+     * @brief The allocation statistics of a memory tag.
+     */
+    struct MemoryTagStats final
+    {
+        /// @brief The number of bytes that are currently allocated with the tag.
+        UInt64 LiveBytes;
+        /// @brief The highest number of bytes that have been allocated with the tag at the same time.
+        UInt64 PeakBytes;
+        /// @brief The number of blocks that are currently allocated with the tag.
+        UInt64 AllocationCount;
+        /// @brief The number of allocations and reallocations that have been made with the tag.
+        UInt64 TotalAllocationCount;
+        /// @brief The budget of the tag in bytes, or 0 if it has no budget.
+        UInt64 Budget;
+    };
+
     /**
      * @brief Represents an unsafe handle to a resource and encapsulates a void pointer and the size of the resource.
      */
@@ -24,6 +91,45 @@ namespace Otter
         UInt64 Size;
     };
 
+    /**
+     * @brief A handle to a block of memory that the memory system may move to a lower address when it defragments
+     * its regions. The address of the block is looked up through the handle, and must not be kept across a call to
+     * MemorySystem::Defragment.
+     */
+    struct RelocatableHandle final
+    {
+        /// @brief The index of the block's entry in the relocation table, or 0 for a null handle.
+        UInt32 Index      = 0;
+        /// @brief The generation of the entry when the block was allocated, to catch handles that outlive it.
+        UInt32 Generation = 0;
+
+        /**
+         * @brief Gets the current address of the block.
+         *
+         * @return Pointer to the block, or nullptr if the handle is null.
+         */
+        [[nodiscard]] OTR_INLINE void* Get() const noexcept;
+
+        /**
+         * @brief Checks whether the handle refers to a block.
+         *
+         * @return True if the handle is not null, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool IsValid() const noexcept { return Index != 0; }
+
+        /**
+         * @brief Equality operator.
+         *
+         * @param other The handle to compare to.
+         *
+         * @return True if both handles refer to the same block, false otherwise.
+         */
+        OTR_INLINE bool operator==(const RelocatableHandle& other) const noexcept
+        {
+            return Index == other.Index && Generation == other.Generation;
+        }
+    };
+
     /**
      * @brief The application's memory system that manages the allocation and de-allocation of memory.
      */
@@ -58,37 +164,98 @@ namespace Otter
         /**
          * @brief Initialises the memory system.
          *
-         * @param memoryRequirements The amount of memory in bytes to allocate for the memory system.
+         * @param memoryRequirements The amount of memory in bytes to allocate for the memory system's first region.
+         * @param policy The allocation policy of the memory system's allocator.
+         * @param frameMemoryRequirements The amount of memory in bytes to allocate for per-frame scratch memory.
+         * @param stackMemoryRequirements The amount of memory in bytes to allocate for scoped scratch memory.
+         * @param memoryLimit The maximum amount of memory in bytes that the memory system may hold across all of its
+         * regions, or 0 for no limit.
+         *
+         * @note When the first region runs out, the memory system requests additional regions from the OS, each at
+         * least as large as the first one. Regions that become entirely free are returned to the OS, except for one
+         * that is kept as a spare.
          */
-        static void Initialise(UInt64 memoryRequirements);
+        static void Initialise(UInt64 memoryRequirements,
+                               FreeListAllocator::Policy policy = FreeListAllocator::Policy::FirstFit,
+                               UInt64 frameMemoryRequirements = 0,
+                               UInt64 stackMemoryRequirements = 0,
+                               UInt64 memoryLimit = 0);
 
         /**
          * @brief Shuts down the memory system.
          */
         static void Shutdown();
 
+        /**
+         * @brief Marks the beginning of a new frame, releasing the frame memory allocated two frames ago.
+         */
+        static void BeginFrame();
+
+        /**
+         * @brief Enables a thread cache for the calling thread. Small allocations and frees made by the thread
+         * are then served by the cache, without contending on the memory system's lock.
+         *
+         * @note Memory held by a thread cache is reported as used memory.
+         * @note A thread that enables its cache must disable it before it exits.
+         */
+        static void EnableThreadCache();
+
+        /**
+         * @brief Disables the thread cache of the calling thread and returns its unused memory to the memory system.
+         */
+        static void DisableThreadCache();
+
         /**
          * @brief Allocates a block of memory.
          *
          * @param size The size of the memory block to allocate in bytes.
          * @param alignment The alignment of the memory block to allocate in bytes.
+         * @param flags The initial contents of the memory block.
+         * @param tag The category that the memory block is accounted to.
+         *
+         * @return An unsafe handle to the allocated memory block.
+         */
+        static UnsafeHandle Allocate(UInt64 size,
+                                     UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                     AllocationFlags flags = AllocationFlags::Uninitialised,
+                                     MemoryTag tag = MemoryTag::Untagged);
+
+        /**
+         * @brief Allocates a block of memory from the pool of its size class. Pools hand out fixed-size blocks in
+         * constant time and without a per-block header, which suits small objects that are created and destroyed
+         * often. The block is freed with Free.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         * @param flags The initial contents of the memory block.
+         * @param tag The category that the memory block is accounted to.
          *
          * @return An unsafe handle to the allocated memory block.
+         *
+         * @note Sizes above 256 bytes or alignments above 16 bytes are served by Allocate instead.
          */
-        static UnsafeHandle Allocate(UInt64 size, UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT);
+        static UnsafeHandle AllocatePooled(UInt64 size,
+                                           UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                           AllocationFlags flags = AllocationFlags::Uninitialised,
+                                           MemoryTag tag = MemoryTag::Untagged);
 
         /**
-         * @brief Reallocates a block of memory.
+         * @brief Reallocates a block of memory. Blocks of the global allocator are resized in place when the memory
+         * that follows them allows it, otherwise they are moved to a new block.
          *
          * @param handle The unsafe handle to the memory block to reallocate.
          * @param size The size of the memory block to reallocate in bytes.
          * @param alignment The alignment of the memory block to reallocate in bytes.
+         * @param flags The initial contents of the part of the memory block that the existing handle does not cover.
+         * @param tag The category that the memory block is accounted to.
          *
          * @return An unsafe handle to the reallocated memory block.
          */
         static UnsafeHandle Reallocate(UnsafeHandle& handle,
                                        UInt64 size,
-                                       UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT);
+                                       UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                       AllocationFlags flags = AllocationFlags::Uninitialised,
+                                       MemoryTag tag = MemoryTag::Untagged);
 
         /**
          * @brief Frees a block of memory.
@@ -97,6 +264,77 @@ namespace Otter
          */
         static void Free(void* block);
 
+        /**
+         * @brief Frees a block of memory of a known size.
+         *
+         * @param block The block of memory to free.
+         * @param size The size of the memory block in bytes.
+         * @param tag The category that the memory block was accounted to.
+         *
+         * @note When the engine is built with OTR_MEMORY_POISONING, the block is filled with a pattern before it is
+         * freed, so that reads through dangling pointers stand out.
+         */
+        static void Free(void* block, UInt64 size, MemoryTag tag = MemoryTag::Untagged);
+
+        /**
+         * @brief Allocates a block of memory that Defragment may move. Suits large buffers that are reached through
+         * their owner every time, such as the storage of collections.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         * @param flags The initial contents of the memory block.
+         * @param tag The category that the memory block is accounted to.
+         *
+         * @return A handle to the allocated memory block, or a null handle if the allocation failed.
+         */
+        static RelocatableHandle AllocateRelocatable(UInt64 size,
+                                                     UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                     AllocationFlags flags = AllocationFlags::Uninitialised,
+                                                     MemoryTag tag = MemoryTag::Untagged);
+
+        /**
+         * @brief Resizes a relocatable block of memory, in place if possible. The handle stays the same.
+         *
+         * @param handle The handle to the memory block to resize.
+         * @param size The new size of the memory block in bytes.
+         * @param flags The initial contents of the part of the memory block that was not covered before.
+         *
+         * @return True if the block was resized, false if it was left as it is.
+         */
+        static bool ReallocateRelocatable(const RelocatableHandle& handle,
+                                          UInt64 size,
+                                          AllocationFlags flags = AllocationFlags::Uninitialised);
+
+        /**
+         * @brief Frees a relocatable block of memory and resets its handle.
+         *
+         * @param handle The handle to the memory block to free.
+         */
+        static void FreeRelocatable(RelocatableHandle& handle);
+
+        /**
+         * @brief Gets the size of a relocatable block of memory.
+         *
+         * @param handle The handle to the memory block.
+         *
+         * @return The size of the memory block in bytes, or 0 if the handle is null.
+         */
+        [[nodiscard]] static UInt64 GetRelocatableSize(const RelocatableHandle& handle);
+
+        /**
+         * @brief Slides relocatable blocks of the global allocator towards the start of the memory system's regions,
+         * so that free memory is merged into larger blocks and emptied regions can be returned to the OS. Each call
+         * resumes where the previous one ran out of time, so the pass can be spread over several frames.
+         *
+         * @param budgetMicroseconds The time that the pass may take in microseconds.
+         *
+         * @return The number of bytes that were moved.
+         *
+         * @note Pointers that were retrieved from relocatable handles are invalidated. The pass should be run on the
+         * main thread, in the idle part of the frame, while no other thread reads relocatable blocks.
+         */
+        static UInt64 Defragment(UInt64 budgetMicroseconds);
+
         /**
          * @brief Copies a block of memory from one location to another.
          *
@@ -143,21 +381,92 @@ namespace Otter
          *
          * @return The amount of memory used by the memory system.
          */
-        [[nodiscard]] static constexpr UInt64 GetUsedMemory() { return s_Allocator.GetMemoryUsed(); }
+        [[nodiscard]] static UInt64 GetUsedMemory();
 
         /**
-         * @brief Gets the amount of free memory available to the memory system.
+         * @brief Gets the amount of free memory available to the memory system, across all of its regions.
          *
          * @return The amount of free memory available to the memory system.
          */
-        [[nodiscard]] static constexpr UInt64 GetFreeMemory() { return s_Allocator.GetMemoryFree(); }
+        [[nodiscard]] static UInt64 GetFreeMemory();
+
+        /**
+         * @brief Gets the total amount of memory held by the memory system, across all of its regions.
+         *
+         * @return The total amount of memory held by the memory system.
+         */
+        [[nodiscard]] static UInt64 GetMemorySize();
+
+        /**
+         * @brief Gets the number of memory regions that the memory system currently holds.
+         *
+         * @return The number of memory regions.
+         */
+        [[nodiscard]] static UInt64 GetRegionCount();
+
+        /**
+         * @brief Sets the budget of a memory tag. Allocations with the tag that would bring its live bytes above
+         * the budget are handled according to the policy.
+         *
+         * @param tag The memory tag. Must not be MemoryTag::Untagged.
+         * @param budget The budget in bytes, or 0 to remove the budget.
+         * @param policy What happens when the budget is exceeded.
+         */
+        static void SetMemoryBudget(MemoryTag tag, UInt64 budget, MemoryBudgetPolicy policy = MemoryBudgetPolicy::Warn);
+
+        /**
+         * @brief Gets the allocation statistics of a memory tag. Cheap enough to be polled every frame.
+         *
+         * @param tag The memory tag.
+         *
+         * @return The statistics of the tag. Untagged allocations are not accounted, so their statistics are empty.
+         */
+        [[nodiscard]] static MemoryTagStats GetMemoryTagStats(MemoryTag tag);
+
+        /**
+         * @brief Starts tracing every block that is allocated, freed or resized in the regions of the global
+         * allocator to a binary file. The file holds a MemoryTraceHeader, followed by MemoryTraceEvent records, and
+         * can be replayed offline by the trace analyser to study fragmentation.
+         *
+         * @param filePath The path of the trace file. An existing file is overwritten.
+         *
+         * @return True if tracing was started, false otherwise.
+         *
+         * @note Events are buffered and written to the file in batches. Blocks that were allocated before tracing
+         * started are unknown to the trace, so it should be started right after the memory system is initialised.
+         */
+        static bool StartTracing(const char* filePath);
+
+        /**
+         * @brief Writes the buffered trace events to the trace file.
+         */
+        static void FlushTrace();
+
+        /**
+         * @brief Stops tracing and closes the trace file.
+         */
+        static void StopTracing();
+
+        /**
+         * @brief Checks whether the memory system is tracing.
+         *
+         * @return True if tracing has been started, false otherwise.
+         */
+        [[nodiscard]] static bool IsTracing();
+
+        /**
+         * @brief Gets the amount of frame memory used by the memory system, across both frame buffers.
+         *
+         * @return The amount of frame memory used by the memory system.
+         */
+        [[nodiscard]] static constexpr UInt64 GetUsedFrameMemory() { return s_FrameAllocator.GetMemoryUsed(); }
 
         /**
-         * @brief Gets the total amount of memory available to the memory system.
+         * @brief Gets the amount of scoped scratch memory used by the memory system.
          *
-         * @return The total amount of memory available to the memory system.
+         * @return The amount of scoped scratch memory used by the memory system.
          */
-        [[nodiscard]] static constexpr UInt64 GetMemorySize() { return s_Allocator.GetMemorySize(); }
+        [[nodiscard]] static constexpr UInt64 GetUsedStackMemory() { return s_StackAllocator.GetMemoryUsed(); }
 
     private:
         /**
@@ -170,8 +479,307 @@ namespace Otter
          */
         ~MemorySystem() = default;
 
+        static constexpr UInt64 k_MaxRegionCount = 32;
+
         static bool              s_HasInitialised;
-        static FreeListAllocator s_Allocator;
+        static FreeListAllocator s_Regions[k_MaxRegionCount];
+        static void*             s_RegionBlocks[k_MaxRegionCount];
+        static UInt64            s_RegionCount;
+        static UInt64            s_MemoryLimit;
+
+        static FreeListAllocator::Policy s_Policy;
+        static FrameAllocator    s_FrameAllocator;
+        static StackAllocator    s_StackAllocator;
+
+        static constexpr UInt64 k_PoolBlockStep      = 16;
+        static constexpr UInt64 k_PoolCount          = 16;
+        static constexpr UInt16 k_PoolBlockAlignment = 16;
+
+        static PoolAllocator s_Pools[k_PoolCount];
+
+        /**
+         * @brief An entry of the relocation table, which maps a relocatable handle to the current address of its
+         * block. Entries are kept in fixed-size pages, so that they never move while handles are resolved.
+         */
+        struct RelocationEntry final
+        {
+            void*     Pointer;
+            UInt64    Size;
+            UInt32    Generation;
+            UInt32    NextFree;
+            UInt16    Alignment;
+            MemoryTag Tag;
+        };
+
+        static constexpr UInt32 k_RelocationPageSize     = 1024;
+        static constexpr UInt32 k_MaxRelocationPageCount = 1024;
+
+        static RelocationEntry* s_RelocationPages[k_MaxRelocationPageCount];
+        static UInt32           s_RelocationEntryCount;
+        static UInt32           s_FreeRelocationEntry;
+        static UInt32           s_DefragmentCursor;
+
+        /**
+         * @brief Gets the entry of the relocation table that a handle refers to.
+         *
+         * @param handle The handle. Must not be null.
+         *
+         * @return The entry of the handle.
+         */
+        OTR_INLINE static RelocationEntry& GetRelocationEntry(const RelocatableHandle& handle)
+        {
+            RelocationEntry& entry = s_RelocationPages[handle.Index / k_RelocationPageSize]
+                                                      [handle.Index % k_RelocationPageSize];
+            OTR_INTERNAL_ASSERT_MSG(entry.Generation == handle.Generation,
+                                    "Relocatable handle refers to a block that has been freed")
+
+            return entry;
+        }
+
+        /**
+         * @brief Allocates a block of memory that lives until it is freed, from the thread cache of the calling
+         * thread if it can hold the block, or from the global allocator otherwise.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the memory system cannot grow any further.
+         */
+        static void* AllocateLongLived(UInt64 size, UInt16 alignment);
+
+        /**
+         * @brief Allocates a block of memory from the regions of the global allocator, adding a new region if none
+         * of the existing ones can fit the block.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         *
+         * @return Pointer to the allocated memory block, or nullptr if the memory system cannot grow any further.
+         *
+         * @note The memory system's lock must be held by the caller.
+         */
+        static void* AllocateGlobal(UInt64 size, UInt16 alignment);
+
+        /**
+         * @brief Frees a block of memory back to the region of the global allocator that it belongs to.
+         *
+         * @param block The block of memory to free.
+         *
+         * @note The memory system's lock must be held by the caller.
+         */
+        static void FreeGlobal(void* block);
+
+        /**
+         * @brief Requests a new region from the OS. Regions are aligned to the span size within the block that is
+         * requested for them, so that no page of the page map is shared between two regions.
+         *
+         * @param size The minimum size of the region in bytes.
+         *
+         * @return The index of the new region, or k_MaxRegionCount if the region could not be added.
+         */
+        static UInt64 AddRegion(UInt64 size);
+
+        /**
+         * @brief Returns a region to the OS.
+         *
+         * @param index The index of the region.
+         */
+        static void RemoveRegion(UInt64 index);
+
+        /**
+         * @brief Routes the allocations of the calling thread to the frame allocator.
+         */
+        static void PushFrameMemoryScope();
+
+        /**
+         * @brief Stops routing the allocations of the calling thread to the frame allocator, once all scopes are
+         * popped.
+         */
+        static void PopFrameMemoryScope();
+
+        /**
+         * @brief Retrieves a marker to the current top of the scratch stack.
+         *
+         * @return The marker.
+         */
+        static StackAllocator::Marker GetStackMarker();
+
+        /**
+         * @brief Allocates a block of memory on top of the scratch stack.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         *
+         * @return Pointer to the allocated memory block, or nullptr if there is not enough stack memory.
+         */
+        static void* AllocateStack(UInt64 size, UInt16 alignment);
+
+        /**
+         * @brief Frees every block of memory that was allocated on the scratch stack after a marker was taken.
+         *
+         * @param marker The marker to roll back to.
+         */
+        static void FreeToStackMarker(StackAllocator::Marker marker);
+
+        /**
+         * @brief Allocates a span for a thread cache from the global allocator.
+         *
+         * @return Pointer to the span, or nullptr if there is not enough memory.
+         */
+        static void* AllocateThreadCacheSpan();
+
+        /**
+         * @brief Returns a span of a thread cache to the global allocator.
+         *
+         * @param span The span to return.
+         *
+         * @note The memory system's lock must be held by the caller.
+         */
+        static void FreeThreadCacheSpan(void* span);
+
+        friend class ThreadCache;
+        friend class FrameMemoryScope;
+        friend class StackMemoryScope;
+        friend struct RelocatableHandle;
+    };
+
+    OTR_INLINE void* RelocatableHandle::Get() const noexcept
+    {
+        return Index != 0 ? MemorySystem::GetRelocationEntry(*this).Pointer : nullptr;
+    }
+
+    /**
+     * @brief A scope guard that serves every allocation made through the memory system on the calling thread from
+     * per-frame scratch memory, for as long as it is alive. Such allocations cost a pointer bump, and freeing them
+     * does nothing.
+     *
+     * @note Memory allocated in the scope is only valid until the end of the next frame, so collections that are
+     * filled in the scope must not outlive it by more than that.
+     * @note The frame allocator is not synchronised, so scopes should only be opened on the main thread. If there is
+     * no frame memory, or it runs out, allocations fall back to the global allocator.
+     */
+    class FrameMemoryScope final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        FrameMemoryScope() { MemorySystem::PushFrameMemoryScope(); }
+
+        /**
+         * @brief Destructor.
+         */
+        ~FrameMemoryScope() { MemorySystem::PopFrameMemoryScope(); }
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        FrameMemoryScope(const FrameMemoryScope&) = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        FrameMemoryScope& operator=(const FrameMemoryScope&) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        FrameMemoryScope(FrameMemoryScope&&) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        FrameMemoryScope& operator=(FrameMemoryScope&&) = delete;
+    };
+
+    /**
+     * @brief A scope for nested scratch memory. Memory allocated through the scope is taken from the top of the
+     * memory system's scratch stack, and all of it is released at once when the scope ends, so short-lived work does
+     * not churn the global allocator with many small allocations and frees.
+     *
+     * @note Scopes must end in the reverse order that they began, and memory allocated through a scope must not be
+     * used after the scope ends.
+     * @note The scratch stack is not synchronised, so scopes should only be opened on the main thread. If there is
+     * no stack memory, or it runs out, allocations fall back to the global allocator and are freed with the scope.
+     */
+    class StackMemoryScope final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        StackMemoryScope()
+            : m_Marker(MemorySystem::GetStackMarker()), m_Overflow(nullptr)
+        {
+        }
+
+        /**
+         * @brief Destructor. Releases all the memory allocated through the scope.
+         */
+        ~StackMemoryScope();
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        StackMemoryScope(const StackMemoryScope&) = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        StackMemoryScope& operator=(const StackMemoryScope&) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        StackMemoryScope(StackMemoryScope&&) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        StackMemoryScope& operator=(StackMemoryScope&&) = delete;
+
+        /**
+         * @brief Allocates a block of memory that lives until the end of the scope.
+         *
+         * @param size The size of the memory block to allocate in bytes.
+         * @param alignment The alignment of the memory block to allocate in bytes.
+         *
+         * @return Pointer to the allocated memory block.
+         */
+        void* Allocate(UInt64 size, UInt16 alignment = OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+        /**
+         * @brief Allocates a buffer for a type that lives until the end of the scope.
+         *
+         * @tparam T The type to allocate memory for. Must be trivially destructible, since the scope releases the
+         * memory without destroying its contents.
+         *
+         * @param length The number of elements to allocate memory for.
+         *
+         * @return A pointer to the allocated buffer.
+         */
+        template<typename T>
+        OTR_INLINE T* New(const UInt64 length)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Scratch memory must hold trivially destructible types");
+
+            OTR_INTERNAL_ASSERT_MSG(length * sizeof(T) > 0, "Buffer length must be greater than 0")
+
+            constexpr UInt16 alignment = alignof(T) > OTR_PLATFORM_MEMORY_ALIGNMENT
+                                         ? alignof(T)
+                                         : OTR_PLATFORM_MEMORY_ALIGNMENT;
+
+            T* ptr = (T*) Allocate(length * sizeof(T), alignment);
+            if (!std::is_trivially_constructible_v<T>)
+                for (UInt64 i = 0; i < length; i++)
+                    ::new(&ptr[i]) T();
+
+            return ptr;
+        }
+
+    private:
+        StackAllocator::Marker m_Marker;
+        void* m_Overflow;
     };
 
     /**
@@ -208,10 +816,51 @@ namespace Otter
         if (!std::is_trivially_destructible_v<T> && ptr != nullptr)
             ptr->~T();
 
-        MemorySystem::MemoryClear(ptr, sizeof(T));
-        MemorySystem::Free(ptr);
+        MemorySystem::Free(ptr, OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT));
     }
 
+    /**
+     * @brief Used to allocate objects from the memory system's fixed-size pools. Objects are deallocated with Delete.
+     */
+    class Pool final
+    {
+    public:
+        /**
+         * @brief Allocates a block of memory for a type from the pool of its size.
+         *
+         * @tparam T The type to allocate memory for.
+         * @tparam TArgs The arguments to pass to the type's constructor.
+         *
+         * @param args The arguments to pass to the type's constructor.
+         *
+         * @return A pointer to the allocated memory block.
+         */
+        template<typename T, typename... TArgs>
+        OTR_INLINE static T* New(TArgs&& ... args)
+        {
+            constexpr UInt16 alignment = alignof(T) > OTR_PLATFORM_MEMORY_ALIGNMENT
+                                         ? alignof(T)
+                                         : OTR_PLATFORM_MEMORY_ALIGNMENT;
+
+            UnsafeHandle handle = MemorySystem::AllocatePooled(sizeof(T), alignment);
+            T* ptr = ::new(handle.Pointer) T(std::forward<TArgs>(args)...);
+
+            return ptr;
+        }
+    };
+
+    /**
+     * @brief Whether objects of a type can be moved to another address by copying their bytes, without running a
+     * constructor on the new address or a destructor on the old one. Types that only hold pointers to memory they own,
+     * and never pointers into themselves, can opt in by specialising this for themselves.
+     *
+     * @tparam T The type.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+    {
+    };
+
     /**
      * @brief Used to allocate and deallocate a buffer of memory for a type.
      */
@@ -223,18 +872,22 @@ namespace Otter
          *
          * @tparam T The type to allocate memory for.
          * @param length The number of elements to allocate memory for.
+         * @param flags The initial contents of the buffer, for types that are trivially constructible.
+         * @param tag The category that the buffer is accounted to.
          *
          * @return A pointer to the allocated memory block.
          */
         template<typename T>
-        OTR_INLINE static T* New(const UInt64 length)
+        OTR_INLINE static T* New(const UInt64 length,
+                                 const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                 const MemoryTag tag = MemoryTag::Untagged)
         {
             OTR_INTERNAL_ASSERT_MSG(length * sizeof(T) > 0, "Buffer length must be greater than 0")
 
             UInt64 alignedSize = OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT);
             UInt64 bufferSize  = length * alignedSize;
 
-            UnsafeHandle handle = MemorySystem::Allocate(bufferSize);
+            UnsafeHandle handle = MemorySystem::Allocate(bufferSize, OTR_PLATFORM_MEMORY_ALIGNMENT, flags, tag);
 
             if (!std::is_trivially_constructible<T>::value)
             {
@@ -249,6 +902,21 @@ namespace Otter
             return (T*) handle.Pointer;
         }
 
+        /**
+         * @brief Allocates a buffer of memory for a type, accounted to a memory tag.
+         *
+         * @tparam T The type to allocate memory for.
+         * @param length The number of elements to allocate memory for.
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the allocated memory block.
+         */
+        template<typename T>
+        OTR_INLINE static T* New(const UInt64 length, const MemoryTag tag)
+        {
+            return New<T>(length, AllocationFlags::Uninitialised, tag);
+        }
+
         /**
          * @brief Deallocates a buffer of memory for a type.
          *
@@ -256,9 +924,10 @@ namespace Otter
          *
          * @param ptr The pointer to the memory block to deallocate.
          * @param length The number of elements to deallocate memory for.
+         * @param tag The category that the buffer was accounted to.
          */
         template<typename T>
-        OTR_INLINE static void Delete(T* ptr, const UInt64 length)
+        OTR_INLINE static void Delete(T* ptr, const UInt64 length, const MemoryTag tag = MemoryTag::Untagged)
         {
             OTR_INTERNAL_ASSERT_MSG(ptr != nullptr, "Buffer pointer must not be null")
             OTR_INTERNAL_ASSERT_MSG(length * sizeof(T) > 0, "Buffer length must be greater than 0")
@@ -275,8 +944,286 @@ namespace Otter
                 }
             }
 
-            MemorySystem::MemoryClear(ptr, length * sizeof(T));
-            MemorySystem::Free(ptr);
+            UInt64 alignedSize = OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+            MemorySystem::Free(ptr, length * alignedSize, tag);
+        }
+
+        /**
+         * @brief Resizes a buffer of memory for a type, in place if possible.
+         *
+         * @tparam T The type of the buffer. Must be trivially copyable, since the elements may be moved bytewise.
+         *
+         * @param ptr The pointer to the buffer to resize.
+         * @param length The current number of elements of the buffer.
+         * @param newLength The new number of elements of the buffer.
+         * @param flags The initial contents of the elements that the buffer did not have before.
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the resized buffer. The previous pointer must not be used anymore.
+         */
+        template<typename T>
+        OTR_INLINE static T* Reallocate(T* ptr,
+                                        const UInt64 length,
+                                        const UInt64 newLength,
+                                        const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                        const MemoryTag tag = MemoryTag::Untagged)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only buffers of trivially copyable types can be resized");
+
+            OTR_INTERNAL_ASSERT_MSG(ptr != nullptr, "Buffer pointer must not be null")
+            OTR_INTERNAL_ASSERT_MSG(newLength * sizeof(T) > 0, "Buffer length must be greater than 0")
+
+            UInt64 alignedSize = OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+            UnsafeHandle handle{ ptr, length * alignedSize };
+            handle = MemorySystem::Reallocate(handle,
+                                              newLength * alignedSize,
+                                              OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                              flags,
+                                              tag);
+
+            return (T*) handle.Pointer;
+        }
+
+        /**
+         * @brief Resizes a buffer of memory for a type that is accounted to a memory tag, in place if possible.
+         *
+         * @tparam T The type of the buffer. Must be trivially copyable, since the elements may be moved bytewise.
+         *
+         * @param ptr The pointer to the buffer to resize.
+         * @param length The current number of elements of the buffer.
+         * @param newLength The new number of elements of the buffer.
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the resized buffer. The previous pointer must not be used anymore.
+         */
+        template<typename T>
+        OTR_INLINE static T* Reallocate(T* ptr, const UInt64 length, const UInt64 newLength, const MemoryTag tag)
+        {
+            return Reallocate<T>(ptr, length, newLength, AllocationFlags::Uninitialised, tag);
+        }
+
+        /**
+         * @brief Moves the elements of a buffer to a new buffer of a different length, and deletes the old buffer.
+         * The elements are move-constructed in the new buffer, or copied bytewise if they are trivially relocatable,
+         * so that they are never copied deeply. The rest of the new buffer is default-constructed, like in New.
+         *
+         * @tparam T The type of the buffer.
+         *
+         * @param ptr The pointer to the buffer to move.
+         * @param length The number of elements of the buffer.
+         * @param newLength The number of elements of the new buffer.
+         * @param count The number of elements to move. The elements past the new length are dropped.
+         * @param start The index of the first element to move. The elements wrap around the end of the buffer, so
+         * that the items of a ring buffer end up in order at the start of the new buffer.
+         * @param tag The category that the buffers are accounted to.
+         *
+         * @return A pointer to the new buffer. The previous pointer must not be used anymore.
+         */
+        template<typename T>
+        static T* Relocate(T* const ptr,
+                           const UInt64 length,
+                           const UInt64 newLength,
+                           UInt64 count,
+                           const UInt64 start,
+                           const MemoryTag tag = MemoryTag::Untagged)
+        {
+            OTR_INTERNAL_ASSERT_MSG(ptr != nullptr, "Buffer pointer must not be null")
+            OTR_INTERNAL_ASSERT_MSG(newLength * sizeof(T) > 0, "Buffer length must be greater than 0")
+            OTR_INTERNAL_ASSERT_MSG(count <= length && start < length, "Elements must lie within the buffer")
+
+            if (count > newLength)
+                count = newLength;
+
+            UInt64 alignedSize = OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+            UnsafeHandle handle = MemorySystem::Allocate(newLength * alignedSize,
+                                                         OTR_PLATFORM_MEMORY_ALIGNMENT,
+                                                         AllocationFlags::Uninitialised,
+                                                         tag);
+            T* newPtr = (T*) handle.Pointer;
+
+            // The elements up to the end of the buffer, then the ones that wrapped around to its start
+            const UInt64 headCount = count < length - start ? count : length - start;
+
+            if constexpr (IsTriviallyRelocatable<T>::value)
+            {
+                if (headCount > 0)
+                    MemorySystem::MemoryCopy(newPtr, ptr + start, headCount * sizeof(T));
+                if (count > headCount)
+                    MemorySystem::MemoryCopy(newPtr + headCount, ptr, (count - headCount) * sizeof(T));
+            }
+            else
+            {
+                for (UInt64 i = 0; i < count; i++)
+                    ::new(newPtr + i) T(std::move(ptr[(start + i) % length]));
+            }
+
+            if (!std::is_trivially_constructible<T>::value)
+                for (UInt64 i = count; i < newLength; i++)
+                    ::new(newPtr + i) T();
+
+            // Elements that were copied bytewise now belong to the new buffer, so only the others are destroyed
+            if (!std::is_trivially_destructible_v<T>)
+            {
+                const UInt64 relocatedCount = IsTriviallyRelocatable<T>::value ? count : 0;
+                for (UInt64 i = relocatedCount; i < length; i++)
+                    ptr[(start + i) % length].~T();
+            }
+
+            MemorySystem::Free(ptr, length * alignedSize, tag);
+
+            return newPtr;
+        }
+
+        /**
+         * @brief Allocates a tightly packed buffer of memory for a type, aligned to a boundary that is larger than the
+         * platform alignment, such as a cache line or a SIMD register. Unlike New, the elements are not padded to the
+         * platform alignment, so their stride is sizeof(T).
+         *
+         * @tparam T The type to allocate memory for.
+         * @param length The number of elements to allocate memory for.
+         * @param alignment The alignment of the first element. Must be a power of two, and at least alignof(T).
+         * @param flags The initial contents of the buffer, for types that are trivially constructible.
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the allocated memory block.
+         *
+         * @note Buffers that are allocated with NewAligned must be deallocated with DeleteAligned.
+         */
+        template<typename T>
+        OTR_INLINE static T* NewAligned(const UInt64 length,
+                                        const UInt16 alignment,
+                                        const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                        const MemoryTag tag = MemoryTag::Untagged)
+        {
+            OTR_INTERNAL_ASSERT_MSG(length * sizeof(T) > 0, "Buffer length must be greater than 0")
+            OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Buffer alignment must be a power of two")
+            OTR_INTERNAL_ASSERT_MSG(alignment >= alignof(T), "Buffer alignment must be at least the type's alignment")
+
+            UnsafeHandle handle = MemorySystem::Allocate(GetPackedSize<T>(length),
+                                                         GetPackedAlignment(alignment),
+                                                         flags,
+                                                         tag);
+
+            if (!std::is_trivially_constructible<T>::value && handle.Pointer)
+            {
+                T* ptrCopy = (T*) handle.Pointer;
+                for (UInt64 i = 0; i < length; i++)
+                {
+                    ::new(ptrCopy) T();
+                    ++ptrCopy;
+                }
+            }
+
+            return (T*) handle.Pointer;
+        }
+
+        /**
+         * @brief Allocates a tightly packed and aligned buffer of memory for a type, accounted to a memory tag.
+         *
+         * @tparam T The type to allocate memory for.
+         * @param length The number of elements to allocate memory for.
+         * @param alignment The alignment of the first element. Must be a power of two, and at least alignof(T).
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the allocated memory block.
+         */
+        template<typename T>
+        OTR_INLINE static T* NewAligned(const UInt64 length, const UInt16 alignment, const MemoryTag tag)
+        {
+            return NewAligned<T>(length, alignment, AllocationFlags::Uninitialised, tag);
+        }
+
+        /**
+         * @brief Deallocates a buffer of memory for a type that was allocated with NewAligned.
+         *
+         * @tparam T The type to deallocate memory for.
+         *
+         * @param ptr The pointer to the memory block to deallocate.
+         * @param length The number of elements to deallocate memory for.
+         * @param tag The category that the buffer was accounted to.
+         */
+        template<typename T>
+        OTR_INLINE static void DeleteAligned(T* ptr, const UInt64 length, const MemoryTag tag = MemoryTag::Untagged)
+        {
+            OTR_INTERNAL_ASSERT_MSG(ptr != nullptr, "Buffer pointer must not be null")
+            OTR_INTERNAL_ASSERT_MSG(length * sizeof(T) > 0, "Buffer length must be greater than 0")
+
+            if (!std::is_trivially_destructible_v<T>)
+            {
+                for (UInt64 i = 0; i < length; i++)
+                    ptr[i].~T();
+            }
+
+            MemorySystem::Free(ptr, GetPackedSize<T>(length), tag);
+        }
+
+        /**
+         * @brief Resizes a buffer of memory for a type that was allocated with NewAligned, in place if possible. The
+         * buffer keeps its alignment if it has to be moved.
+         *
+         * @tparam T The type of the buffer. Must be trivially copyable, since the elements may be moved bytewise.
+         *
+         * @param ptr The pointer to the buffer to resize.
+         * @param length The current number of elements of the buffer.
+         * @param newLength The new number of elements of the buffer.
+         * @param alignment The alignment that the buffer was allocated with.
+         * @param flags The initial contents of the elements that the buffer did not have before.
+         * @param tag The category that the buffer is accounted to.
+         *
+         * @return A pointer to the resized buffer. The previous pointer must not be used anymore.
+         */
+        template<typename T>
+        OTR_INLINE static T* ReallocateAligned(T* ptr,
+                                               const UInt64 length,
+                                               const UInt64 newLength,
+                                               const UInt16 alignment,
+                                               const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                               const MemoryTag tag = MemoryTag::Untagged)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only buffers of trivially copyable types can be resized");
+
+            OTR_INTERNAL_ASSERT_MSG(ptr != nullptr, "Buffer pointer must not be null")
+            OTR_INTERNAL_ASSERT_MSG(newLength * sizeof(T) > 0, "Buffer length must be greater than 0")
+            OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Buffer alignment must be a power of two")
+
+            UnsafeHandle handle{ ptr, GetPackedSize<T>(length) };
+            handle = MemorySystem::Reallocate(handle,
+                                              GetPackedSize<T>(newLength),
+                                              GetPackedAlignment(alignment),
+                                              flags,
+                                              tag);
+
+            return (T*) handle.Pointer;
+        }
+
+    private:
+        /**
+         * @brief Gets the number of bytes that a tightly packed buffer of a type takes up.
+         *
+         * @tparam T The type of the buffer.
+         * @param length The number of elements of the buffer.
+         *
+         * @return The size of the buffer, rounded up to the platform alignment.
+         */
+        template<typename T>
+        OTR_INLINE static constexpr UInt64 GetPackedSize(const UInt64 length)
+        {
+            return OTR_ALIGNED_OFFSET(length * sizeof(T), (UInt64) OTR_PLATFORM_MEMORY_ALIGNMENT);
+        }
+
+        /**
+         * @brief Gets the alignment that a tightly packed buffer is allocated with.
+         *
+         * @param alignment The requested alignment.
+         *
+         * @return The requested alignment, or the platform alignment if it is larger.
+         */
+        OTR_INLINE static constexpr UInt16 GetPackedAlignment(const UInt16 alignment)
+        {
+            return alignment > OTR_PLATFORM_MEMORY_ALIGNMENT ? alignment : OTR_PLATFORM_MEMORY_ALIGNMENT;
         }
     };
 
@@ -290,32 +1237,108 @@ namespace Otter
          * @brief Allocates a handle to a resource.
          *
          * @param size The size of the resource to allocate in bytes.
+         * @param flags The initial contents of the resource.
+         * @param tag The category that the resource is accounted to.
          *
          * @return An unsafe handle to the allocated resource.
          */
-        OTR_INLINE static UnsafeHandle New(const UInt64 size)
+        OTR_INLINE static UnsafeHandle New(const UInt64 size,
+                                           const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                           const MemoryTag tag = MemoryTag::Untagged)
         {
             OTR_INTERNAL_ASSERT_MSG(size > 0, "Allocation size must be greater than 0 bytes")
 
             UInt64 alignedSize = OTR_ALIGNED_OFFSET(size, OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-            return MemorySystem::Allocate(alignedSize);
+            return MemorySystem::Allocate(alignedSize, OTR_PLATFORM_MEMORY_ALIGNMENT, flags, tag);
+        }
+
+        /**
+         * @brief Allocates a handle to a resource, accounted to a memory tag.
+         *
+         * @param size The size of the resource to allocate in bytes.
+         * @param tag The category that the resource is accounted to.
+         *
+         * @return An unsafe handle to the allocated resource.
+         */
+        OTR_INLINE static UnsafeHandle New(const UInt64 size, const MemoryTag tag)
+        {
+            return New(size, AllocationFlags::Uninitialised, tag);
         }
 
         /**
          * @brief Deallocates a handle to a resource.
          *
          * @param handle The unsafe handle to the resource to deallocate.
+         * @param tag The category that the resource was accounted to.
          */
-        OTR_INLINE static void Delete(const UnsafeHandle& handle)
+        OTR_INLINE static void Delete(const UnsafeHandle& handle, const MemoryTag tag = MemoryTag::Untagged)
         {
             OTR_INTERNAL_ASSERT_MSG(handle.Pointer != nullptr, "Handle pointer must not be null")
             OTR_INTERNAL_ASSERT_MSG(handle.Size > 0, "Handle size must be greater than 0")
 
-            MemorySystem::MemoryClear(handle.Pointer, OTR_ALIGNED_OFFSET(handle.Size, OTR_PLATFORM_MEMORY_ALIGNMENT));
-            MemorySystem::Free(handle.Pointer);
+            MemorySystem::Free(handle.Pointer, OTR_ALIGNED_OFFSET(handle.Size, OTR_PLATFORM_MEMORY_ALIGNMENT), tag);
+        }
+
+        /**
+         * @brief Resizes a handle to a resource, in place if possible.
+         *
+         * @param handle The unsafe handle to the resource to resize. It is invalidated after the call.
+         * @param size The new size of the resource in bytes.
+         * @param flags The initial contents of the part of the resource that the handle did not cover.
+         * @param tag The category that the resource is accounted to.
+         *
+         * @return An unsafe handle to the resized resource.
+         */
+        OTR_INLINE static UnsafeHandle Reallocate(UnsafeHandle& handle,
+                                                  const UInt64 size,
+                                                  const AllocationFlags flags = AllocationFlags::Uninitialised,
+                                                  const MemoryTag tag = MemoryTag::Untagged)
+        {
+            OTR_INTERNAL_ASSERT_MSG(handle.Pointer != nullptr, "Handle pointer must not be null")
+            OTR_INTERNAL_ASSERT_MSG(size > 0, "Allocation size must be greater than 0 bytes")
+
+            UInt64 alignedSize = OTR_ALIGNED_OFFSET(size, OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+            return MemorySystem::Reallocate(handle, alignedSize, OTR_PLATFORM_MEMORY_ALIGNMENT, flags, tag);
+        }
+
+        /**
+         * @brief Resizes a handle to a resource that is accounted to a memory tag, in place if possible.
+         *
+         * @param handle The unsafe handle to the resource to resize. It is invalidated after the call.
+         * @param size The new size of the resource in bytes.
+         * @param tag The category that the resource is accounted to.
+         *
+         * @return An unsafe handle to the resized resource.
+         */
+        OTR_INLINE static UnsafeHandle Reallocate(UnsafeHandle& handle, const UInt64 size, const MemoryTag tag)
+        {
+            return Reallocate(handle, size, AllocationFlags::Uninitialised, tag);
         }
     };
+
+    /**
+     * @brief Writes the name of a memory tag to a stream. Declared in the namespace of the tag, so that the logger
+     * finds it through argument-dependent lookup.
+     */
+    template<typename OStream>
+    OStream& operator<<(OStream& os, const MemoryTag& memoryTag)
+    {
+        switch (memoryTag)
+        {
+            case MemoryTag::Untagged:
+                os << "MemoryTag::Untagged";
+                break;
+#define REPLACE_WITH(Item, Value) case MemoryTag::Item: os << "MemoryTag::" << #Item; break;
+            MEMORY_TAG_LIST
+#undef REPLACE_WITH
+            default:
+                os << "MemoryTag[Unknown]";
+        }
+
+        return os;
+    }
 }
 
 #endif //OTTERENGINE_MEMORY_H
@@ -0,0 +1,795 @@
+#ifndef OTTERENGINE_SMARTPOINTERS_H
+#define OTTERENGINE_SMARTPOINTERS_H
+
+#include <atomic>
+
+#include "Core/Defines.h"
+#include "Core/BaseTypes.h"
+#include "Core/Memory.h"
+#include "Core/Allocators/AbstractAllocator.h"
+
+namespace Otter
+{
+    /**
+     * @brief Destroys an object that was allocated from the memory system. It remembers the size and the memory tag
+     * of the allocation, so that the object can also be destroyed through a pointer to one of its base classes.
+     *
+     * @tparam T The type of the object.
+     */
+    template<typename T>
+    class DefaultDeleter final
+    {
+    public:
+        /**
+         * @brief Constructor, for objects that were allocated with New.
+         */
+        constexpr DefaultDeleter() noexcept
+            : m_Size(0), m_Tag(MemoryTag::Untagged)
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param size The size of the allocation of the object.
+         * @param tag The category that the allocation is accounted to.
+         */
+        constexpr DefaultDeleter(const UInt32 size, const MemoryTag tag) noexcept
+            : m_Size(size), m_Tag(tag)
+        {
+        }
+
+        /**
+         * @brief Converting constructor, from the deleter of a derived type.
+         *
+         * @tparam TOther The derived type.
+         *
+         * @param other The deleter to convert from.
+         */
+        template<typename TOther>
+        requires std::is_convertible_v<TOther*, T*>
+        constexpr DefaultDeleter(const DefaultDeleter<TOther>& other) noexcept // NOLINT(*-explicit-constructor)
+            : m_Size(other.GetSize()), m_Tag(other.m_Tag)
+        {
+        }
+
+        /**
+         * @brief Destroys an object and frees its memory.
+         *
+         * @param ptr The object to destroy.
+         */
+        void operator()(T* ptr) const
+        {
+            if (!std::is_trivially_destructible_v<T>)
+                ptr->~T();
+
+            MemorySystem::Free((void*) ptr, GetSize(), m_Tag);
+        }
+
+    private:
+        /// @brief The size of the allocation, or 0 for objects that were allocated with New.
+        UInt32    m_Size;
+        MemoryTag m_Tag;
+
+        /**
+         * @brief Gets the size of the allocation of the object.
+         *
+         * @return The size of the allocation.
+         *
+         * @note The size of objects that were allocated with New is only computed here, so that unique pointers can
+         * be declared for incomplete types.
+         */
+        [[nodiscard]] OTR_INLINE constexpr UInt32 GetSize() const noexcept
+        {
+            return m_Size != 0 ? m_Size : OTR_ALIGNED_OFFSET(sizeof(T), OTR_PLATFORM_MEMORY_ALIGNMENT);
+        }
+
+        template<typename TOther>
+        friend class DefaultDeleter;
+    };
+
+    /**
+     * @brief Destroys an object that was allocated from a custom allocator.
+     *
+     * @tparam T The type of the object.
+     */
+    template<typename T>
+    class AllocatorDeleter final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param allocator The allocator that the object was allocated from.
+         */
+        constexpr explicit AllocatorDeleter(AbstractAllocator* allocator) noexcept
+            : m_Allocator(allocator)
+        {
+        }
+
+        /**
+         * @brief Converting constructor, from the deleter of a derived type.
+         *
+         * @tparam TOther The derived type.
+         *
+         * @param other The deleter to convert from.
+         */
+        template<typename TOther>
+        requires std::is_convertible_v<TOther*, T*>
+        constexpr AllocatorDeleter(const AllocatorDeleter<TOther>& other) noexcept // NOLINT(*-explicit-constructor)
+            : m_Allocator(other.m_Allocator)
+        {
+        }
+
+        /**
+         * @brief Destroys an object and returns its memory to the allocator.
+         *
+         * @param ptr The object to destroy.
+         */
+        void operator()(T* ptr) const
+        {
+            if (!std::is_trivially_destructible_v<T>)
+                ptr->~T();
+
+            m_Allocator->Free((void*) ptr);
+        }
+
+    private:
+        AbstractAllocator* m_Allocator;
+
+        template<typename TOther>
+        friend class AllocatorDeleter;
+    };
+
+    /**
+     * @brief Owns an object exclusively and destroys it when it goes out of scope. It cannot be copied, only moved.
+     *
+     * @tparam T The type of the object.
+     * @tparam TDeleter The type of the deleter that destroys the object.
+     */
+    template<typename T, typename TDeleter = DefaultDeleter<T>>
+    class UniquePtr final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        constexpr UniquePtr() noexcept
+            : m_Pointer(nullptr), m_Deleter()
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param NullPtr Null pointer.
+         */
+        constexpr UniquePtr(NullPtr) noexcept // NOLINT(*-explicit-constructor)
+            : m_Pointer(nullptr), m_Deleter()
+        {
+        }
+
+        /**
+         * @brief Constructor. Takes ownership of an object.
+         *
+         * @param ptr The object to own.
+         * @param deleter The deleter that destroys the object.
+         */
+        constexpr explicit UniquePtr(T* ptr, const TDeleter& deleter = TDeleter()) noexcept
+            : m_Pointer(ptr), m_Deleter(deleter)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~UniquePtr()
+        {
+            Reset();
+        }
+
+        UniquePtr(const UniquePtr& other) = delete;
+        UniquePtr& operator=(const UniquePtr& other) = delete;
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The unique pointer to move from.
+         */
+        constexpr UniquePtr(UniquePtr&& other) noexcept
+            : m_Pointer(other.m_Pointer), m_Deleter(other.m_Deleter)
+        {
+            other.m_Pointer = nullptr;
+        }
+
+        /**
+         * @brief Converting move constructor, from a unique pointer to a derived type.
+         *
+         * @tparam TOther The derived type.
+         * @tparam TOtherDeleter The deleter type of the derived type.
+         *
+         * @param other The unique pointer to move from.
+         */
+        template<typename TOther, typename TOtherDeleter>
+        requires std::is_convertible_v<TOther*, T*> && std::is_constructible_v<TDeleter, const TOtherDeleter&>
+        constexpr UniquePtr(UniquePtr<TOther, TOtherDeleter>&& other) noexcept // NOLINT(*-explicit-constructor)
+            : m_Pointer(other.m_Pointer), m_Deleter(other.m_Deleter)
+        {
+            static_assert(std::is_same_v<T, TOther> || std::has_virtual_destructor_v<T>,
+                          "Objects can only be owned through a base class that has a virtual destructor");
+
+            other.m_Pointer = nullptr;
+        }
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The unique pointer to move from.
+         *
+         * @return A reference to this unique pointer.
+         */
+        UniquePtr& operator=(UniquePtr&& other) noexcept
+        {
+            if (this == &other)
+                return *this;
+
+            Reset(other.m_Pointer);
+            m_Deleter = other.m_Deleter;
+
+            other.m_Pointer = nullptr;
+
+            return *this;
+        }
+
+        /**
+         * @brief Assignment operator. Destroys the owned object.
+         *
+         * @param NullPtr Null pointer.
+         *
+         * @return A reference to this unique pointer.
+         */
+        UniquePtr& operator=(NullPtr) noexcept
+        {
+            Reset();
+
+            return *this;
+        }
+
+        /**
+         * @brief Dereference operator.
+         *
+         * @return A reference to the owned object.
+         */
+        [[nodiscard]] OTR_INLINE T& operator*() const
+        {
+            OTR_INTERNAL_ASSERT_MSG(m_Pointer != nullptr, "Unique pointer must not be null")
+
+            return *m_Pointer;
+        }
+
+        /**
+         * @brief Member access operator.
+         *
+         * @return A pointer to the owned object.
+         */
+        [[nodiscard]] OTR_INLINE T* operator->() const
+        {
+            OTR_INTERNAL_ASSERT_MSG(m_Pointer != nullptr, "Unique pointer must not be null")
+
+            return m_Pointer;
+        }
+
+        /**
+         * @brief Checks whether the unique pointer owns an object.
+         *
+         * @return True if it owns an object, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE explicit operator bool() const noexcept { return m_Pointer != nullptr; }
+
+        /**
+         * @brief Equality operator.
+         *
+         * @param NullPtr Null pointer.
+         *
+         * @return True if the unique pointer does not own an object, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool operator==(NullPtr) const noexcept { return m_Pointer == nullptr; }
+
+        /**
+         * @brief Gets the owned object.
+         *
+         * @return A pointer to the owned object, or nullptr.
+         */
+        [[nodiscard]] OTR_INLINE T* Get() const noexcept { return m_Pointer; }
+
+        /**
+         * @brief Gets the deleter that destroys the owned object.
+         *
+         * @return The deleter.
+         */
+        [[nodiscard]] OTR_INLINE const TDeleter& GetDeleter() const noexcept { return m_Deleter; }
+
+        /**
+         * @brief Gives up the ownership of the object, without destroying it.
+         *
+         * @return A pointer to the object, which the caller is responsible for.
+         */
+        [[nodiscard]] T* Release() noexcept
+        {
+            T* ptr = m_Pointer;
+            m_Pointer = nullptr;
+
+            return ptr;
+        }
+
+        /**
+         * @brief Destroys the owned object, and takes ownership of another one.
+         *
+         * @param ptr The object to own, or nullptr.
+         */
+        void Reset(T* ptr = nullptr)
+        {
+            T* previous = m_Pointer;
+            m_Pointer = ptr;
+
+            if (previous)
+                m_Deleter(previous);
+        }
+
+    private:
+        T* m_Pointer;
+        [[no_unique_address]] TDeleter m_Deleter;
+
+        template<typename TOther, typename TOtherDeleter>
+        friend class UniquePtr;
+    };
+
+    namespace Internal
+    {
+        /**
+         * @brief The control block of an object that is owned by shared pointers. The object is stored right after
+         * it, in the same allocation.
+         */
+        struct SharedControlBlock
+        {
+            std::atomic<UInt64> References;
+            void (* Destroy)(SharedControlBlock* block);
+            AbstractAllocator* Allocator;
+            MemoryTag Tag;
+        };
+
+        /**
+         * @brief The allocation of an object that is owned by shared pointers, together with its control block.
+         *
+         * @tparam T The type of the object.
+         */
+        template<typename T>
+        struct SharedBlock final
+        {
+            SharedControlBlock Control;
+            alignas(T) Byte Storage[sizeof(T)];
+
+            /**
+             * @brief Destroys the object of a control block and frees their allocation.
+             *
+             * @param control The control block.
+             */
+            static void Destroy(SharedControlBlock* control)
+            {
+                auto* block = (SharedBlock*) control;
+
+                if (!std::is_trivially_destructible_v<T>)
+                    ((T*) block->Storage)->~T();
+
+                if (AbstractAllocator* allocator = control->Allocator)
+                    allocator->Free(block);
+                else
+                    MemorySystem::Free(block, sizeof(SharedBlock), control->Tag);
+            }
+        };
+    }
+
+    template<typename T>
+    class SharedPtr;
+
+    template<typename T, MemoryTag Tag = MemoryTag::Untagged, typename... TArgs>
+    SharedPtr<T> MakeShared(TArgs&& ... args);
+
+    template<typename T, typename... TArgs>
+    SharedPtr<T> AllocateShared(AbstractAllocator& allocator, TArgs&& ... args);
+
+    /**
+     * @brief Shares the ownership of an object with other shared pointers. The object is destroyed when the last of
+     * them goes out of scope. The reference count is stored in the same allocation as the object.
+     *
+     * @tparam T The type of the object.
+     *
+     * @note The reference count is atomic, so shared pointers to the same object can be copied and destroyed from
+     * different threads.
+     */
+    template<typename T>
+    class SharedPtr final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        constexpr SharedPtr() noexcept
+            : m_Pointer(nullptr), m_Control(nullptr)
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param NullPtr Null pointer.
+         */
+        constexpr SharedPtr(NullPtr) noexcept // NOLINT(*-explicit-constructor)
+            : m_Pointer(nullptr), m_Control(nullptr)
+        {
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~SharedPtr()
+        {
+            Reset();
+        }
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param other The shared pointer to copy from.
+         */
+        SharedPtr(const SharedPtr& other) noexcept
+            : m_Pointer(other.m_Pointer), m_Control(other.m_Control)
+        {
+            AddReference();
+        }
+
+        /**
+         * @brief Converting copy constructor, from a shared pointer to a derived type.
+         *
+         * @tparam TOther The derived type.
+         *
+         * @param other The shared pointer to copy from.
+         */
+        template<typename TOther>
+        requires std::is_convertible_v<TOther*, T*>
+        SharedPtr(const SharedPtr<TOther>& other) noexcept // NOLINT(*-explicit-constructor)
+            : m_Pointer(other.m_Pointer), m_Control(other.m_Control)
+        {
+            AddReference();
+        }
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The shared pointer to move from.
+         */
+        SharedPtr(SharedPtr&& other) noexcept
+            : m_Pointer(other.m_Pointer), m_Control(other.m_Control)
+        {
+            other.m_Pointer = nullptr;
+            other.m_Control = nullptr;
+        }
+
+        /**
+         * @brief Converting move constructor, from a shared pointer to a derived type.
+         *
+         * @tparam TOther The derived type.
+         *
+         * @param other The shared pointer to move from.
+         */
+        template<typename TOther>
+        requires std::is_convertible_v<TOther*, T*>
+        SharedPtr(SharedPtr<TOther>&& other) noexcept // NOLINT(*-explicit-constructor)
+            : m_Pointer(other.m_Pointer), m_Control(other.m_Control)
+        {
+            other.m_Pointer = nullptr;
+            other.m_Control = nullptr;
+        }
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The shared pointer to copy from.
+         *
+         * @return A reference to this shared pointer.
+         */
+        SharedPtr& operator=(const SharedPtr& other) noexcept
+        {
+            if (m_Control == other.m_Control)
+            {
+                m_Pointer = other.m_Pointer;
+                return *this;
+            }
+
+            Reset();
+
+            m_Pointer = other.m_Pointer;
+            m_Control = other.m_Control;
+            AddReference();
+
+            return *this;
+        }
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The shared pointer to move from.
+         *
+         * @return A reference to this shared pointer.
+         */
+        SharedPtr& operator=(SharedPtr&& other) noexcept
+        {
+            if (this == &other)
+                return *this;
+
+            Reset();
+
+            m_Pointer = other.m_Pointer;
+            m_Control = other.m_Control;
+
+            other.m_Pointer = nullptr;
+            other.m_Control = nullptr;
+
+            return *this;
+        }
+
+        /**
+         * @brief Dereference operator.
+         *
+         * @return A reference to the shared object.
+         */
+        [[nodiscard]] OTR_INLINE T& operator*() const
+        {
+            OTR_INTERNAL_ASSERT_MSG(m_Pointer != nullptr, "Shared pointer must not be null")
+
+            return *m_Pointer;
+        }
+
+        /**
+         * @brief Member access operator.
+         *
+         * @return A pointer to the shared object.
+         */
+        [[nodiscard]] OTR_INLINE T* operator->() const
+        {
+            OTR_INTERNAL_ASSERT_MSG(m_Pointer != nullptr, "Shared pointer must not be null")
+
+            return m_Pointer;
+        }
+
+        /**
+         * @brief Checks whether the shared pointer shares an object.
+         *
+         * @return True if it shares an object, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE explicit operator bool() const noexcept { return m_Pointer != nullptr; }
+
+        /**
+         * @brief Equality operator.
+         *
+         * @param NullPtr Null pointer.
+         *
+         * @return True if the shared pointer does not share an object, false otherwise.
+         */
+        [[nodiscard]] OTR_INLINE bool operator==(NullPtr) const noexcept { return m_Pointer == nullptr; }
+
+        /**
+         * @brief Gets the shared object.
+         *
+         * @return A pointer to the shared object, or nullptr.
+         */
+        [[nodiscard]] OTR_INLINE T* Get() const noexcept { return m_Pointer; }
+
+        /**
+         * @brief Gets the number of shared pointers that share the object.
+         *
+         * @return The reference count, or 0 if the shared pointer is null.
+         */
+        [[nodiscard]] OTR_INLINE UInt64 GetReferenceCount() const noexcept
+        {
+            return m_Control ? m_Control->References.load(std::memory_order_relaxed) : 0;
+        }
+
+        /**
+         * @brief Stops sharing the object. The object is destroyed if this was its last shared pointer.
+         */
+        void Reset()
+        {
+            if (m_Control && m_Control->References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                m_Control->Destroy(m_Control);
+
+            m_Pointer = nullptr;
+            m_Control = nullptr;
+        }
+
+    private:
+        T* m_Pointer;
+        Internal::SharedControlBlock* m_Control;
+
+        /**
+         * @brief Constructor, used by MakeShared and AllocateShared.
+         *
+         * @param ptr The shared object.
+         * @param control The control block of the object, with a reference count of 1.
+         */
+        SharedPtr(T* ptr, Internal::SharedControlBlock* control) noexcept
+            : m_Pointer(ptr), m_Control(control)
+        {
+        }
+
+        /**
+         * @brief Increments the reference count of the object, if there is one.
+         */
+        OTR_INLINE void AddReference() const noexcept
+        {
+            if (m_Control)
+                m_Control->References.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<typename TOther>
+        friend class SharedPtr;
+
+        template<typename TOther, MemoryTag Tag, typename... TArgs>
+        friend SharedPtr<TOther> MakeShared(TArgs&& ... args);
+
+        template<typename TOther, typename... TArgs>
+        friend SharedPtr<TOther> AllocateShared(AbstractAllocator& allocator, TArgs&& ... args);
+    };
+
+    namespace Internal
+    {
+        /**
+         * @brief Gets the alignment that an object is allocated with.
+         *
+         * @tparam T The type of the object.
+         *
+         * @return The alignment of the type, or the platform alignment if it is larger.
+         */
+        template<typename T>
+        OTR_INLINE constexpr UInt16 GetObjectAlignment()
+        {
+            return alignof(T) > OTR_PLATFORM_MEMORY_ALIGNMENT ? alignof(T) : OTR_PLATFORM_MEMORY_ALIGNMENT;
+        }
+
+        /**
+         * @brief Initialises the control block of an object that is owned by shared pointers, and constructs the
+         * object.
+         *
+         * @tparam T The type of the object.
+         * @tparam TArgs The arguments to pass to the type's constructor.
+         *
+         * @param memory The memory of the allocation.
+         * @param allocator The allocator that the memory was allocated from, or nullptr for the memory system.
+         * @param tag The category that the allocation is accounted to.
+         * @param args The arguments to pass to the type's constructor.
+         *
+         * @return The control block and the object.
+         */
+        template<typename T, typename... TArgs>
+        SharedBlock<T>* ConstructShared(void* memory, AbstractAllocator* allocator, MemoryTag tag, TArgs&& ... args)
+        {
+            auto* block = ::new(memory) SharedBlock<T>;
+            block->Control.References.store(1, std::memory_order_relaxed);
+            block->Control.Destroy   = &SharedBlock<T>::Destroy;
+            block->Control.Allocator = allocator;
+            block->Control.Tag       = tag;
+
+            ::new(block->Storage) T(std::forward<TArgs>(args)...);
+
+            return block;
+        }
+    }
+
+    /**
+     * @brief Allocates an object from the memory system and gives its ownership to a unique pointer.
+     *
+     * @tparam T The type of the object.
+     * @tparam Tag The category that the object is accounted to.
+     * @tparam TArgs The arguments to pass to the type's constructor.
+     *
+     * @param args The arguments to pass to the type's constructor.
+     *
+     * @return A unique pointer to the object, or a null one if the memory system is out of memory.
+     */
+    template<typename T, MemoryTag Tag = MemoryTag::Untagged, typename... TArgs>
+    UniquePtr<T> MakeUnique(TArgs&& ... args)
+    {
+        UnsafeHandle handle = MemorySystem::Allocate(sizeof(T),
+                                                     Internal::GetObjectAlignment<T>(),
+                                                     AllocationFlags::Uninitialised,
+                                                     Tag);
+        if (!handle.Pointer)
+            return nullptr;
+
+        T* ptr = ::new(handle.Pointer) T(std::forward<TArgs>(args)...);
+
+        return UniquePtr<T>(ptr, DefaultDeleter<T>(sizeof(T), Tag));
+    }
+
+    /**
+     * @brief Allocates an object from a custom allocator and gives its ownership to a unique pointer.
+     *
+     * @tparam T The type of the object.
+     * @tparam TArgs The arguments to pass to the type's constructor.
+     *
+     * @param allocator The allocator to allocate the object from. Must outlive the object.
+     * @param args The arguments to pass to the type's constructor.
+     *
+     * @return A unique pointer to the object, or a null one if the allocator is out of memory.
+     */
+    template<typename T, typename... TArgs>
+    UniquePtr<T, AllocatorDeleter<T>> AllocateUnique(AbstractAllocator& allocator, TArgs&& ... args)
+    {
+        void* memory = allocator.Allocate(sizeof(T), Internal::GetObjectAlignment<T>());
+        if (!memory)
+            return UniquePtr<T, AllocatorDeleter<T>>(nullptr, AllocatorDeleter<T>(&allocator));
+
+        T* ptr = ::new(memory) T(std::forward<TArgs>(args)...);
+
+        return UniquePtr<T, AllocatorDeleter<T>>(ptr, AllocatorDeleter<T>(&allocator));
+    }
+
+    /**
+     * @brief Allocates an object and its reference count from the memory system, in a single allocation, and gives
+     * its ownership to a shared pointer.
+     *
+     * @tparam T The type of the object.
+     * @tparam Tag The category that the object is accounted to.
+     * @tparam TArgs The arguments to pass to the type's constructor.
+     *
+     * @param args The arguments to pass to the type's constructor.
+     *
+     * @return A shared pointer to the object, or a null one if the memory system is out of memory.
+     */
+    template<typename T, MemoryTag Tag, typename... TArgs>
+    SharedPtr<T> MakeShared(TArgs&& ... args)
+    {
+        using Block = Internal::SharedBlock<T>;
+
+        constexpr UInt16 alignment = Internal::GetObjectAlignment<Block>();
+
+        UnsafeHandle handle = MemorySystem::Allocate(sizeof(Block), alignment, AllocationFlags::Uninitialised, Tag);
+        if (!handle.Pointer)
+            return nullptr;
+
+        Block* block = Internal::ConstructShared<T>(handle.Pointer, nullptr, Tag, std::forward<TArgs>(args)...);
+
+        return SharedPtr<T>((T*) block->Storage, &block->Control);
+    }
+
+    /**
+     * @brief Allocates an object and its reference count from a custom allocator, in a single allocation, and gives
+     * its ownership to a shared pointer.
+     *
+     * @tparam T The type of the object.
+     * @tparam TArgs The arguments to pass to the type's constructor.
+     *
+     * @param allocator The allocator to allocate the object from. Must outlive the object.
+     * @param args The arguments to pass to the type's constructor.
+     *
+     * @return A shared pointer to the object, or a null one if the allocator is out of memory.
+     */
+    template<typename T, typename... TArgs>
+    SharedPtr<T> AllocateShared(AbstractAllocator& allocator, TArgs&& ... args)
+    {
+        using Block = Internal::SharedBlock<T>;
+
+        void* memory = allocator.Allocate(sizeof(Block), Internal::GetObjectAlignment<Block>());
+        if (!memory)
+            return nullptr;
+
+        Block* block = Internal::ConstructShared<T>(memory,
+                                                    &allocator,
+                                                    MemoryTag::Untagged,
+                                                    std::forward<TArgs>(args)...);
+
+        return SharedPtr<T>((T*) block->Storage, &block->Control);
+    }
+}
+
+#endif //OTTERENGINE_SMARTPOINTERS_H
@@ -2,19 +2,26 @@
 #define OTTERENGINE_ARCHETYPE_H
 
 #include "Core/Collections/List.h"
+#include "Core/Collections/StaticBitSet.h"
 #include "Core/Collections/UnsafeList.h"
 #include "Core/Collections/Dictionary.h"
 #include "ECS/Entity.h"
 #include "ECS/ComponentData.h"
 
+// The number of component types that can be registered, which is the number of bits of a fingerprint
+#ifndef OTR_ECS_MAX_COMPONENT_COUNT
+    #define OTR_ECS_MAX_COMPONENT_COUNT 256
+#endif
+
 namespace Otter
 {
     class EntityManager;
 
     /**
-     * @brief Alias for the archetype's fingerprint.
+     * @brief Alias for the archetype's fingerprint. It is stored inline, so fingerprints can be copied and used as
+     * keys without allocating.
      */
-    using ArchetypeFingerprint = BitSet;
+    using ArchetypeFingerprint = StaticBitSet<OTR_ECS_MAX_COMPONENT_COUNT>;
 
     /**
      * @brief The archetype class for the entity-component system.
@@ -36,10 +43,24 @@ namespace Otter
          * @param componentIds The component ids.
          */
         Archetype(const ArchetypeFingerprint& fingerprint, const List<ComponentId>& componentIds)
+            : Archetype(fingerprint, componentIds.GetData(), componentIds.GetCount())
+        {
+        }
+
+        /**
+         * @brief Constructor.
+         *
+         * @param fingerprint The component mask.
+         * @param componentIds The component ids.
+         * @param componentCount The number of component ids.
+         */
+        Archetype(const ArchetypeFingerprint& fingerprint,
+                  const ComponentId* const componentIds,
+                  const UInt64 componentCount)
         {
             m_Fingerprint = fingerprint;
 
-            for (UInt64 i = 0; i < componentIds.GetCount(); ++i)
+            for (UInt64 i = 0; i < componentCount; ++i)
                 m_ComponentIdToData.TryAdd(componentIds[i], UnsafeList());
 
             OTR_ASSERT(m_Fingerprint.GetTrueCount() == m_ComponentIdToData.GetCount(),
@@ -51,7 +72,6 @@ namespace Otter
          */
         ~Archetype()
         {
-            m_Fingerprint.ClearDestructive();
             m_EntityIds.ClearDestructive();
             m_ComponentIdToData.ClearDestructive();
             m_EntityIdToBufferPosition.ClearDestructive();
@@ -78,7 +98,7 @@ namespace Otter
             m_ComponentIdToData        = std::move(other.m_ComponentIdToData);
             m_EntityIdToBufferPosition = std::move(other.m_EntityIdToBufferPosition);
 
-            other.m_Fingerprint.ClearDestructive();
+            other.m_Fingerprint.Clear();
             other.m_EntityIds.ClearDestructive();
             other.m_ComponentIdToData.ClearDestructive();
             other.m_EntityIdToBufferPosition.ClearDestructive();
@@ -113,7 +133,7 @@ namespace Otter
             m_ComponentIdToData        = std::move(other.m_ComponentIdToData);
             m_EntityIdToBufferPosition = std::move(other.m_EntityIdToBufferPosition);
 
-            other.m_Fingerprint.ClearDestructive();
+            other.m_Fingerprint.Clear();
             other.m_EntityIds.ClearDestructive();
             other.m_ComponentIdToData.ClearDestructive();
             other.m_EntityIdToBufferPosition.ClearDestructive();
@@ -255,6 +275,9 @@ namespace Otter
          *
          * @return The requested components as a single pointer or a tuple of pointers, depending on the amount of
          * components requested.
+         *
+         * @note The pointers are only valid within the current frame, as MemorySystem::Defragment may move the
+         * component storage between frames.
          */
         template<typename TComponent, typename... TComponents>
         requires IsComponent<TComponent> && AreComponents<TComponents...>
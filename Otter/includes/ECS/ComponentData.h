@@ -103,7 +103,7 @@ namespace Otter
                     || m_ComponentSizes[i] != other.m_ComponentSizes[i])
                     return false;
 
-            for (UInt64 i = 0; i < m_Count; ++i)
+            for (UInt64 i = 0; i < m_BytesStored; ++i)
                 if (((Byte*) m_ComponentData.Pointer)[i] != ((Byte*) other.m_ComponentData.Pointer)[i])
                     return false;
 
@@ -142,7 +142,13 @@ namespace Otter
             m_ComponentSizes[m_Count] = componentSize;
 
             if (m_BytesStored + componentSize > m_ComponentData.Size)
-                m_ComponentData = MemorySystem::Reallocate(m_ComponentData, k_ResizingFactor * m_ComponentData.Size);
+            {
+                UInt64 newDataSize = k_ResizingFactor * m_ComponentData.Size;
+                while (m_BytesStored + componentSize > newDataSize)
+                    newDataSize *= k_ResizingFactor;
+
+                m_ComponentData = Unsafe::Reallocate(m_ComponentData, newDataSize, MemoryTag::ECS);
+            }
 
             MemorySystem::MemoryCopy(((Byte*) m_ComponentData.Pointer) + m_BytesStored, componentData, componentSize);
             m_BytesStored += componentSize;
@@ -165,24 +171,28 @@ namespace Otter
                 if (m_ComponentIds[i] != componentId)
                     continue;
 
-                m_BytesStored -= m_ComponentSizes[i];
+                const UInt64 removedSize = m_ComponentSizes[i];
+
+                UInt64 bytesStoredBefore = 0;
+                for (UInt64 j = 0; j < i; ++j)
+                    bytesStoredBefore += m_ComponentSizes[j];
+
+                const UInt64 bytesStoredAfter = m_BytesStored - bytesStoredBefore - removedSize;
+
+                m_BytesStored -= removedSize;
                 --m_Count;
 
                 if (i == m_Count)
                     return;
 
-                UInt64 bytesStoredAfter = 0;
-
-                for (UInt64 j = i; j < m_Count; ++j)
-                    bytesStoredAfter += m_ComponentSizes[j];
-
-                MemorySystem::MemoryCopy(((Byte*) m_ComponentData.Pointer) + m_BytesStored - bytesStoredAfter,
-                                         ((Byte*) m_ComponentData.Pointer) + m_BytesStored,
+                // The source and destination ranges overlap, so they have to be moved rather than copied
+                MemorySystem::MemoryMove(((Byte*) m_ComponentData.Pointer) + bytesStoredBefore,
+                                         ((Byte*) m_ComponentData.Pointer) + bytesStoredBefore + removedSize,
                                          bytesStoredAfter);
-                MemorySystem::MemoryCopy(m_ComponentSizes + i,
+                MemorySystem::MemoryMove(m_ComponentSizes + i,
                                          m_ComponentSizes + i + 1,
                                          (m_Count - i) * sizeof(UInt64));
-                MemorySystem::MemoryCopy(m_ComponentIds + i,
+                MemorySystem::MemoryMove(m_ComponentIds + i,
                                          m_ComponentIds + i + 1,
                                          (m_Count - i) * sizeof(ComponentId));
 
@@ -281,9 +291,9 @@ namespace Otter
              */
             OTR_INLINE DataIterator& operator++()
             {
+                m_ComponentData += *m_ComponentSizes;
                 m_ComponentIds++;
                 m_ComponentSizes++;
-                m_ComponentData += *m_ComponentSizes;
                 return *this;
             }
 
@@ -318,15 +328,9 @@ namespace Otter
              */
             OTR_INLINE bool operator==(const DataIterator& other) const
             {
-                if (m_ComponentIds != other.m_ComponentIds || m_ComponentSizes != other.m_ComponentSizes)
-                    return false;
-
-                // TODO: Create a Platform::MemoryCompare function to help with this
-                for (UInt64 i = 0; i < *m_ComponentSizes; i++)
-                    if (m_ComponentData[i] != other.m_ComponentData[i])
-                        return false;
-
-                return true;
+                return m_ComponentIds == other.m_ComponentIds
+                       && m_ComponentSizes == other.m_ComponentSizes
+                       && m_ComponentData == other.m_ComponentData;
             }
 
             /**
@@ -373,9 +377,9 @@ namespace Otter
             if (m_Capacity == 0)
                 return;
 
-            m_ComponentIds   = Buffer::New<ComponentId>(m_Capacity);
-            m_ComponentSizes = Buffer::New<UInt64>(m_Capacity);
-            m_ComponentData  = Unsafe::New(other.m_ComponentData.Size);
+            m_ComponentIds   = Buffer::New<ComponentId>(m_Capacity, MemoryTag::ECS);
+            m_ComponentSizes = Buffer::New<UInt64>(m_Capacity, MemoryTag::ECS);
+            m_ComponentData  = Unsafe::New(other.m_ComponentData.Size, MemoryTag::ECS);
 
             if (m_Count == 0)
                 return;
@@ -412,25 +416,30 @@ namespace Otter
          */
         void Expand()
         {
+            const UInt64 previousCapacity = m_Capacity;
             m_Capacity = m_Capacity == 0 ? k_DefaultCapacity : m_Capacity * k_ResizingFactor;
 
-            auto* newComponentIds   = Buffer::New<ComponentId>(m_Capacity);
-            auto* newComponentSizes = Buffer::New<UInt64>(m_Capacity);
-            auto newComponentData = Unsafe::New(m_Capacity * k_DefaultDataCapacity);
-
-            if (m_Count > 0)
+            if (!IsCreated())
             {
-                MemorySystem::MemoryCopy(newComponentIds, m_ComponentIds, m_Count * sizeof(ComponentId));
-                MemorySystem::MemoryCopy(newComponentSizes, m_ComponentSizes, m_Count * sizeof(UInt64));
-                MemorySystem::MemoryCopy(newComponentData.Pointer, m_ComponentData.Pointer, m_BytesStored);
+                m_ComponentIds   = Buffer::New<ComponentId>(m_Capacity, MemoryTag::ECS);
+                m_ComponentSizes = Buffer::New<UInt64>(m_Capacity, MemoryTag::ECS);
+                m_ComponentData  = Unsafe::New(m_Capacity * k_DefaultDataCapacity, MemoryTag::ECS);
+                return;
             }
 
-            if (IsCreated())
-                Destroy();
-
-            m_ComponentIds   = newComponentIds;
-            m_ComponentSizes = newComponentSizes;
-            m_ComponentData  = newComponentData;
+            m_ComponentIds = Buffer::Reallocate<ComponentId>(m_ComponentIds,
+                                                             previousCapacity,
+                                                             m_Capacity,
+                                                             MemoryTag::ECS);
+            m_ComponentSizes = Buffer::Reallocate<UInt64>(m_ComponentSizes,
+                                                          previousCapacity,
+                                                          m_Capacity,
+                                                          MemoryTag::ECS);
+
+            if (m_ComponentData.Size < m_Capacity * k_DefaultDataCapacity)
+                m_ComponentData = Unsafe::Reallocate(m_ComponentData,
+                                                     m_Capacity * k_DefaultDataCapacity,
+                                                     MemoryTag::ECS);
         }
 
         /**
@@ -439,19 +448,28 @@ namespace Otter
         void Destroy()
         {
             if (m_ComponentIds)
-                Buffer::Delete<ComponentId>(m_ComponentIds, m_Capacity);
+                Buffer::Delete<ComponentId>(m_ComponentIds, m_Capacity, MemoryTag::ECS);
 
             if (m_ComponentSizes)
-                Buffer::Delete<UInt64>(m_ComponentSizes, m_Capacity);
+                Buffer::Delete<UInt64>(m_ComponentSizes, m_Capacity, MemoryTag::ECS);
 
             if (m_ComponentData.Pointer && m_ComponentData.Size > 0)
-                Unsafe::Delete(m_ComponentData);
+                Unsafe::Delete(m_ComponentData, MemoryTag::ECS);
 
             m_ComponentIds   = nullptr;
             m_ComponentSizes = nullptr;
             m_ComponentData.Pointer = nullptr;
         }
     };
+
+    /**
+     * @brief A component data container only holds pointers to its heap buffers, so moving its bytes is enough to
+     * move it.
+     */
+    template<>
+    struct IsTriviallyRelocatable<ComponentData> : std::true_type
+    {
+    };
 }
 
 #endif //OTTERENGINE_COMPONENTDATA_H
@@ -2,6 +2,7 @@
 #define OTTERENGINE_ENTITYMANAGER_H
 
 #include "Core/Collections/List.h"
+#include "Core/Collections/InlineList.h"
 #include "Core/Collections/Stack.h"
 #include "Core/Collections/HashSet.h"
 #include "Core/Collections/Dictionary.h"
@@ -68,6 +69,9 @@ namespace Otter
          * @tparam TComponents The rest of the components.
          *
          * @return A reference to the entity manager.
+         *
+         * @note At most OTR_ECS_MAX_COMPONENT_COUNT components can be registered. Components past the limit are not
+         * registered and an error is logged.
          */
         template<typename TComponent, typename... TComponents>
         requires IsComponent<TComponent> && AreComponents<TComponents...>
@@ -164,6 +168,9 @@ namespace Otter
          * @param entity The entity.
          *
          * @return A pointer to the component.
+         *
+         * @note Components are stored in relocatable memory, which MemorySystem::Defragment may move between frames.
+         * The pointer is only valid within the current frame and must not be kept across frames.
          */
         template<typename TComponent>
         requires IsComponent<TComponent>
@@ -172,13 +179,14 @@ namespace Otter
             OTR_STATIC_ASSERT(TComponent::Id > 0, "Component Id must be greater than 0.")
             OTR_ASSERT(entity.IsValid(), "Entity must be valid.")
 
-            ArchetypeFingerprint fingerprint;
-            if (!m_EntityToFingerprint.TryGet(entity.GetId(), &fingerprint))
+            const ArchetypeFingerprint* fingerprint = m_EntityToFingerprint[entity.GetId()];
+            if (!fingerprint)
                 return nullptr;
 
-            OTR_ASSERT(m_FingerprintToArchetype.ContainsKey(fingerprint), "Archetype not found.")
+            Archetype* archetype = m_FingerprintToArchetype[*fingerprint];
+            OTR_ASSERT(archetype, "Archetype not found.")
 
-            return m_FingerprintToArchetype[fingerprint]->GetComponentsForEntityUnsafe<TComponent>(entity.GetId());
+            return archetype->GetComponentsForEntityUnsafe<TComponent>(entity.GetId());
         }
 
         /**
@@ -226,6 +234,11 @@ namespace Otter
          * @tparam TComponents The rest of the components.
          *
          * @param callback The function to call for each set of components.
+         *
+         * @note The component pointers passed to the callback are only valid within the current frame, as their
+         * relocatable storage may be moved by MemorySystem::Defragment between frames.
+         * @note Queries for more than one component collect the matching archetypes in frame memory, which is only
+         * available on the main thread, so such queries must only be run on the main thread.
          */
         template<typename TComponent, typename... TComponents>
         requires IsComponent<TComponent> && AreComponents<TComponents...>
@@ -275,20 +288,25 @@ namespace Otter
 
                 HashSet<ArchetypeFingerprint> fingerprints;
 
-                for (const auto& fingerprint: *m_ComponentToFingerprints[TComponent::Id])
-                    if (fingerprint.Includes(requestedFingerprint))
-                        fingerprints.TryAdd(fingerprint);
-
-                ([&]
                 {
-                    OTR_ASSERT(m_ComponentToFingerprints.ContainsKey(TComponents::Id),
-                               "Component with id {0} not registered.",
-                               TComponents::Id)
+                    // The set only lives for this call, so it is built in frame memory
+                    FrameMemoryScope frameMemory;
 
-                    for (const auto& fingerprint: *m_ComponentToFingerprints[TComponents::Id])
+                    for (const auto& fingerprint: *m_ComponentToFingerprints[TComponent::Id])
                         if (fingerprint.Includes(requestedFingerprint))
                             fingerprints.TryAdd(fingerprint);
-                }(), ...);
+
+                    ([&]
+                    {
+                        OTR_ASSERT(m_ComponentToFingerprints.ContainsKey(TComponents::Id),
+                                   "Component with id {0} not registered.",
+                                   TComponents::Id)
+
+                        for (const auto& fingerprint: *m_ComponentToFingerprints[TComponents::Id])
+                            if (fingerprint.Includes(requestedFingerprint))
+                                fingerprints.TryAdd(fingerprint);
+                    }(), ...);
+                }
 
                 for (const auto& fingerprint: fingerprints)
                     m_FingerprintToArchetype[fingerprint]->ForEach(callback);
@@ -361,9 +379,9 @@ namespace Otter
             Archetype Build();
 
         private:
-            EntityManager* m_EntityManager;
-            ArchetypeFingerprint m_Fingerprint;
-            List<ComponentId>    m_ComponentIds;
+            EntityManager*             m_EntityManager;
+            ArchetypeFingerprint       m_Fingerprint;
+            InlineList<ComponentId, 8> m_ComponentIds;
 
             /**
              * @brief Adds a component to the archetype. Used internally.
@@ -507,9 +525,9 @@ namespace Otter
         bool                                                m_ComponentsLock = false;
 
         // Archetype Registry
-        Dictionary<ArchetypeFingerprint, Archetype>      m_FingerprintToArchetype;
-        Dictionary<ArchetypeFingerprint, Archetype>      m_FingerprintToArchetypeToAdd;
-        Dictionary<ArchetypeFingerprint, List<EntityId>> m_FingerprintToEntitiesToRemove;
+        Dictionary<ArchetypeFingerprint, Archetype>               m_FingerprintToArchetype;
+        Dictionary<ArchetypeFingerprint, Archetype>               m_FingerprintToArchetypeToAdd;
+        Dictionary<ArchetypeFingerprint, InlineList<EntityId, 4>> m_FingerprintToEntitiesToRemove;
 
         /**
          * @brief Destroys the entity manager.
@@ -557,7 +575,16 @@ namespace Otter
             if (m_ComponentToFingerprintIndex.ContainsKey(TComponent::Id))
                 return;
 
+            // Fingerprints have a fixed number of bits, so the limit is checked in every build
             UInt64 index = m_ComponentToFingerprintIndex.GetCount();
+            if (index >= OTR_ECS_MAX_COMPONENT_COUNT)
+            {
+                OTR_LOG_ERROR("Cannot register more than {0} components, component with id '{1}' is ignored.",
+                              OTR_ECS_MAX_COMPONENT_COUNT,
+                              TComponent::Id)
+                return;
+            }
+
             m_ComponentToFingerprintIndex.TryAdd(TComponent::Id, index);
 
             m_ComponentToFingerprints.TryAdd(TComponent::Id, List<ArchetypeFingerprint>());
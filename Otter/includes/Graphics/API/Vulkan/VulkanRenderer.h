@@ -1,6 +1,7 @@
 #ifndef OTTERENGINE_VULKANRENDERER_H
 #define OTTERENGINE_VULKANRENDERER_H
 
+#include "Core/SmartPointers.h"
 #include "Graphics/Abstractions/RendererAPI.h"
 #include "Graphics/API/Vulkan/Types/VulkanTypes.Device.h"
 #include "Graphics/API/Vulkan/Types/VulkanTypes.Swapchain.h"
@@ -46,9 +47,9 @@ namespace Otter::Graphics::Vulkan
         VkPipelineLayout    m_PipelineLayout = VK_NULL_HANDLE;
         VkPipeline          m_Pipeline       = VK_NULL_HANDLE;
 
-        VulkanVertexBuffer * m_VertexBuffer  = nullptr;
-        VulkanIndexBuffer  * m_IndexBuffer   = nullptr;
-        VulkanUniformBuffer* m_UniformBuffer = nullptr;
+        UniquePtr<VulkanVertexBuffer>  m_VertexBuffer  = nullptr;
+        UniquePtr<VulkanIndexBuffer>   m_IndexBuffer   = nullptr;
+        UniquePtr<VulkanUniformBuffer> m_UniformBuffer = nullptr;
 
         // HELP: VkInstance related
         static void CreateVulkanInstance(const VkAllocationCallbacks* allocator, VkInstance* outInstance);
@@ -213,6 +213,17 @@ namespace Otter
          */
         static void MemoryClear(void* block, UInt64 size);
 
+        /**
+         * @brief Fills memory with a byte value.
+         *
+         * @param block The block of memory to fill.
+         * @param value The value to fill the memory with.
+         * @param size The size of the memory to fill.
+         *
+         * @note This function is implemented for each platform separately.
+         */
+        static void MemorySet(void* block, Byte value, UInt64 size);
+
         /**
          * @brief Used to sleep for a certain amount of milliseconds.
          *
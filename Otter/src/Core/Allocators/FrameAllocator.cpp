@@ -0,0 +1,41 @@
+#include "Core/Allocators/FrameAllocator.h"
+
+namespace Otter
+{
+    void* FrameAllocator::Allocate(const UInt64 size, const UInt16 alignment)
+    {
+        void* block = m_Buffers[m_CurrentBuffer].Allocate(size, alignment);
+
+        m_MemoryUsed = m_Buffers[0].GetMemoryUsed() + m_Buffers[1].GetMemoryUsed();
+
+        return block;
+    }
+
+    void FrameAllocator::Free(void* block)
+    {
+        OTR_INTERNAL_ASSERT_MSG(Contains(block), "Block does not belong to the allocator")
+    }
+
+    void FrameAllocator::GetMemoryFootprint(const void* const block,
+                                            UInt64* outSize,
+                                            UInt64* outOffset,
+                                            UInt16* outPadding,
+                                            UInt16* outAlignment) const
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+
+        const UInt8 buffer = m_Buffers[0].Contains(block) ? 0 : 1;
+        m_Buffers[buffer].GetMemoryFootprint(block, outSize, outOffset, outPadding, outAlignment);
+
+        if (buffer == 1)
+            *outOffset += m_Buffers[0].GetMemorySize();
+    }
+
+    void FrameAllocator::SwapBuffers()
+    {
+        m_CurrentBuffer ^= 1;
+        m_Buffers[m_CurrentBuffer].Clear();
+
+        m_MemoryUsed = m_Buffers[0].GetMemoryUsed() + m_Buffers[1].GetMemoryUsed();
+    }
+}
@@ -1,3 +1,5 @@
+#include <bit>
+
 #include "Core/Allocators/FreeListAllocator.h"
 
 namespace Otter
@@ -6,6 +8,9 @@ namespace Otter
     {
         OTR_INTERNAL_ASSERT_MSG(GetMemoryUsed() <= GetMemorySize(), "Memory used is greater than the allocator size")
 
+        if (m_Policy == Policy::SegregatedFit)
+            return AllocateSegregated(size, alignment);
+
         if (size < sizeof(Node))
         {
             OTR_LOG_WARNING("Allocation size is less than or equal to the size of a Free List node ({0} < {1})."
@@ -32,25 +37,70 @@ namespace Otter
         }
 
         if (!foundNode)
+            return nullptr;
+
+        return AllocateFromNode(foundNode, previousNode, headerPadding, size);
+    }
+
+    void* FreeListAllocator::AllocateBelow(const void* const limit, const UInt64 size, const UInt16 alignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(limit != nullptr, "Limit must not be null")
+
+        if (m_Policy == Policy::SegregatedFit)
         {
-            OTR_LOG_FATAL("Free list has no free memory! Unable to perform new allocation!")
+            const UInt64 blockSize    = GetSegregatedBlockSize(size);
+            const UInt64 requiredSize = alignment > OTR_PLATFORM_MEMORY_ALIGNMENT
+                                        ? blockSize + alignment + k_MinBlockSize
+                                        : blockSize;
+
+            // Physical blocks are walked in address order, up to the sentinel at the end of the memory
+            for (auto* block = (Block*) m_Memory;
+                 block->Link.Size > 0 && (UIntPtr) block < (UIntPtr) limit;
+                 block = GetNextPhysical(block))
+            {
+                if (!IsFree(block) || block->Link.Size < requiredSize)
+                    continue;
+
+                RemoveSegregated(block);
+                return AllocateFromSegregatedBlock(block, blockSize, alignment);
+            }
+
             return nullptr;
         }
 
+        // Free nodes are sorted by address, so the first one that fits is the lowest one
+        Node* itCurrent  = m_Head;
+        Node* itPrevious = nullptr;
+
+        while (itCurrent && (UIntPtr) itCurrent < (UIntPtr) limit)
+        {
+            const UIntPtr padding = GetAlignmentPadding((UIntPtr) itCurrent, alignment);
+            if (itCurrent->Size >= size + padding)
+                return AllocateFromNode(itCurrent, itPrevious, padding, size);
+
+            itPrevious = itCurrent;
+            itCurrent  = itCurrent->Next;
+        }
+
+        return nullptr;
+    }
+
+    void* FreeListAllocator::AllocateFromNode(Node* node, Node* previous, const UInt16 headerPadding, const UInt64 size)
+    {
         UInt16 bodyPadding    = headerPadding - OTR_ALIGNED_OFFSET(sizeof(Header), OTR_PLATFORM_MEMORY_ALIGNMENT);
         UInt64 requiredSpace  = size + headerPadding;
-        UInt64 remainingSpace = foundNode->Size - requiredSpace;
+        UInt64 remainingSpace = node->Size - requiredSpace;
 
         if (remainingSpace > sizeof(Node))
         {
-            Node* nextNode = (Node*) ((UIntPtr) foundNode + requiredSpace);
+            Node* nextNode = (Node*) ((UIntPtr) node + requiredSpace);
             nextNode->Size = remainingSpace;
             nextNode->Next = nullptr;
-            Insert(nextNode, foundNode);
+            Insert(nextNode, node);
         }
-        Remove(foundNode, previousNode);
+        Remove(node, previous);
 
-        auto* header = (Header*) ((UIntPtr*) foundNode + bodyPadding);
+        auto* header = (Header*) ((UIntPtr) node + bodyPadding);
         header->Size    = requiredSpace;
         header->Padding = bodyPadding;
 
@@ -67,6 +117,12 @@ namespace Otter
 
     void FreeListAllocator::Free(void* block)
     {
+        if (m_Policy == Policy::SegregatedFit)
+        {
+            FreeSegregated(block);
+            return;
+        }
+
         const UIntPtr headerAddress =
                           (UIntPtr) block - OTR_ALIGNED_OFFSET(sizeof(Header), OTR_PLATFORM_MEMORY_ALIGNMENT);
         const Header* const header = (Header*) headerAddress;
@@ -76,22 +132,20 @@ namespace Otter
             OTR_LOG_ERROR("Freed size is greater than or equal to the allocator size!")
         }
 
-        Node* nodeToInsert = (Node*) (headerAddress);
-        nodeToInsert->Size = header->Size + header->Padding;
+        const UInt64 blockSize = header->Size;
+
+        Node* nodeToInsert = (Node*) (headerAddress - header->Padding);
+        nodeToInsert->Size = blockSize;
         nodeToInsert->Next = nullptr;
 
         Node* iteratorCurrent  = m_Head;
         Node* iteratorPrevious = nullptr;
-        while (iteratorCurrent)
+        while (iteratorCurrent && (UIntPtr) block > (UIntPtr) iteratorCurrent)
         {
-            if ((UIntPtr) block < (UIntPtr) iteratorCurrent)
-            {
-                Insert(nodeToInsert, iteratorPrevious);
-                break;
-            }
             iteratorPrevious = iteratorCurrent;
             iteratorCurrent  = iteratorCurrent->Next;
         }
+        Insert(nodeToInsert, iteratorPrevious);
 
         m_MemoryUsed -= nodeToInsert->Size;
 
@@ -100,15 +154,123 @@ namespace Otter
         OTR_INTERNAL_ASSERT_MSG(GetMemoryUsed() <= GetMemorySize(), "Memory used is greater than the allocator size")
     }
 
+    bool FreeListAllocator::TryResize(void* block, const UInt64 size)
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Size must be greater than 0 bytes")
+
+        if (m_Policy == Policy::SegregatedFit)
+            return TryResizeSegregated(block, size);
+
+        const UIntPtr headerAddress =
+                          (UIntPtr) block - OTR_ALIGNED_OFFSET(sizeof(Header), OTR_PLATFORM_MEMORY_ALIGNMENT);
+        auto* header = (Header*) headerAddress;
+
+        const UIntPtr blockStart    = headerAddress - header->Padding;
+        const UIntPtr blockEnd      = blockStart + header->Size;
+        const UInt64  requiredSpace = OTR_ALIGNED_OFFSET((UIntPtr) block + size - blockStart,
+                                                         OTR_PLATFORM_MEMORY_ALIGNMENT);
+
+        if (requiredSpace == header->Size)
+            return true;
+
+        // Free nodes are sorted by address, so the node after the block is the first one past its end
+        Node* iteratorCurrent  = m_Head;
+        Node* iteratorPrevious = nullptr;
+        while (iteratorCurrent && (UIntPtr) iteratorCurrent < blockEnd)
+        {
+            iteratorPrevious = iteratorCurrent;
+            iteratorCurrent  = iteratorCurrent->Next;
+        }
+
+        const bool isNextFree = iteratorCurrent && (UIntPtr) iteratorCurrent == blockEnd;
+
+        if (requiredSpace > header->Size)
+        {
+            const UInt64 extraSpace = requiredSpace - header->Size;
+            if (!isNextFree || iteratorCurrent->Size < extraSpace)
+                return false;
+
+            UInt64 takenSpace     = extraSpace;
+            UInt64 remainingSpace = iteratorCurrent->Size - extraSpace;
+            Remove(iteratorCurrent, iteratorPrevious);
+
+            if (remainingSpace > sizeof(Node))
+            {
+                Node* nextNode = (Node*) (blockEnd + extraSpace);
+                nextNode->Size = remainingSpace;
+                nextNode->Next = nullptr;
+                Insert(nextNode, iteratorPrevious);
+            }
+            else
+            {
+                takenSpace += remainingSpace;
+            }
+
+            header->Size += takenSpace;
+            m_MemoryUsed += takenSpace;
+
+            return true;
+        }
+
+        UInt64 releasedSpace = header->Size - requiredSpace;
+        if (isNextFree)
+        {
+            releasedSpace += iteratorCurrent->Size;
+            Remove(iteratorCurrent, iteratorPrevious);
+        }
+        else if (releasedSpace <= sizeof(Node))
+        {
+            return true;
+        }
+
+        Node* tailNode = (Node*) (blockStart + requiredSpace);
+        tailNode->Size = releasedSpace;
+        tailNode->Next = nullptr;
+        Insert(tailNode, iteratorPrevious);
+
+        m_MemoryUsed -= header->Size - requiredSpace;
+        header->Size = requiredSpace;
+
+        return true;
+    }
+
     void FreeListAllocator::Clear()
     {
         m_MemoryUsed = 0;
 
+        if (m_Policy == Policy::SegregatedFit)
+        {
+            ClearSegregated();
+            return;
+        }
+
         m_Head = (Node*) m_Memory;
         m_Head->Size = m_MemorySize;
         m_Head->Next = nullptr;
     }
 
+    void FreeListAllocator::GetBlockBounds(const void* const block, UInt64* outOffset, UInt64* outSize) const
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+
+        if (m_Policy == Policy::SegregatedFit)
+        {
+            const Block* const segregatedBlock = (Block*) ((UIntPtr) block - k_BlockHeaderSize);
+
+            *outOffset = (UIntPtr) segregatedBlock - (UIntPtr) m_Memory;
+            *outSize   = segregatedBlock->Link.Size;
+            return;
+        }
+
+        const UIntPtr headerAddress =
+                          (UIntPtr) block - OTR_ALIGNED_OFFSET(sizeof(Header), OTR_PLATFORM_MEMORY_ALIGNMENT);
+        const Header* const header = (Header*) headerAddress;
+
+        *outOffset = headerAddress - header->Padding - (UIntPtr) m_Memory;
+        *outSize   = header->Size;
+    }
+
     void FreeListAllocator::GetMemoryFootprint(const void* const block,
                                                UInt64* outSize,
                                                UInt64* outOffset,
@@ -117,6 +279,17 @@ namespace Otter
     {
         OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
 
+        if (m_Policy == Policy::SegregatedFit)
+        {
+            const Block* const segregatedBlock = (Block*) ((UIntPtr) block - k_BlockHeaderSize);
+
+            *outSize      = segregatedBlock->Link.Size;
+            *outOffset    = (UIntPtr) block - (UIntPtr) m_Memory;
+            *outPadding   = 0;
+            *outAlignment = OTR_PLATFORM_MEMORY_ALIGNMENT;
+            return;
+        }
+
         const UIntPtr headerAddress =
                           (UIntPtr) block - OTR_ALIGNED_OFFSET(sizeof(Header), OTR_PLATFORM_MEMORY_ALIGNMENT);
         const Header* const header = (Header*) headerAddress;
@@ -257,6 +430,273 @@ namespace Otter
         }
     }
 
+    void* FreeListAllocator::AllocateSegregated(const UInt64 size, const UInt16 alignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Alignment must be a power of two")
+
+        const UInt64 blockSize = GetSegregatedBlockSize(size);
+
+        // Over-aligned requests search for enough extra space to split off a leading free block
+        const bool isOverAligned = alignment > OTR_PLATFORM_MEMORY_ALIGNMENT;
+        Block* block = FindSegregatedFit(isOverAligned ? blockSize + alignment + k_MinBlockSize : blockSize);
+
+        if (!block)
+            return nullptr;
+
+        return AllocateFromSegregatedBlock(block, blockSize, alignment);
+    }
+
+    void* FreeListAllocator::AllocateFromSegregatedBlock(Block* block, const UInt64 blockSize, const UInt16 alignment)
+    {
+        if (alignment > OTR_PLATFORM_MEMORY_ALIGNMENT)
+        {
+            UIntPtr data = (UIntPtr) block + k_BlockHeaderSize;
+            if ((data & (alignment - 1)) != 0)
+            {
+                const UInt64 gap = OTR_ALIGNED_OFFSET(data + k_MinBlockSize, (UIntPtr) alignment) - data;
+
+                auto* alignedBlock = (Block*) ((UIntPtr) block + gap);
+                alignedBlock->Link.Size        = block->Link.Size - gap;
+                alignedBlock->PreviousPhysical = (UIntPtr) block;
+                SetPreviousPhysical(GetNextPhysical(alignedBlock), alignedBlock);
+
+                block->Link.Size = gap;
+                InsertSegregated(block);
+
+                block = alignedBlock;
+            }
+        }
+
+        SplitSegregated(block, blockSize);
+        SetFree(block, false);
+
+        m_MemoryUsed += block->Link.Size;
+
+        return (void*) ((UIntPtr) block + k_BlockHeaderSize);
+    }
+
+    void FreeListAllocator::FreeSegregated(void* block)
+    {
+        auto* toFree = (Block*) ((UIntPtr) block - k_BlockHeaderSize);
+
+        OTR_INTERNAL_ASSERT_MSG(!IsFree(toFree), "Block has already been freed")
+        OTR_INTERNAL_ASSERT_MSG(toFree->Link.Size <= m_MemoryUsed, "Freed size is greater than the used memory")
+
+        m_MemoryUsed -= toFree->Link.Size;
+
+        Block* previous = GetPreviousPhysical(toFree);
+        if (previous && IsFree(previous))
+        {
+            RemoveSegregated(previous);
+            previous->Link.Size += toFree->Link.Size;
+            toFree = previous;
+        }
+
+        Block* next = GetNextPhysical(toFree);
+        if (IsFree(next))
+        {
+            RemoveSegregated(next);
+            toFree->Link.Size += next->Link.Size;
+        }
+
+        SetPreviousPhysical(GetNextPhysical(toFree), toFree);
+        InsertSegregated(toFree);
+
+        OTR_INTERNAL_ASSERT_MSG(GetMemoryUsed() <= GetMemorySize(), "Memory used is greater than the allocator size")
+    }
+
+    bool FreeListAllocator::TryResizeSegregated(void* block, const UInt64 size)
+    {
+        auto* toResize = (Block*) ((UIntPtr) block - k_BlockHeaderSize);
+
+        OTR_INTERNAL_ASSERT_MSG(!IsFree(toResize), "Block has already been freed")
+
+        const UInt64 blockSize    = GetSegregatedBlockSize(size);
+        const UInt64 previousSize = toResize->Link.Size;
+
+        Block* next = GetNextPhysical(toResize);
+        if (blockSize > previousSize && (!IsFree(next) || previousSize + next->Link.Size < blockSize))
+            return false;
+
+        // Merging the following free block first lets a shrunk tail join it, instead of leaving two free blocks
+        // next to each other
+        if (IsFree(next))
+        {
+            RemoveSegregated(next);
+            toResize->Link.Size += next->Link.Size;
+            SetPreviousPhysical(GetNextPhysical(toResize), toResize);
+        }
+
+        SplitSegregated(toResize, blockSize);
+
+        m_MemoryUsed = m_MemoryUsed - previousSize + toResize->Link.Size;
+
+        return true;
+    }
+
+    void FreeListAllocator::ClearSegregated()
+    {
+        OTR_INTERNAL_ASSERT_MSG(((UIntPtr) m_Memory & (OTR_PLATFORM_MEMORY_ALIGNMENT - 1)) == 0,
+                                "Memory must be aligned to the platform alignment")
+
+        m_Head             = nullptr;
+        m_FirstLevelBitmap = 0;
+        for (auto& bitmap: m_SecondLevelBitmaps)
+            bitmap = 0;
+        for (auto& lists: m_SegregatedLists)
+            for (auto& list: lists)
+                list = nullptr;
+
+        // The last header of the memory is a zero-sized sentinel that is never free, so that merging never has to
+        // check whether it has reached the end of the memory
+        const UInt64 usableSize = (m_MemorySize & ~(UInt64) (OTR_PLATFORM_MEMORY_ALIGNMENT - 1)) - k_BlockHeaderSize;
+        OTR_INTERNAL_ASSERT_MSG(m_MemorySize >= k_MinBlockSize + k_BlockHeaderSize,
+                                "Memory is too small for the segregated fit policy")
+        OTR_INTERNAL_ASSERT_MSG(usableSize < (1ull << k_FirstLevelMax),
+                                "Memory is too large for the segregated fit policy")
+
+        auto* block = (Block*) m_Memory;
+        block->PreviousPhysical = 0;
+        block->Link.Size        = usableSize;
+
+        auto* sentinel = GetNextPhysical(block);
+        sentinel->PreviousPhysical = (UIntPtr) block;
+        sentinel->Link.Size        = 0;
+
+        InsertSegregated(block);
+    }
+
+    void FreeListAllocator::InsertSegregated(Block* block)
+    {
+        UInt64 firstLevel, secondLevel;
+        MapSegregatedSize(block->Link.Size, &firstLevel, &secondLevel);
+
+        Node* head = m_SegregatedLists[firstLevel][secondLevel];
+        if (head)
+            GetBlock(head)->PreviousFree = &block->Link;
+
+        SetFree(block, true);
+        block->Link.Next    = head;
+        block->PreviousFree = nullptr;
+
+        m_SegregatedLists[firstLevel][secondLevel] = &block->Link;
+        m_FirstLevelBitmap |= 1ull << firstLevel;
+        m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    }
+
+    void FreeListAllocator::RemoveSegregated(Block* block)
+    {
+        UInt64 firstLevel, secondLevel;
+        MapSegregatedSize(block->Link.Size, &firstLevel, &secondLevel);
+
+        Node* previous = block->PreviousFree;
+        Node* next     = block->Link.Next;
+
+        if (next)
+            GetBlock(next)->PreviousFree = previous;
+
+        if (previous)
+        {
+            previous->Next = next;
+        }
+        else
+        {
+            m_SegregatedLists[firstLevel][secondLevel] = next;
+
+            if (!next)
+            {
+                m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+
+                if (m_SecondLevelBitmaps[firstLevel] == 0)
+                    m_FirstLevelBitmap &= ~(1ull << firstLevel);
+            }
+        }
+
+        block->Link.Next    = nullptr;
+        block->PreviousFree = nullptr;
+    }
+
+    FreeListAllocator::Block* FreeListAllocator::FindSegregatedFit(UInt64 size)
+    {
+        // Rounding up to the next size class guarantees that any block of the found class fits the size
+        if (size >= k_SmallBlockSize)
+            size += (1ull << (std::bit_width(size) - 1 - k_SecondLevelCountLog2)) - 1;
+
+        UInt64 firstLevel, secondLevel;
+        MapSegregatedSize(size, &firstLevel, &secondLevel);
+
+        if (firstLevel >= k_FirstLevelCount)
+            return nullptr;
+
+        UInt32 secondLevelMap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+        if (secondLevelMap == 0)
+        {
+            const UInt64 firstLevelMap = m_FirstLevelBitmap & (~0ull << (firstLevel + 1));
+            if (firstLevelMap == 0)
+                return nullptr;
+
+            firstLevel     = std::countr_zero(firstLevelMap);
+            secondLevelMap = m_SecondLevelBitmaps[firstLevel];
+        }
+
+        secondLevel = std::countr_zero(secondLevelMap);
+
+        Block* block = GetBlock(m_SegregatedLists[firstLevel][secondLevel]);
+        RemoveSegregated(block);
+
+        return block;
+    }
+
+    void FreeListAllocator::SplitSegregated(Block* block, const UInt64 size)
+    {
+        const UInt64 remainingSize = block->Link.Size - size;
+        if (remainingSize < k_MinBlockSize)
+            return;
+
+        auto* remaining = (Block*) ((UIntPtr) block + size);
+        remaining->Link.Size        = remainingSize;
+        remaining->PreviousPhysical = (UIntPtr) block;
+        SetPreviousPhysical(GetNextPhysical(remaining), remaining);
+
+        block->Link.Size = size;
+        InsertSegregated(remaining);
+    }
+
+    FreeListAllocator::Node* FreeListAllocator::FindSegregatedListHead(const UInt64 listIndex) const
+    {
+        for (UInt64 i = listIndex; i < k_FirstLevelCount * k_SecondLevelCount; ++i)
+        {
+            Node* head = m_SegregatedLists[i / k_SecondLevelCount][i % k_SecondLevelCount];
+            if (head)
+                return head;
+        }
+
+        return nullptr;
+    }
+
+    UInt64 FreeListAllocator::GetSegregatedListIndex(const Node* node)
+    {
+        UInt64 firstLevel, secondLevel;
+        MapSegregatedSize(node->Size, &firstLevel, &secondLevel);
+
+        return firstLevel * k_SecondLevelCount + secondLevel;
+    }
+
+    void FreeListAllocator::MapSegregatedSize(const UInt64 size, UInt64* outFirstLevel, UInt64* outSecondLevel)
+    {
+        if (size < k_SmallBlockSize)
+        {
+            *outFirstLevel  = 0;
+            *outSecondLevel = size / (k_SmallBlockSize / k_SecondLevelCount);
+            return;
+        }
+
+        const UInt64 log2 = std::bit_width(size) - 1;
+
+        *outFirstLevel  = log2 - (k_FirstLevelShift - 1);
+        *outSecondLevel = (size >> (log2 - k_SecondLevelCountLog2)) ^ k_SecondLevelCount;
+    }
+
     UIntPtr FreeListAllocator::GetAlignmentPadding(const UIntPtr& address, const UInt16 alignment)
     {
         OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Alignment must be a power of two")
@@ -0,0 +1,39 @@
+#include "Core/Allocators/LinearAllocator.h"
+
+namespace Otter
+{
+    void* LinearAllocator::Allocate(const UInt64 size, const UInt16 alignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Alignment must be a power of two")
+
+        const UIntPtr current = (UIntPtr) m_Memory + m_MemoryUsed;
+        const UIntPtr aligned = OTR_ALIGNED_OFFSET(current, (UIntPtr) alignment);
+
+        if (aligned + size > (UIntPtr) m_Memory + m_MemorySize)
+            return nullptr;
+
+        m_MemoryUsed = aligned + size - (UIntPtr) m_Memory;
+
+        return (void*) aligned;
+    }
+
+    void LinearAllocator::Free(void* block)
+    {
+        OTR_INTERNAL_ASSERT_MSG(Contains(block), "Block does not belong to the allocator")
+    }
+
+    void LinearAllocator::GetMemoryFootprint(const void* const block,
+                                             UInt64* outSize,
+                                             UInt64* outOffset,
+                                             UInt16* outPadding,
+                                             UInt16* outAlignment) const
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+        OTR_INTERNAL_ASSERT_MSG(Contains(block), "Block does not belong to the allocator")
+
+        *outOffset    = (UIntPtr) block - (UIntPtr) m_Memory;
+        *outSize      = m_MemoryUsed - *outOffset;
+        *outPadding   = 0;
+        *outAlignment = OTR_PLATFORM_MEMORY_ALIGNMENT;
+    }
+}
@@ -0,0 +1,208 @@
+#include "Core/Allocators/PoolAllocator.h"
+
+namespace Otter
+{
+    PoolAllocator::PoolAllocator(void* memory,
+                                 const UInt64 memorySize,
+                                 const UInt64 blockSize,
+                                 const UInt16 blockAlignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/)
+        : AbstractAllocator(memory, memorySize), m_FixedMemorySize(memorySize), m_BlockSize(0),
+          m_BlockAlignment(blockAlignment), m_ChunkSize(0), m_Upstream(nullptr), m_FreeBlocks(nullptr),
+          m_Chunks(nullptr)
+    {
+        OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(blockAlignment), "Block alignment must be a power of two")
+        OTR_INTERNAL_ASSERT_MSG(blockSize > 0, "Block size must be greater than 0")
+
+        m_BlockSize = OTR_ALIGNED_OFFSET(blockSize < sizeof(void*) ? sizeof(void*) : blockSize,
+                                         (UInt64) blockAlignment);
+
+        Clear();
+    }
+
+    PoolAllocator::PoolAllocator(const UInt64 blockSize,
+                                 const UInt16 blockAlignment,
+                                 const UInt64 chunkSize,
+                                 AbstractAllocator* upstream)
+        : AbstractAllocator(), m_FixedMemorySize(0), m_BlockSize(0), m_BlockAlignment(blockAlignment),
+          m_ChunkSize(chunkSize), m_Upstream(upstream), m_FreeBlocks(nullptr), m_Chunks(nullptr)
+    {
+        OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(blockAlignment), "Block alignment must be a power of two")
+        OTR_INTERNAL_ASSERT_MSG(blockSize > 0, "Block size must be greater than 0")
+
+        m_BlockSize = OTR_ALIGNED_OFFSET(blockSize < sizeof(void*) ? sizeof(void*) : blockSize,
+                                         (UInt64) blockAlignment);
+
+        OTR_INTERNAL_ASSERT_MSG(!m_Upstream || m_ChunkSize >= sizeof(Chunk) + m_BlockAlignment + m_BlockSize,
+                                "Chunk size must fit at least one block")
+    }
+
+    PoolAllocator::~PoolAllocator()
+    {
+        ReleaseChunks();
+
+        m_Memory = nullptr;
+    }
+
+    PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept
+        : AbstractAllocator(), m_FixedMemorySize(0), m_BlockSize(0), m_BlockAlignment(0), m_ChunkSize(0),
+          m_Upstream(nullptr), m_FreeBlocks(nullptr), m_Chunks(nullptr)
+    {
+        *this = std::move(other);
+    }
+
+    PoolAllocator& PoolAllocator::operator=(PoolAllocator&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        ReleaseChunks();
+
+        m_Memory          = other.m_Memory;
+        m_MemorySize      = other.m_MemorySize;
+        m_MemoryUsed      = other.m_MemoryUsed;
+        m_FixedMemorySize = other.m_FixedMemorySize;
+        m_BlockSize       = other.m_BlockSize;
+        m_BlockAlignment  = other.m_BlockAlignment;
+        m_ChunkSize       = other.m_ChunkSize;
+        m_Upstream        = other.m_Upstream;
+        m_FreeBlocks      = other.m_FreeBlocks;
+        m_Chunks          = other.m_Chunks;
+
+        other.m_Memory          = nullptr;
+        other.m_MemorySize      = 0;
+        other.m_MemoryUsed      = 0;
+        other.m_FixedMemorySize = 0;
+        other.m_FreeBlocks      = nullptr;
+        other.m_Chunks          = nullptr;
+
+        return *this;
+    }
+
+    void* PoolAllocator::Allocate(const UInt64 size, const UInt16 alignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(size <= m_BlockSize, "Allocation size is greater than the block size")
+        OTR_INTERNAL_ASSERT_MSG(alignment <= m_BlockAlignment,
+                                "Allocation alignment is greater than the block alignment")
+
+        if (!m_FreeBlocks && !Grow())
+            return nullptr;
+
+        void* block = m_FreeBlocks;
+        m_FreeBlocks = *(void**) block;
+
+        m_MemoryUsed += m_BlockSize;
+
+        return block;
+    }
+
+    void PoolAllocator::Free(void* block)
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+        OTR_INTERNAL_ASSERT_MSG(m_MemoryUsed >= m_BlockSize, "Pool has no allocated blocks")
+
+        *(void**) block = m_FreeBlocks;
+        m_FreeBlocks = block;
+
+        m_MemoryUsed -= m_BlockSize;
+    }
+
+    void PoolAllocator::GetMemoryFootprint(const void* const block,
+                                           UInt64* outSize,
+                                           UInt64* outOffset,
+                                           UInt16* outPadding,
+                                           UInt16* outAlignment) const
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+
+        const Chunk* chunk = FindChunk(block);
+
+        *outSize      = m_BlockSize;
+        *outOffset    = (UIntPtr) block - (chunk ? (UIntPtr) chunk : (UIntPtr) m_Memory);
+        *outPadding   = 0;
+        *outAlignment = m_BlockAlignment;
+    }
+
+    void PoolAllocator::AddChunk(void* memory, const UInt64 memorySize)
+    {
+        OTR_INTERNAL_ASSERT_MSG(memory != nullptr, "Chunk memory must not be null")
+        OTR_INTERNAL_ASSERT_MSG(memorySize >= sizeof(Chunk) + m_BlockAlignment + m_BlockSize,
+                                "Chunk size must fit at least one block")
+
+        auto* chunk = (Chunk*) memory;
+        chunk->Next    = m_Chunks;
+        chunk->Size    = memorySize;
+        chunk->IsOwned = false;
+        m_Chunks = chunk;
+
+        const UIntPtr blocks = OTR_ALIGNED_OFFSET((UIntPtr) chunk + sizeof(Chunk), (UIntPtr) m_BlockAlignment);
+        Carve((void*) blocks, (UIntPtr) memory + memorySize - blocks);
+    }
+
+    void PoolAllocator::Clear()
+    {
+        ReleaseChunks();
+
+        m_FreeBlocks = nullptr;
+        m_MemorySize = 0;
+        m_MemoryUsed = 0;
+
+        if (!m_Memory)
+            return;
+
+        const UIntPtr blocks = OTR_ALIGNED_OFFSET((UIntPtr) m_Memory, (UIntPtr) m_BlockAlignment);
+        Carve((void*) blocks, (UIntPtr) m_Memory + m_FixedMemorySize - blocks);
+    }
+
+    bool PoolAllocator::Grow()
+    {
+        if (!m_Upstream)
+            return false;
+
+        void* memory = m_Upstream->Allocate(m_ChunkSize, alignof(Chunk) > m_BlockAlignment
+                                                         ? alignof(Chunk)
+                                                         : m_BlockAlignment);
+        if (!memory)
+            return false;
+
+        AddChunk(memory, m_ChunkSize);
+        m_Chunks->IsOwned = true;
+
+        return true;
+    }
+
+    void PoolAllocator::ReleaseChunks()
+    {
+        while (m_Chunks)
+        {
+            Chunk* next = m_Chunks->Next;
+            if (m_Chunks->IsOwned)
+                m_Upstream->Free(m_Chunks);
+
+            m_Chunks = next;
+        }
+    }
+
+    void PoolAllocator::Carve(void* memory, const UInt64 memorySize)
+    {
+        const UInt64 blockCount = memorySize / m_BlockSize;
+
+        // Pushed in reverse, so that blocks are handed out in address order
+        for (UInt64 i = blockCount; i > 0; i--)
+        {
+            void* block = (void*) ((UIntPtr) memory + (i - 1) * m_BlockSize);
+            *(void**) block = m_FreeBlocks;
+            m_FreeBlocks = block;
+        }
+
+        m_MemorySize += blockCount * m_BlockSize;
+    }
+
+    const PoolAllocator::Chunk* PoolAllocator::FindChunk(const void* block) const
+    {
+        for (const Chunk* chunk = m_Chunks; chunk; chunk = chunk->Next)
+            if ((UIntPtr) block - (UIntPtr) chunk < chunk->Size)
+                return chunk;
+
+        return nullptr;
+    }
+}
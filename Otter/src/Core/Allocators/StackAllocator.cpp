@@ -0,0 +1,63 @@
+#include "Core/Allocators/StackAllocator.h"
+
+namespace Otter
+{
+    void* StackAllocator::Allocate(const UInt64 size, const UInt16 alignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(OTR_IS_POWER_OF_TWO(alignment), "Alignment must be a power of two")
+
+        const UIntPtr current = (UIntPtr) m_Memory + m_MemoryUsed;
+        const UIntPtr aligned = OTR_ALIGNED_OFFSET(current + sizeof(Header), (UIntPtr) alignment);
+
+        if (aligned + size > (UIntPtr) m_Memory + m_MemorySize)
+            return nullptr;
+
+        Header* header = GetHeader((void*) aligned);
+        header->PreviousOffset = m_MemoryUsed;
+        header->Size           = size;
+
+        m_MemoryUsed = aligned + size - (UIntPtr) m_Memory;
+
+        return (void*) aligned;
+    }
+
+    void StackAllocator::Free(void* block)
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+        OTR_INTERNAL_ASSERT_MSG(IsTop(block), "Blocks must be freed in the reverse order of their allocation")
+
+        m_MemoryUsed = GetHeader(block)->PreviousOffset;
+    }
+
+    void StackAllocator::GetMemoryFootprint(const void* const block,
+                                            UInt64* outSize,
+                                            UInt64* outOffset,
+                                            UInt16* outPadding,
+                                            UInt16* outAlignment) const
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+        OTR_INTERNAL_ASSERT_MSG(Contains(block), "Block does not belong to the allocator")
+
+        const Header* header = GetHeader(block);
+
+        *outSize      = header->Size;
+        *outOffset    = (UIntPtr) block - (UIntPtr) m_Memory;
+        *outPadding   = *outOffset - header->PreviousOffset;
+        *outAlignment = OTR_PLATFORM_MEMORY_ALIGNMENT;
+    }
+
+    void StackAllocator::FreeToMarker(const Marker marker)
+    {
+        OTR_INTERNAL_ASSERT_MSG(marker <= m_MemoryUsed, "Marker is above the top of the stack")
+
+        m_MemoryUsed = marker;
+    }
+
+    bool StackAllocator::IsTop(const void* block) const
+    {
+        if (!Contains(block) || (UIntPtr) block - (UIntPtr) m_Memory < sizeof(Header))
+            return false;
+
+        return (UIntPtr) block + GetHeader(block)->Size == (UIntPtr) m_Memory + m_MemoryUsed;
+    }
+}
@@ -0,0 +1,161 @@
+#include <new>
+
+#include "Core/Allocators/ThreadCache.h"
+#include "Core/Memory.h"
+
+namespace Otter
+{
+    /// @brief Marks the remote-free queue of a span that has been orphaned by its owner.
+    void* const g_ClosedQueue = (void*) 1;
+
+    /// @brief Maps a block size, in steps of 16 bytes, to its size class.
+    constexpr UInt8 g_SizeClassLookup[] = { 0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7 };
+
+    void* ThreadCache::Allocate(const UInt64 size)
+    {
+        OTR_INTERNAL_ASSERT_MSG(size > 0 && size <= k_MaxBlockSize, "Size is not served by the thread cache")
+
+        const UInt64 sizeClass = GetSizeClass(size);
+        if (!m_FreeBlocks[sizeClass] && !Refill(sizeClass))
+            return nullptr;
+
+        void* block = m_FreeBlocks[sizeClass];
+        m_FreeBlocks[sizeClass] = *(void**) block;
+
+        GetSpan(block)->LiveCount++;
+
+        return block;
+    }
+
+    void ThreadCache::Free(void* block)
+    {
+        Span* span = GetSpan(block);
+        OTR_INTERNAL_ASSERT_MSG(Owns(span), "Block does not belong to this thread cache")
+        OTR_INTERNAL_ASSERT_MSG(span->LiveCount > 0, "Span has no live blocks")
+
+        const UInt64 sizeClass = GetSizeClass(span->BlockSize);
+        *(void**) block = m_FreeBlocks[sizeClass];
+        m_FreeBlocks[sizeClass] = block;
+
+        span->LiveCount--;
+    }
+
+    void ThreadCache::Flush()
+    {
+        for (UInt64 sizeClass = 0; sizeClass < k_SizeClassCount; sizeClass++)
+        {
+            Span* span = m_Spans[sizeClass];
+            while (span)
+            {
+                Span* next = span->Next;
+
+                DrainRemoteFrees(span, sizeClass, g_ClosedQueue);
+                if (span->LiveCount == 0)
+                    MemorySystem::FreeThreadCacheSpan(span);
+
+                span = next;
+            }
+
+            m_Spans[sizeClass]      = nullptr;
+            m_FreeBlocks[sizeClass] = nullptr;
+        }
+    }
+
+    bool ThreadCache::Owns(const Span* span) const
+    {
+        return span->Owner == this && span->RemoteFrees.load(std::memory_order_relaxed) != g_ClosedQueue;
+    }
+
+    bool ThreadCache::TryFreeRemote(void* block)
+    {
+        Span* span = GetSpan(block);
+
+        void* head = span->RemoteFrees.load(std::memory_order_relaxed);
+        do
+        {
+            if (head == g_ClosedQueue)
+                return false;
+
+            *(void**) block = head;
+        } while (!span->RemoteFrees.compare_exchange_weak(head,
+                                                          block,
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed));
+
+        return true;
+    }
+
+    void ThreadCache::FreeOrphaned(void* block)
+    {
+        Span* span = GetSpan(block);
+        OTR_INTERNAL_ASSERT_MSG(span->LiveCount > 0, "Span has no live blocks")
+
+        if (--span->LiveCount == 0)
+            MemorySystem::FreeThreadCacheSpan(span);
+    }
+
+    bool ThreadCache::Refill(const UInt64 sizeClass)
+    {
+        for (Span* span = m_Spans[sizeClass]; span; span = span->Next)
+            DrainRemoteFrees(span, sizeClass, nullptr);
+
+        if (m_FreeBlocks[sizeClass])
+            return true;
+
+        void* memory = MemorySystem::AllocateThreadCacheSpan();
+        if (!memory)
+            return false;
+
+        const UInt64 blockSize  = k_SizeClasses[sizeClass];
+        const UInt64 blockCount = (k_SpanSize - k_SpanHeaderSize) / blockSize;
+
+        auto* span = new(memory) Span{ this, m_Spans[sizeClass], blockSize, 0, nullptr };
+        m_Spans[sizeClass] = span;
+
+        // Pushed in reverse, so that blocks are handed out in address order
+        for (UInt64 i = blockCount; i > 0; i--)
+        {
+            void* block = (void*) ((UIntPtr) span + k_SpanHeaderSize + (i - 1) * blockSize);
+            *(void**) block = m_FreeBlocks[sizeClass];
+            m_FreeBlocks[sizeClass] = block;
+        }
+
+        return true;
+    }
+
+    void ThreadCache::DrainRemoteFrees(Span* span, const UInt64 sizeClass, void* closedQueue)
+    {
+        void* block = span->RemoteFrees.exchange(closedQueue, std::memory_order_acquire);
+        while (block)
+        {
+            void* next = *(void**) block;
+
+            *(void**) block = m_FreeBlocks[sizeClass];
+            m_FreeBlocks[sizeClass] = block;
+            span->LiveCount--;
+
+            block = next;
+        }
+    }
+
+    void ThreadCache::GetMemoryFootprint(const void* const block,
+                                         UInt64* outSize,
+                                         UInt64* outOffset,
+                                         UInt16* outPadding,
+                                         UInt16* outAlignment)
+    {
+        OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block must not be null")
+
+        const Span* span = GetSpan(block);
+
+        *outSize      = span->BlockSize;
+        *outOffset    = (UIntPtr) block - (UIntPtr) span;
+        *outPadding   = 0;
+        *outAlignment = k_BlockAlignment;
+    }
+
+    UInt64 ThreadCache::GetSizeClass(const UInt64 size)
+    {
+        return g_SizeClassLookup[(size + k_BlockAlignment - 1) / k_BlockAlignment];
+    }
+}
@@ -11,7 +11,11 @@ namespace Otter
     Application::Application(const ApplicationConfiguration& config)
         : k_Configuration(config)
     {
-        MemorySystem::Initialise(k_Configuration.MemoryRequirements);
+        MemorySystem::Initialise(k_Configuration.MemoryRequirements,
+                                 FreeListAllocator::Policy::SegregatedFit,
+                                 k_Configuration.FrameMemoryRequirements,
+                                 k_Configuration.StackMemoryRequirements,
+                                 k_Configuration.MemoryLimit);
         EventSystem::Initialise();
     }
 
@@ -70,11 +74,13 @@ namespace Otter
 
     void Application::OnMainLoop()
     {
-        m_Time = New<Time>(TimeConfiguration{ 60.0, 75.0, 0.01 }, [&]() { return m_Platform->GetAbsoluteTime(); });
+        m_Time = MakeUnique<Time>(TimeConfiguration{ 60.0, 75.0, 0.01 },
+                                  [&]() { return m_Platform->GetAbsoluteTime(); });
         m_Time->Start();
 
         while (m_Platform->IsRunning())
         {
+            MemorySystem::BeginFrame();
             m_Time->Refresh();
 
             // Logic Update
@@ -95,12 +101,15 @@ namespace Otter
 
             // Render
             GraphicsSystem::RenderFrame();
+
+            // Compact relocatable memory in small steps, once nothing reads it for the rest of the frame
+            MemorySystem::Defragment(100);
         }
     }
 
     void Application::OnAfterMainLoop()
     {
-        Delete<Time>(m_Time);
+        m_Time.Reset();
 
         GraphicsSystem::Shutdown();
 
@@ -109,9 +118,6 @@ namespace Otter
         m_Platform->Shutdown();
         Platform::DestroyPlatform(m_Platform);
 
-        for (auto* layer: m_Layers)
-            Delete<Layer>(layer);
-
         m_Layers.ClearDestructive();
 
         EventSystem::Shutdown();
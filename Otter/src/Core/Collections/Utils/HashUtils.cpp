@@ -7,6 +7,7 @@ namespace Otter::Internal
     Span<UInt64, 50> g_Primes;
 
     void PopulatePrimes();
+    bool IsPrime(UInt64 value);
 
     UInt64 HashUtils::GetNextPrime(const UInt64 value)
     {
@@ -20,9 +21,12 @@ namespace Otter::Internal
             if (g_Primes[i] >= value)
                 return g_Primes[i];
 
-        OTR_LOG_WARNING("Prime number must be greater than {0}", value)
+        // Past the end of the table, search the odd numbers from the value upwards
+        UInt64 candidate = value | 1;
+        while (!IsPrime(candidate))
+            candidate += 2;
 
-        return g_Primes[g_Primes.GetSize() - 1];
+        return candidate;
     }
 
     UInt64 HashUtils::GetPreviousPrime(const UInt64 value)
@@ -30,6 +34,15 @@ namespace Otter::Internal
         if (g_Primes[0] == 0)
             PopulatePrimes();
 
+        if (value > g_Primes[g_Primes.GetSize() - 1])
+        {
+            UInt64 candidate = (value & 1) == 0 ? value - 1 : value;
+            while (!IsPrime(candidate))
+                candidate -= 2;
+
+            return candidate;
+        }
+
         for (auto i = g_Primes.GetSize() - 1; i > 0; i--)
             if (g_Primes[i] <= value)
                 return g_Primes[i];
@@ -37,6 +50,22 @@ namespace Otter::Internal
         return g_Primes[0];
     }
 
+    bool IsPrime(const UInt64 value)
+    {
+        if (value < 4)
+            return value > 1;
+
+        if (value % 2 == 0 || value % 3 == 0)
+            return false;
+
+        // Every prime above 3 is of the form 6k - 1 or 6k + 1
+        for (UInt64 i = 5; i <= value / i; i += 6)
+            if (value % i == 0 || value % (i + 2) == 0)
+                return false;
+
+        return true;
+    }
+
     void PopulatePrimes()
     {
         g_Primes[0]  = 3;
@@ -1,18 +1,414 @@
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <new>
+#include <thread>
+
 #include "Core/Memory.h"
+#include "Core/Allocators/MemoryTrace.h"
+#include "Core/Allocators/ThreadCache.h"
+#include "Platform/FileSystem.h"
 
 namespace Otter
 {
     bool              MemorySystem::s_HasInitialised = false;
-    FreeListAllocator MemorySystem::s_Allocator{ };
+    FreeListAllocator MemorySystem::s_Regions[k_MaxRegionCount]{ };
+    void*             MemorySystem::s_RegionBlocks[k_MaxRegionCount]{ };
+    UInt64            MemorySystem::s_RegionCount = 0;
+    UInt64            MemorySystem::s_MemoryLimit = 0;
+
+    FreeListAllocator::Policy MemorySystem::s_Policy = FreeListAllocator::Policy::FirstFit;
+    FrameAllocator    MemorySystem::s_FrameAllocator{ };
+    StackAllocator    MemorySystem::s_StackAllocator{ };
+    PoolAllocator     MemorySystem::s_Pools[k_PoolCount]{ };
+
+    MemorySystem::RelocationEntry* MemorySystem::s_RelocationPages[k_MaxRelocationPageCount]{ };
+    UInt32 MemorySystem::s_RelocationEntryCount = 0;
+    UInt32 MemorySystem::s_FreeRelocationEntry  = 0;
+    UInt32 MemorySystem::s_DefragmentCursor     = 0;
+
+    /// @brief Guards the global allocator against concurrent access.
+    std::mutex g_AllocatorMutex;
+
+    /// @brief The number of frame memory scopes that are open on the calling thread.
+    thread_local UInt64 g_FrameMemoryScopeDepth = 0;
+
+    /// @brief The thread that initialised the memory system, which is the only one that may use frame memory.
+    std::thread::id g_MainThreadId;
+
+    /// @brief The thread cache of the calling thread, if it has been enabled.
+    thread_local ThreadCache* g_ThreadCache = nullptr;
+
+    /**
+     * @brief Describes a span-sized page of the address space.
+     */
+    struct PageEntry final
+    {
+        /// @brief The index of the region that the page belongs to plus one, or 0 if it belongs to no region.
+        Byte Region;
+        /// @brief Tags the pages that hold a thread cache span or a pool chunk.
+        Byte Tag;
+    };
+
+    /// @brief Two-level page map of the address space, so that finding the region and the tag of a block is a
+    /// constant-time lookup, no matter how many regions there are. Leaves are created when a region first covers
+    /// them.
+    constexpr UInt64 g_PageShift        = std::countr_zero(ThreadCache::k_SpanSize);
+    constexpr UInt64 g_PageMapLeafBits  = 17;
+    constexpr UInt64 g_PageMapLeafSize  = 1ull << g_PageMapLeafBits;
+    constexpr UInt64 g_PageMapRootSize  = 1ull << (48 - g_PageShift - g_PageMapLeafBits);
+    PageEntry* g_PageMap[g_PageMapRootSize]{ };
+
+    constexpr Byte g_ThreadCacheSpanTag = 1;
+    constexpr Byte g_PoolChunkTag       = 2;
+
+    /**
+     * @brief The allocation statistics and the budget of a memory tag. They are updated without the memory system's
+     * lock, since thread caches allocate without it.
+     */
+    struct MemoryTagCounters final
+    {
+        std::atomic<UInt64>             LiveBytes;
+        std::atomic<UInt64>             PeakBytes;
+        std::atomic<UInt64>             AllocationCount;
+        std::atomic<UInt64>             TotalAllocationCount;
+        std::atomic<UInt64>             Budget;
+        std::atomic<MemoryBudgetPolicy> BudgetPolicy;
+    };
+
+    constexpr UInt64 g_MemoryTagCount = (UInt64) MemoryTag::User + 1;
+    MemoryTagCounters g_MemoryTagCounters[g_MemoryTagCount];
+
+    /// @brief The state of the memory trace. Events are buffered and written to the trace file whenever the buffer
+    /// fills up, under the memory system's lock.
+    std::atomic<bool>     g_IsTracing       = false;
+    FileSystem::File      g_TraceFile{ };
+    MemoryTraceEvent*     g_TraceEvents     = nullptr;
+    UInt64                g_TraceEventCount = 0;
+    constexpr UInt64      g_TraceCapacity   = 4096;
+    std::chrono::steady_clock::time_point g_TraceStart;
+
+    /// @brief The call site and the memory tag of the outermost call into the memory system on the calling thread,
+    /// while tracing.
+    thread_local const void* g_TraceCallSite = nullptr;
+    thread_local MemoryTag   g_TraceTag      = MemoryTag::Untagged;
+
+#if OTR_MEMORY_POISONING
+    /// @brief The patterns that uninitialised and freed memory is filled with, when memory poisoning is enabled.
+    constexpr Byte g_UninitialisedMemoryPattern = 0xCD;
+    constexpr Byte g_FreedMemoryPattern         = 0xDD;
+#endif
+
+    /**
+     * @brief Fills a newly allocated block according to the allocation flags.
+     *
+     * @param block The block.
+     * @param size The size of the block in bytes.
+     * @param flags The allocation flags.
+     */
+    void InitialiseBlock(void* block, const UInt64 size, const AllocationFlags flags)
+    {
+        if (flags == AllocationFlags::Zeroed)
+            Platform::MemoryClear(block, size);
+#if OTR_MEMORY_POISONING
+        else
+            Platform::MemorySet(block, g_UninitialisedMemoryPattern, size);
+#endif
+    }
+
+    /**
+     * @brief Records the call site and the memory tag of the outermost call into the memory system on the calling
+     * thread, so that the events that the call traces are attributed to it rather than to the memory system itself.
+     */
+    class TraceScope final
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param callSite The return address of the call.
+         * @param tag The memory tag of the call.
+         */
+        TraceScope(const void* callSite, const MemoryTag tag)
+            : m_IsOutermost(g_IsTracing.load(std::memory_order_relaxed) && !g_TraceCallSite)
+        {
+            if (!m_IsOutermost)
+                return;
+
+            g_TraceCallSite = callSite;
+            g_TraceTag      = tag;
+        }
+
+        /**
+         * @brief Destructor.
+         */
+        ~TraceScope()
+        {
+            if (m_IsOutermost)
+                g_TraceCallSite = nullptr;
+        }
+
+    private:
+        bool m_IsOutermost;
+    };
+
+    /**
+     * @brief Writes the buffered trace events to the trace file.
+     *
+     * @note The memory system's lock must be held by the caller.
+     */
+    void FlushTraceEvents()
+    {
+        if (g_TraceEventCount == 0)
+            return;
+
+        Size bytesWritten = 0;
+        if (!FileSystem::TryWriteFile(&g_TraceFile,
+                                      g_TraceEventCount * sizeof(MemoryTraceEvent),
+                                      g_TraceEvents,
+                                      &bytesWritten))
+            OTR_LOG_ERROR("Failed to write {0} memory trace events", g_TraceEventCount)
+
+        g_TraceEventCount = 0;
+    }
+
+    /**
+     * @brief Appends an event to the memory trace.
+     *
+     * @param type The type of the event.
+     * @param region The index of the region of the event.
+     *
+     * @return The event, with its type, region, time, call site and tag filled in.
+     *
+     * @note The memory system's lock must be held by the caller.
+     */
+    MemoryTraceEvent& PushTraceEvent(const MemoryTraceEventType type, const UInt64 region)
+    {
+        if (g_TraceEventCount == g_TraceCapacity)
+            FlushTraceEvents();
+
+        const auto elapsed = std::chrono::steady_clock::now() - g_TraceStart;
+
+        MemoryTraceEvent& event = g_TraceEvents[g_TraceEventCount++];
+        event           = { };
+        event.Timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        event.CallSite  = (UIntPtr) g_TraceCallSite;
+        event.Type      = type;
+        event.Region    = (UInt8) region;
+        event.Tag       = (UInt8) g_TraceTag;
+
+        return event;
+    }
+
+    /**
+     * @brief Appends an event about a block of a region to the memory trace.
+     *
+     * @param type The type of the event.
+     * @param region The region of the block.
+     * @param index The index of the region.
+     * @param block The block.
+     * @param size The size that was requested for the block, or 0 if it is unknown.
+     * @param alignment The alignment that was requested for the block, or 0 if it is unknown.
+     *
+     * @return The event.
+     *
+     * @note The memory system's lock must be held by the caller.
+     */
+    MemoryTraceEvent& TraceBlock(const MemoryTraceEventType type,
+                                 const FreeListAllocator& region,
+                                 const UInt64 index,
+                                 const void* block,
+                                 const UInt64 size,
+                                 const UInt16 alignment)
+    {
+        MemoryTraceEvent& event = PushTraceEvent(type, index);
+        region.GetBlockBounds(block, &event.Offset, &event.BlockSize);
+        event.Size      = size;
+        event.Alignment = alignment;
+
+        return event;
+    }
+
+    /**
+     * @brief Checks whether an allocation fits within the budget of its tag, or may exceed it.
+     *
+     * @param tag The memory tag of the allocation.
+     * @param size The number of bytes that the allocation adds to the tag.
+     *
+     * @return False if the allocation exceeds a budget that refuses it, true otherwise.
+     */
+    bool IsWithinBudget(const MemoryTag tag, const UInt64 size)
+    {
+        if (tag == MemoryTag::Untagged)
+            return true;
+
+        const MemoryTagCounters& counters = g_MemoryTagCounters[(UInt64) tag];
+        const UInt64 budget = counters.Budget.load(std::memory_order_relaxed);
+
+        if (budget == 0
+            || counters.BudgetPolicy.load(std::memory_order_relaxed) != MemoryBudgetPolicy::Fail
+            || counters.LiveBytes.load(std::memory_order_relaxed) + size <= budget)
+            return true;
+
+        OTR_LOG_ERROR("Allocation of {0} bytes refused, as it would exceed the budget of {1} ({2} bytes)",
+                      size, tag, budget)
+        return false;
+    }
+
+    /**
+     * @brief Accounts an allocation to its tag.
+     *
+     * @param tag The memory tag of the allocation.
+     * @param size The size of the allocation in bytes.
+     */
+    void TrackAllocation(const MemoryTag tag, const UInt64 size)
+    {
+        if (tag == MemoryTag::Untagged)
+            return;
+
+        MemoryTagCounters& counters = g_MemoryTagCounters[(UInt64) tag];
+        const UInt64 liveBytes = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
 
-    void MemorySystem::Initialise(const UInt64 memoryRequirements)
+        counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        counters.TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        UInt64 peakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+        while (liveBytes > peakBytes
+               && !counters.PeakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+        {
+        }
+
+        // Only the allocation that crosses the budget warns, so that a tag that stays above it does not flood the log
+        const UInt64 budget = counters.Budget.load(std::memory_order_relaxed);
+        if (budget > 0 && liveBytes > budget && liveBytes - size <= budget)
+            OTR_LOG_WARNING("Memory budget of {0} exceeded ({1} of {2} bytes)", tag, liveBytes, budget)
+    }
+
+    /**
+     * @brief Removes a freed allocation from the statistics of its tag.
+     *
+     * @param tag The memory tag of the allocation.
+     * @param size The size of the allocation in bytes.
+     */
+    void TrackFree(const MemoryTag tag, const UInt64 size)
+    {
+        if (tag == MemoryTag::Untagged)
+            return;
+
+        MemoryTagCounters& counters = g_MemoryTagCounters[(UInt64) tag];
+
+        OTR_INTERNAL_ASSERT_MSG(counters.LiveBytes.load(std::memory_order_relaxed) >= size,
+                                "Freed block was not allocated with the same memory tag and size")
+
+        counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+        counters.AllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Finds the page map entry of the page that an address belongs to.
+     *
+     * @param address The address.
+     *
+     * @return Pointer to the entry, or nullptr if no region has ever covered the page.
+     */
+    PageEntry* FindPage(const void* address)
+    {
+        const UInt64 page = (UIntPtr) address >> g_PageShift;
+        const UInt64 root = page >> g_PageMapLeafBits;
+
+        if (root >= g_PageMapRootSize || !g_PageMap[root])
+            return nullptr;
+
+        return &g_PageMap[root][page & (g_PageMapLeafSize - 1)];
+    }
+
+    /**
+     * @brief Assigns the pages of a range of memory to a region, creating the page map leaves that cover them.
+     *
+     * @param memory The start of the range. Must be aligned to the span size.
+     * @param size The size of the range in bytes. Must be a multiple of the span size.
+     * @param region The index of the region plus one, or 0 to unassign the pages.
+     */
+    void MapPages(const void* memory, const UInt64 size, const Byte region)
+    {
+        const UInt64 firstPage = (UIntPtr) memory >> g_PageShift;
+        const UInt64 lastPage  = firstPage + (size >> g_PageShift);
+
+        for (UInt64 page = firstPage; page < lastPage; page++)
+        {
+            PageEntry*& leaf = g_PageMap[page >> g_PageMapLeafBits];
+            if (!leaf)
+            {
+                leaf = (PageEntry*) Platform::Allocate(g_PageMapLeafSize * sizeof(PageEntry));
+                Platform::MemoryClear(leaf, g_PageMapLeafSize * sizeof(PageEntry));
+            }
+
+            leaf[page & (g_PageMapLeafSize - 1)] = { region, 0 };
+        }
+    }
+
+    /**
+     * @brief Retrieves the tag of the span-sized page that a block belongs to.
+     *
+     * @param block The block.
+     *
+     * @return The tag of the page, or 0 if the page is not tagged.
+     */
+    Byte GetSpanTag(const void* block)
+    {
+        const PageEntry* page = FindPage(block);
+
+        return page ? page->Tag : 0;
+    }
+
+    /**
+     * @brief Tags the span-sized page that starts at a given address.
+     *
+     * @param span The start of the page.
+     * @param tag The tag.
+     */
+    void SetSpanTag(const void* span, const Byte tag)
+    {
+        FindPage(span)->Tag = tag;
+    }
+
+    void MemorySystem::Initialise(const UInt64 memoryRequirements,
+                                  const FreeListAllocator::Policy policy /*= FreeListAllocator::Policy::FirstFit*/,
+                                  const UInt64 frameMemoryRequirements /*= 0*/,
+                                  const UInt64 stackMemoryRequirements /*= 0*/,
+                                  const UInt64 memoryLimit /*= 0*/)
     {
         OTR_INTERNAL_ASSERT_MSG(!s_HasInitialised, "Memory has already been initialised")
+        OTR_INTERNAL_ASSERT_MSG(memoryLimit == 0 || memoryLimit >= memoryRequirements,
+                                "Memory limit must not be less than the memory requirements")
 
-        void* memory = Platform::Allocate(memoryRequirements);
+        s_Policy      = policy;
+        s_MemoryLimit = 0;
+        AddRegion(memoryRequirements);
 
-        s_Allocator      = FreeListAllocator(memory, memoryRequirements, FreeListAllocator::Policy::FirstFit);
+        s_MemoryLimit    = memoryLimit;
         s_HasInitialised = true;
+        g_MainThreadId   = std::this_thread::get_id();
+
+        for (auto& counters: g_MemoryTagCounters)
+        {
+            counters.LiveBytes            = 0;
+            counters.PeakBytes            = 0;
+            counters.AllocationCount      = 0;
+            counters.TotalAllocationCount = 0;
+            counters.Budget               = 0;
+            counters.BudgetPolicy         = MemoryBudgetPolicy::Warn;
+        }
+
+        for (UInt64 i = 0; i < k_PoolCount; i++)
+            s_Pools[i] = PoolAllocator((i + 1) * k_PoolBlockStep, k_PoolBlockAlignment, 0, nullptr);
+
+        if (frameMemoryRequirements > 0)
+            s_FrameAllocator = FrameAllocator(Platform::Allocate(frameMemoryRequirements), frameMemoryRequirements);
+
+        if (stackMemoryRequirements > 0)
+            s_StackAllocator = StackAllocator(Platform::Allocate(stackMemoryRequirements), stackMemoryRequirements);
 
         OTR_LOG_DEBUG("Memory system initialized with {0} bytes available", memoryRequirements)
     }
@@ -22,17 +418,59 @@ namespace Otter
         OTR_LOG_DEBUG("Shutting down memory system...")
         OTR_INTERNAL_ASSERT_MSG(s_HasInitialised, "Memory has not been initialised")
 
-        void* memoryBlock = s_Allocator.GetMemoryUnsafePointer();
-        if (memoryBlock)
+        StopTracing();
+
+        // Pool chunks live in the memory block, so the pools must forget them before it is released
+        for (auto& pool: s_Pools)
+            pool = PoolAllocator();
+
+        for (UInt64 i = 0; i < k_MaxRegionCount; i++)
+            if (s_Regions[i].GetMemoryUnsafePointer())
+                RemoveRegion(i);
+
+        void* frameMemoryBlock = s_FrameAllocator.GetMemoryUnsafePointer();
+        if (frameMemoryBlock)
         {
-            Platform::MemoryClear(memoryBlock, s_Allocator.GetMemorySize());
-            Platform::Free(memoryBlock);
+            Platform::Free(frameMemoryBlock);
+            s_FrameAllocator = FrameAllocator();
+        }
+
+        void* stackMemoryBlock = s_StackAllocator.GetMemoryUnsafePointer();
+        if (stackMemoryBlock)
+        {
+            Platform::Free(stackMemoryBlock);
+            s_StackAllocator = StackAllocator();
+        }
+
+        for (auto& page: s_RelocationPages)
+        {
+            if (page)
+            {
+                Platform::Free(page);
+                page = nullptr;
+            }
+        }
+
+        s_RelocationEntryCount = 0;
+        s_FreeRelocationEntry  = 0;
+        s_DefragmentCursor     = 0;
+
+        for (auto& leaf: g_PageMap)
+        {
+            if (leaf)
+            {
+                Platform::Free(leaf);
+                leaf = nullptr;
+            }
         }
 
         s_HasInitialised = false;
     }
 
-    UnsafeHandle MemorySystem::Allocate(const UInt64 size, const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/)
+    UnsafeHandle MemorySystem::Allocate(const UInt64 size,
+                                        const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/,
+                                        const AllocationFlags flags /*= AllocationFlags::Uninitialised*/,
+                                        const MemoryTag tag /*= MemoryTag::Untagged*/)
     {
         if (!s_HasInitialised)
             return { };
@@ -41,18 +479,93 @@ namespace Otter
         OTR_INTERNAL_ASSERT_MSG(alignment >= OTR_PLATFORM_MEMORY_ALIGNMENT,
                                 "Allocation alignment must be greater than or equal to the platform alignment")
 
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
         UnsafeHandle handle{ };
-        handle.Pointer = s_Allocator.Allocate(size, alignment);
-        handle.Size    = size;
+        handle.Size = size;
 
-        Platform::MemoryClear(handle.Pointer, handle.Size);
+        // Frame memory is released in bulk and never freed block by block, so it is not accounted to any tag
+        if (g_FrameMemoryScopeDepth > 0 && s_FrameAllocator.GetMemorySize() > 0)
+        {
+            handle.Pointer = s_FrameAllocator.Allocate(size, alignment);
+
+            if (handle.Pointer)
+            {
+                InitialiseBlock(handle.Pointer, handle.Size, flags);
+                return handle;
+            }
+
+            OTR_LOG_WARNING("Frame memory is exhausted, falling back to the global allocator")
+        }
+
+        if (!IsWithinBudget(tag, size))
+            return { };
+
+        handle.Pointer = AllocateLongLived(size, alignment);
+
+        if (handle.Pointer)
+        {
+            InitialiseBlock(handle.Pointer, handle.Size, flags);
+            TrackAllocation(tag, size);
+        }
+
+        return handle;
+    }
+
+    UnsafeHandle MemorySystem::AllocatePooled(const UInt64 size,
+                                              const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/,
+                                              const AllocationFlags flags /*= AllocationFlags::Uninitialised*/,
+                                              const MemoryTag tag /*= MemoryTag::Untagged*/)
+    {
+        if (!s_HasInitialised)
+            return { };
+
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Allocation size must be greater than 0 bytes")
+
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
+        if (g_FrameMemoryScopeDepth > 0 || size > k_PoolCount * k_PoolBlockStep || alignment > k_PoolBlockAlignment)
+            return Allocate(size, alignment, flags, tag);
+
+        if (!IsWithinBudget(tag, size))
+            return { };
+
+        const UInt64 poolIndex = (size - 1) / k_PoolBlockStep;
+        PoolAllocator& pool = s_Pools[poolIndex];
+
+        UnsafeHandle handle{ };
+        handle.Size = size;
+
+        {
+            std::scoped_lock lock(g_AllocatorMutex);
+
+            if (!pool.HasFreeBlocks())
+            {
+                void* chunk = AllocateGlobal(ThreadCache::k_SpanSize, ThreadCache::k_SpanSize);
+                if (!chunk)
+                    return { };
+
+                SetSpanTag(chunk, g_PoolChunkTag + poolIndex);
+                pool.AddChunk(chunk, ThreadCache::k_SpanSize);
+            }
+
+            handle.Pointer = pool.Allocate(size, alignment);
+        }
+
+        if (handle.Pointer)
+        {
+            InitialiseBlock(handle.Pointer, handle.Size, flags);
+            TrackAllocation(tag, size);
+        }
 
         return handle;
     }
 
     UnsafeHandle MemorySystem::Reallocate(UnsafeHandle& handle,
                                           const UInt64 size,
-                                          const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/)
+                                          const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/,
+                                          const AllocationFlags flags /*= AllocationFlags::Uninitialised*/,
+                                          const MemoryTag tag /*= MemoryTag::Untagged*/)
     {
         if (!s_HasInitialised)
             return { };
@@ -63,20 +576,101 @@ namespace Otter
         OTR_INTERNAL_ASSERT_MSG(alignment >= OTR_PLATFORM_MEMORY_ALIGNMENT,
                                 "Allocation alignment must be greater than or equal to the platform alignment")
 
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
         if (size < handle.Size)
         {
             OTR_LOG_WARNING("Reallocation size is smaller than the existing handle size. "
                             "Make sure you are not losing data.")
         }
 
+        const bool isFrameBlock = s_FrameAllocator.Contains(handle.Pointer);
+        if (size > handle.Size && !IsWithinBudget(tag, isFrameBlock ? size : size - handle.Size))
+            return { };
+
+#if OTR_MEMORY_POISONING
+        if (size < handle.Size)
+            Platform::MemorySet((Byte*) handle.Pointer + size, g_FreedMemoryPattern, handle.Size - size);
+#endif
+
+        // Blocks of the global allocator can usually grow or shrink in place, which saves allocating and copying
+        const PageEntry* page = FindPage(handle.Pointer);
+        const bool isGlobalBlock = page && page->Region > 0 && page->Tag == 0;
+
+        if (isGlobalBlock && ((UIntPtr) handle.Pointer & (alignment - 1)) == 0)
+        {
+            bool isResized;
+            {
+                std::scoped_lock lock(g_AllocatorMutex);
+
+                const UInt64 index = page->Region - 1;
+                UInt64 previousOffset, previousBlockSize = 0;
+                if (g_IsTracing.load(std::memory_order_relaxed))
+                    s_Regions[index].GetBlockBounds(handle.Pointer, &previousOffset, &previousBlockSize);
+
+                isResized = s_Regions[index].TryResize(handle.Pointer, size);
+
+                if (isResized && g_IsTracing.load(std::memory_order_relaxed))
+                {
+                    MemoryTraceEvent& event = TraceBlock(MemoryTraceEventType::Reallocate,
+                                                         s_Regions[index],
+                                                         index,
+                                                         handle.Pointer,
+                                                         size,
+                                                         alignment);
+                    event.PreviousBlockSize = previousBlockSize;
+                    event.PreviousSize      = handle.Size;
+                }
+            }
+
+            if (isResized)
+            {
+                if (size > handle.Size)
+                    InitialiseBlock((Byte*) handle.Pointer + handle.Size, size - handle.Size, flags);
+
+                TrackFree(tag, handle.Size);
+                TrackAllocation(tag, size);
+
+                UnsafeHandle newHandle{ handle.Pointer, size };
+                handle.Pointer = nullptr;
+                handle.Size    = 0;
+
+                return newHandle;
+            }
+        }
+
+        // The block keeps its lifetime, so it only moves into frame memory if it already lives there, no matter
+        // whether a frame memory scope is open
         UnsafeHandle newHandle{ };
-        newHandle.Pointer = s_Allocator.Allocate(size, alignment);
-        newHandle.Size    = size;
+        newHandle.Size = size;
+
+        if (isFrameBlock)
+        {
+            newHandle.Pointer = s_FrameAllocator.Allocate(size, alignment);
+
+            if (!newHandle.Pointer)
+                OTR_LOG_WARNING("Frame memory is exhausted, falling back to the global allocator")
+        }
+
+        if (!newHandle.Pointer)
+            newHandle.Pointer = AllocateLongLived(size, alignment);
+
+        if (!newHandle.Pointer)
+            return { };
 
-        Platform::MemoryClear(newHandle.Pointer, newHandle.Size);
-        Platform::MemoryCopy(newHandle.Pointer, handle.Pointer, size);
+        if (!isFrameBlock)
+            TrackFree(tag, handle.Size);
+        if (!s_FrameAllocator.Contains(newHandle.Pointer))
+            TrackAllocation(tag, size);
 
-        s_Allocator.Free(handle.Pointer);
+        // Only the part that the existing handle does not cover needs initialising, the rest is copied over
+        const UInt64 copySize = size < handle.Size ? size : handle.Size;
+        Platform::MemoryCopy(newHandle.Pointer, handle.Pointer, copySize);
+
+        if (size > copySize)
+            InitialiseBlock((Byte*) newHandle.Pointer + copySize, size - copySize, flags);
+
+        Free(handle.Pointer, handle.Size);
         handle.Pointer = nullptr;
         handle.Size    = 0;
 
@@ -90,7 +684,635 @@ namespace Otter
 
         OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Block to be freed must not be null")
 
-        s_Allocator.Free(block);
+        if (s_FrameAllocator.Contains(block))
+            return;
+
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), MemoryTag::Untagged);
+
+        // Stack blocks below the top are released when their scope rolls the stack back
+        if (s_StackAllocator.Contains(block))
+        {
+            if (s_StackAllocator.IsTop(block))
+                s_StackAllocator.Free(block);
+
+            return;
+        }
+
+        const Byte spanTag = GetSpanTag(block);
+        if (spanTag >= g_PoolChunkTag)
+        {
+            std::scoped_lock lock(g_AllocatorMutex);
+            s_Pools[spanTag - g_PoolChunkTag].Free(block);
+            return;
+        }
+
+        if (spanTag == g_ThreadCacheSpanTag)
+        {
+            if (g_ThreadCache && g_ThreadCache->Owns(ThreadCache::GetSpan(block)))
+            {
+                g_ThreadCache->Free(block);
+                return;
+            }
+
+            if (ThreadCache::TryFreeRemote(block))
+                return;
+
+            std::scoped_lock lock(g_AllocatorMutex);
+            ThreadCache::FreeOrphaned(block);
+            return;
+        }
+
+        std::scoped_lock lock(g_AllocatorMutex);
+        FreeGlobal(block);
+    }
+
+    void MemorySystem::Free(void* block, const UInt64 size, const MemoryTag tag /*= MemoryTag::Untagged*/)
+    {
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
+        if (s_HasInitialised && block && !s_FrameAllocator.Contains(block))
+            TrackFree(tag, size);
+
+#if OTR_MEMORY_POISONING
+        if (s_HasInitialised && block && size > 0)
+            Platform::MemorySet(block, g_FreedMemoryPattern, size);
+#endif
+
+        Free(block);
+    }
+
+    RelocatableHandle MemorySystem::AllocateRelocatable(const UInt64 size,
+                                                        const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/,
+                                                        const AllocationFlags flags /*= AllocationFlags::Uninitialised*/,
+                                                        const MemoryTag tag /*= MemoryTag::Untagged*/)
+    {
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
+        const UnsafeHandle block = Allocate(size, alignment, flags, tag);
+        if (!block.Pointer)
+            return { };
+
+        std::unique_lock lock(g_AllocatorMutex);
+
+        // Index 0 is reserved for null handles
+        UInt32 index = s_FreeRelocationEntry;
+        if (index != 0)
+        {
+            s_FreeRelocationEntry = s_RelocationPages[index / k_RelocationPageSize]
+                                                     [index % k_RelocationPageSize].NextFree;
+        }
+        else
+        {
+            index = s_RelocationEntryCount == 0 ? 1 : s_RelocationEntryCount;
+
+            const UInt32 pageIndex = index / k_RelocationPageSize;
+            if (pageIndex == k_MaxRelocationPageCount)
+            {
+                lock.unlock();
+
+                OTR_LOG_ERROR("The relocation table is full, no more relocatable blocks can be allocated")
+                Free(block.Pointer, block.Size, tag);
+                return { };
+            }
+
+            if (!s_RelocationPages[pageIndex])
+            {
+                s_RelocationPages[pageIndex] =
+                    (RelocationEntry*) Platform::Allocate(k_RelocationPageSize * sizeof(RelocationEntry));
+                Platform::MemoryClear(s_RelocationPages[pageIndex], k_RelocationPageSize * sizeof(RelocationEntry));
+            }
+
+            s_RelocationEntryCount = index + 1;
+        }
+
+        RelocationEntry& entry = s_RelocationPages[index / k_RelocationPageSize][index % k_RelocationPageSize];
+        entry.Pointer   = block.Pointer;
+        entry.Size      = block.Size;
+        entry.NextFree  = 0;
+        entry.Alignment = alignment;
+        entry.Tag       = tag;
+
+        return { index, entry.Generation };
+    }
+
+    bool MemorySystem::ReallocateRelocatable(const RelocatableHandle& handle,
+                                             const UInt64 size,
+                                             const AllocationFlags flags /*= AllocationFlags::Uninitialised*/)
+    {
+        OTR_INTERNAL_ASSERT_MSG(handle.IsValid(), "Relocatable handle must not be null")
+
+        RelocationEntry& entry = GetRelocationEntry(handle);
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), entry.Tag);
+
+        // The entry is detached while the block is reallocated, so that Defragment does not move it in the meantime
+        UnsafeHandle block;
+        {
+            std::scoped_lock lock(g_AllocatorMutex);
+
+            block         = { entry.Pointer, entry.Size };
+            entry.Pointer = nullptr;
+        }
+
+        const UnsafeHandle newBlock = Reallocate(block, size, entry.Alignment, flags, entry.Tag);
+
+        std::scoped_lock lock(g_AllocatorMutex);
+        if (!newBlock.Pointer)
+        {
+            entry.Pointer = block.Pointer;
+            return false;
+        }
+
+        entry.Pointer = newBlock.Pointer;
+        entry.Size    = newBlock.Size;
+
+        return true;
+    }
+
+    void MemorySystem::FreeRelocatable(RelocatableHandle& handle)
+    {
+        if (!handle.IsValid())
+            return;
+
+        RelocationEntry& entry = GetRelocationEntry(handle);
+        const MemoryTag tag = entry.Tag;
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), tag);
+
+        // The block is read and detached under the lock, so that Defragment cannot move it before it is freed
+        UnsafeHandle block;
+        {
+            std::scoped_lock lock(g_AllocatorMutex);
+
+            block = { entry.Pointer, entry.Size };
+
+            // Bumping the generation catches handles to the block that are used after it was freed
+            entry.Pointer  = nullptr;
+            entry.Size     = 0;
+            entry.Generation++;
+            entry.NextFree        = s_FreeRelocationEntry;
+            s_FreeRelocationEntry = handle.Index;
+        }
+
+        Free(block.Pointer, block.Size, tag);
+
+        handle = { };
+    }
+
+    UInt64 MemorySystem::GetRelocatableSize(const RelocatableHandle& handle)
+    {
+        return handle.IsValid() ? GetRelocationEntry(handle).Size : 0;
+    }
+
+    UInt64 MemorySystem::Defragment(const UInt64 budgetMicroseconds)
+    {
+        if (!s_HasInitialised || s_RelocationEntryCount == 0)
+            return 0;
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(budgetMicroseconds);
+        const TraceScope traceScope(OTR_RETURN_ADDRESS(), MemoryTag::Untagged);
+
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        // The pass resumes at the entry where the previous one ran out of time and visits every entry at most once,
+        // so the work of a call is bounded by its budget rather than by the number of relocatable blocks
+        UInt64 movedBytes = 0;
+        for (UInt32 visitedCount = 1; visitedCount < s_RelocationEntryCount; visitedCount++)
+        {
+            // At least one entry is visited, so that even a pass with no budget makes progress
+            if (visitedCount > 1 && std::chrono::steady_clock::now() >= deadline)
+                break;
+
+            if (s_DefragmentCursor == 0 || s_DefragmentCursor >= s_RelocationEntryCount)
+                s_DefragmentCursor = 1;
+
+            const UInt32 index = s_DefragmentCursor++;
+            RelocationEntry& entry = s_RelocationPages[index / k_RelocationPageSize][index % k_RelocationPageSize];
+            if (!entry.Pointer)
+                continue;
+
+            // Only blocks of the global allocator can move, blocks of thread caches, pools or scratch memory stay put
+            const PageEntry* page = FindPage(entry.Pointer);
+            if (!page || page->Region == 0 || page->Tag != 0)
+                continue;
+
+            const UInt64 region = page->Region - 1;
+
+            // Blocks of later regions move to earlier ones, so that the later regions can be returned to the OS
+            void* target = nullptr;
+            UInt64 targetRegion = 0;
+            for (; targetRegion < region; targetRegion++)
+            {
+                FreeListAllocator& allocator = s_Regions[targetRegion];
+                if (!allocator.GetMemoryUnsafePointer() || allocator.GetMemoryFree() < entry.Size)
+                    continue;
+
+                if ((target = allocator.Allocate(entry.Size, entry.Alignment)))
+                    break;
+            }
+
+            if (!target)
+                target = s_Regions[region].AllocateBelow(entry.Pointer, entry.Size, entry.Alignment);
+
+            if (!target)
+                continue;
+
+            if (g_IsTracing.load(std::memory_order_relaxed))
+            {
+                TraceBlock(MemoryTraceEventType::Allocate,
+                           s_Regions[targetRegion],
+                           targetRegion,
+                           target,
+                           entry.Size,
+                           entry.Alignment).Tag = (UInt8) entry.Tag;
+            }
+
+            Platform::MemoryCopy(target, entry.Pointer, entry.Size);
+            FreeGlobal(entry.Pointer);
+
+            entry.Pointer = target;
+            movedBytes += entry.Size;
+        }
+
+        return movedBytes;
+    }
+
+    void MemorySystem::BeginFrame()
+    {
+        OTR_INTERNAL_ASSERT_MSG(g_FrameMemoryScopeDepth == 0, "Frame memory scopes must not span across frames")
+
+        s_FrameAllocator.SwapBuffers();
+    }
+
+    void MemorySystem::PushFrameMemoryScope()
+    {
+        OTR_INTERNAL_ASSERT_MSG(std::this_thread::get_id() == g_MainThreadId,
+                                "Frame memory scopes must only be opened on the main thread")
+
+        g_FrameMemoryScopeDepth++;
+    }
+
+    void MemorySystem::PopFrameMemoryScope()
+    {
+        OTR_INTERNAL_ASSERT_MSG(g_FrameMemoryScopeDepth > 0, "No frame memory scope is open")
+
+        g_FrameMemoryScopeDepth--;
+    }
+
+    StackAllocator::Marker MemorySystem::GetStackMarker()
+    {
+        return s_StackAllocator.GetMarker();
+    }
+
+    void* MemorySystem::AllocateStack(const UInt64 size, const UInt16 alignment)
+    {
+        if (!s_HasInitialised || s_StackAllocator.GetMemorySize() == 0)
+            return nullptr;
+
+        return s_StackAllocator.Allocate(size, alignment);
+    }
+
+    void MemorySystem::FreeToStackMarker(const StackAllocator::Marker marker)
+    {
+        s_StackAllocator.FreeToMarker(marker);
+    }
+
+    StackMemoryScope::~StackMemoryScope()
+    {
+        while (m_Overflow)
+        {
+            void* next = *(void**) m_Overflow;
+            MemorySystem::Free(m_Overflow);
+            m_Overflow = next;
+        }
+
+        MemorySystem::FreeToStackMarker(m_Marker);
+    }
+
+    void* StackMemoryScope::Allocate(const UInt64 size, const UInt16 alignment /*= OTR_PLATFORM_MEMORY_ALIGNMENT*/)
+    {
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Allocation size must be greater than 0 bytes")
+
+        if (void* block = MemorySystem::AllocateStack(size, alignment))
+            return block;
+
+        if (MemorySystem::s_StackAllocator.GetMemorySize() > 0)
+            OTR_LOG_WARNING("Stack memory is exhausted, falling back to the global allocator")
+
+        // Overflow blocks are linked through a pointer in front of them, so that the scope can free them at its end
+        const UInt64 offset = OTR_ALIGNED_OFFSET(sizeof(void*), (UInt64) alignment);
+        UnsafeHandle handle = MemorySystem::Allocate(offset + size, alignment);
+        if (!handle.Pointer)
+            return nullptr;
+
+        *(void**) handle.Pointer = m_Overflow;
+        m_Overflow = handle.Pointer;
+
+        return (void*) ((UIntPtr) handle.Pointer + offset);
+    }
+
+    void MemorySystem::EnableThreadCache()
+    {
+        OTR_INTERNAL_ASSERT_MSG(s_HasInitialised, "Memory has not been initialised")
+        OTR_INTERNAL_ASSERT_MSG(!g_ThreadCache, "Thread cache has already been enabled for this thread")
+
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        void* memory = AllocateGlobal(sizeof(ThreadCache), alignof(ThreadCache));
+        if (!memory)
+            return;
+
+        g_ThreadCache = new(memory) ThreadCache();
+    }
+
+    void MemorySystem::DisableThreadCache()
+    {
+        if (!g_ThreadCache)
+            return;
+
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        g_ThreadCache->Flush();
+        g_ThreadCache->~ThreadCache();
+
+        FreeGlobal(g_ThreadCache);
+        g_ThreadCache = nullptr;
+    }
+
+    void* MemorySystem::AllocateThreadCacheSpan()
+    {
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        void* span = AllocateGlobal(ThreadCache::k_SpanSize, ThreadCache::k_SpanSize);
+        if (span)
+            SetSpanTag(span, g_ThreadCacheSpanTag);
+
+        return span;
+    }
+
+    void MemorySystem::FreeThreadCacheSpan(void* span)
+    {
+        SetSpanTag(span, 0);
+        FreeGlobal(span);
+    }
+
+    void* MemorySystem::AllocateLongLived(const UInt64 size, const UInt16 alignment)
+    {
+        if (g_ThreadCache && size <= ThreadCache::k_MaxBlockSize && alignment <= ThreadCache::k_BlockAlignment)
+        {
+            void* block = g_ThreadCache->Allocate(size);
+            if (block)
+                return block;
+        }
+
+        std::scoped_lock lock(g_AllocatorMutex);
+        return AllocateGlobal(size, alignment);
+    }
+
+    void* MemorySystem::AllocateGlobal(const UInt64 size, const UInt16 alignment)
+    {
+        for (UInt64 i = 0; i < k_MaxRegionCount; i++)
+        {
+            FreeListAllocator& region = s_Regions[i];
+            if (!region.GetMemoryUnsafePointer() || region.GetMemoryFree() < size)
+                continue;
+
+            if (void* block = region.Allocate(size, alignment))
+            {
+                if (g_IsTracing.load(std::memory_order_relaxed))
+                    TraceBlock(MemoryTraceEventType::Allocate, region, i, block, size, alignment);
+
+                return block;
+            }
+        }
+
+        // A new region is at least as large as the first one, and leaves room for the block's header and alignment
+        const UInt64 requiredSize = size + alignment + ThreadCache::k_SpanSize;
+        const UInt64 growthSize   = s_Regions[0].GetMemorySize();
+
+        UInt64 index = AddRegion(requiredSize > growthSize ? requiredSize : growthSize);
+        if (index == k_MaxRegionCount && requiredSize < growthSize)
+            index = AddRegion(requiredSize);
+
+        if (index == k_MaxRegionCount)
+        {
+            OTR_LOG_FATAL("Memory system has no free memory and cannot grow any further! "
+                          "Unable to perform new allocation of {0} bytes!", size)
+            return nullptr;
+        }
+
+        void* block = s_Regions[index].Allocate(size, alignment);
+        if (block && g_IsTracing.load(std::memory_order_relaxed))
+            TraceBlock(MemoryTraceEventType::Allocate, s_Regions[index], index, block, size, alignment);
+
+        return block;
+    }
+
+    void MemorySystem::FreeGlobal(void* block)
+    {
+        const PageEntry* page = FindPage(block);
+
+        OTR_INTERNAL_ASSERT_MSG(page && page->Region > 0, "Block to be freed does not belong to the memory system")
+        if (!page || page->Region == 0)
+            return;
+
+        const UInt64 index = page->Region - 1;
+
+        if (g_IsTracing.load(std::memory_order_relaxed))
+            TraceBlock(MemoryTraceEventType::Free, s_Regions[index], index, block, 0, 0);
+
+        s_Regions[index].Free(block);
+
+        if (index == 0 || s_Regions[index].GetMemoryUsed() > 0)
+            return;
+
+        // One empty region is kept as a spare, so that a load that hovers around a region boundary does not keep
+        // requesting and returning memory from the OS
+        for (UInt64 i = 1; i < k_MaxRegionCount; i++)
+        {
+            if (i != index && s_Regions[i].GetMemoryUnsafePointer() && s_Regions[i].GetMemoryUsed() == 0)
+            {
+                RemoveRegion(index);
+                return;
+            }
+        }
+    }
+
+    UInt64 MemorySystem::AddRegion(const UInt64 size)
+    {
+        UInt64 index = 0;
+        while (index < k_MaxRegionCount && s_Regions[index].GetMemoryUnsafePointer())
+            index++;
+
+        if (index == k_MaxRegionCount)
+            return k_MaxRegionCount;
+
+        // Every region but the first is rounded up to whole spans, as any memory past the last span is wasted
+        const UInt64 spannedSize = OTR_ALIGNED_OFFSET(size, ThreadCache::k_SpanSize);
+        const UInt64 regionSize  = index == 0 ? size : spannedSize;
+
+        if (s_MemoryLimit > 0 && GetMemorySize() + regionSize > s_MemoryLimit)
+            return k_MaxRegionCount;
+
+        void* block = Platform::Allocate(spannedSize + ThreadCache::k_SpanSize);
+        if (!block)
+            return k_MaxRegionCount;
+
+        void* memory = (void*) OTR_ALIGNED_OFFSET((UIntPtr) block, (UIntPtr) ThreadCache::k_SpanSize);
+        MapPages(memory, spannedSize, (Byte) (index + 1));
+
+        s_RegionBlocks[index] = block;
+        s_Regions[index]      = FreeListAllocator(memory, regionSize, s_Policy);
+        s_RegionCount++;
+
+        if (g_IsTracing.load(std::memory_order_relaxed))
+            PushTraceEvent(MemoryTraceEventType::AddRegion, index).BlockSize = regionSize;
+
+        if (index > 0)
+            OTR_LOG_DEBUG("Memory system grew by a region of {0} bytes", regionSize)
+
+        return index;
+    }
+
+    void MemorySystem::RemoveRegion(const UInt64 index)
+    {
+        FreeListAllocator& region = s_Regions[index];
+
+        if (g_IsTracing.load(std::memory_order_relaxed))
+            PushTraceEvent(MemoryTraceEventType::RemoveRegion, index).BlockSize = region.GetMemorySize();
+
+        const UInt64 spannedSize = OTR_ALIGNED_OFFSET(region.GetMemorySize(), ThreadCache::k_SpanSize);
+        MapPages(region.GetMemoryUnsafePointer(), spannedSize, 0);
+        Platform::Free(s_RegionBlocks[index]);
+
+        s_RegionBlocks[index] = nullptr;
+        region = FreeListAllocator();
+        s_RegionCount--;
+    }
+
+    UInt64 MemorySystem::GetUsedMemory()
+    {
+        UInt64 usedMemory = 0;
+        for (const auto& region: s_Regions)
+            usedMemory += region.GetMemoryUsed();
+
+        return usedMemory;
+    }
+
+    UInt64 MemorySystem::GetFreeMemory()
+    {
+        UInt64 freeMemory = 0;
+        for (const auto& region: s_Regions)
+            freeMemory += region.GetMemoryFree();
+
+        return freeMemory;
+    }
+
+    UInt64 MemorySystem::GetMemorySize()
+    {
+        UInt64 memorySize = 0;
+        for (const auto& region: s_Regions)
+            memorySize += region.GetMemorySize();
+
+        return memorySize;
+    }
+
+    UInt64 MemorySystem::GetRegionCount()
+    {
+        return s_RegionCount;
+    }
+
+    void MemorySystem::SetMemoryBudget(const MemoryTag tag,
+                                       const UInt64 budget,
+                                       const MemoryBudgetPolicy policy /*= MemoryBudgetPolicy::Warn*/)
+    {
+        OTR_INTERNAL_ASSERT_MSG(tag != MemoryTag::Untagged, "Untagged allocations cannot have a budget")
+
+        MemoryTagCounters& counters = g_MemoryTagCounters[(UInt64) tag];
+        counters.Budget.store(budget, std::memory_order_relaxed);
+        counters.BudgetPolicy.store(policy, std::memory_order_relaxed);
+    }
+
+    bool MemorySystem::StartTracing(const char* const filePath)
+    {
+        OTR_INTERNAL_ASSERT_MSG(s_HasInitialised, "Memory has not been initialised")
+        OTR_INTERNAL_ASSERT_MSG(filePath != nullptr, "Trace file path must not be null")
+
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        if (g_IsTracing.load(std::memory_order_relaxed))
+        {
+            OTR_LOG_WARNING("Memory tracing has already been started")
+            return false;
+        }
+
+        if (!FileSystem::TryOpenFile(filePath, FileSystem::OpenMode::Overwrite, true, &g_TraceFile))
+        {
+            OTR_LOG_ERROR("Failed to open memory trace file '{0}'", filePath)
+            return false;
+        }
+
+        const MemoryTraceHeader header{ MemoryTraceHeader::k_Magic,
+                                        MemoryTraceHeader::k_Version,
+                                        sizeof(MemoryTraceEvent) };
+
+        Size bytesWritten = 0;
+        if (!FileSystem::TryWriteFile(&g_TraceFile, sizeof(MemoryTraceHeader), &header, &bytesWritten))
+        {
+            FileSystem::CloseFile(&g_TraceFile);
+            return false;
+        }
+
+        g_TraceEvents     = (MemoryTraceEvent*) Platform::Allocate(g_TraceCapacity * sizeof(MemoryTraceEvent));
+        g_TraceEventCount = 0;
+        g_TraceStart      = std::chrono::steady_clock::now();
+        g_IsTracing.store(true, std::memory_order_relaxed);
+
+        // The trace starts with the regions that already exist, so that it can be replayed on its own
+        for (UInt64 i = 0; i < k_MaxRegionCount; i++)
+            if (s_Regions[i].GetMemoryUnsafePointer())
+                PushTraceEvent(MemoryTraceEventType::AddRegion, i).BlockSize = s_Regions[i].GetMemorySize();
+
+        return true;
+    }
+
+    void MemorySystem::FlushTrace()
+    {
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        if (g_IsTracing.load(std::memory_order_relaxed))
+            FlushTraceEvents();
+    }
+
+    void MemorySystem::StopTracing()
+    {
+        std::scoped_lock lock(g_AllocatorMutex);
+
+        if (!g_IsTracing.load(std::memory_order_relaxed))
+            return;
+
+        FlushTraceEvents();
+        FileSystem::CloseFile(&g_TraceFile);
+
+        Platform::Free(g_TraceEvents);
+        g_TraceEvents = nullptr;
+        g_IsTracing.store(false, std::memory_order_relaxed);
+    }
+
+    bool MemorySystem::IsTracing()
+    {
+        return g_IsTracing.load(std::memory_order_relaxed);
+    }
+
+    MemoryTagStats MemorySystem::GetMemoryTagStats(const MemoryTag tag)
+    {
+        const MemoryTagCounters& counters = g_MemoryTagCounters[(UInt64) tag];
+
+        return {
+            counters.LiveBytes.load(std::memory_order_relaxed),
+            counters.PeakBytes.load(std::memory_order_relaxed),
+            counters.AllocationCount.load(std::memory_order_relaxed),
+            counters.TotalAllocationCount.load(std::memory_order_relaxed),
+            counters.Budget.load(std::memory_order_relaxed)
+        };
     }
 
     void MemorySystem::MemoryCopy(void* destination, const void* source, UInt64 size)
@@ -159,6 +1381,8 @@ namespace Otter
         OTR_INTERNAL_ASSERT_MSG(handle.Pairs != nullptr, "Handle pointer must not be null")
         OTR_INTERNAL_ASSERT_MSG(handle.Size > 0, "Handle size must be greater than 0")
 
+        std::scoped_lock lock(g_AllocatorMutex);
+
         for (UInt64 i = 0; i < handle.Size; i++)
         {
             const auto data = handle.Pairs[i];
@@ -167,11 +1391,57 @@ namespace Otter
             if (!data.GetPointer())
                 continue;
 
-            s_Allocator.GetMemoryFootprint(data.GetPointer(),
-                                           &outFootprints[i].Size,
-                                           &outFootprints[i].Offset,
-                                           &outFootprints[i].Padding,
-                                           &outFootprints[i].Alignment);
+            const Byte spanTag = GetSpanTag(data.GetPointer());
+            if (spanTag >= g_PoolChunkTag)
+            {
+                s_Pools[spanTag - g_PoolChunkTag].GetMemoryFootprint(data.GetPointer(),
+                                                                     &outFootprints[i].Size,
+                                                                     &outFootprints[i].Offset,
+                                                                     &outFootprints[i].Padding,
+                                                                     &outFootprints[i].Alignment);
+                continue;
+            }
+
+            // Thread cache spans are carved from a region, but their blocks have no free-list header
+            if (spanTag == g_ThreadCacheSpanTag)
+            {
+                ThreadCache::GetMemoryFootprint(data.GetPointer(),
+                                                &outFootprints[i].Size,
+                                                &outFootprints[i].Offset,
+                                                &outFootprints[i].Padding,
+                                                &outFootprints[i].Alignment);
+                continue;
+            }
+
+            if (s_StackAllocator.Contains(data.GetPointer()))
+            {
+                s_StackAllocator.GetMemoryFootprint(data.GetPointer(),
+                                                    &outFootprints[i].Size,
+                                                    &outFootprints[i].Offset,
+                                                    &outFootprints[i].Padding,
+                                                    &outFootprints[i].Alignment);
+                continue;
+            }
+
+            if (s_FrameAllocator.Contains(data.GetPointer()))
+            {
+                s_FrameAllocator.GetMemoryFootprint(data.GetPointer(),
+                                                    &outFootprints[i].Size,
+                                                    &outFootprints[i].Offset,
+                                                    &outFootprints[i].Padding,
+                                                    &outFootprints[i].Alignment);
+                continue;
+            }
+
+            const PageEntry* page = FindPage(data.GetPointer());
+            if (!page || page->Region == 0)
+                continue;
+
+            s_Regions[page->Region - 1].GetMemoryFootprint(data.GetPointer(),
+                                                           &outFootprints[i].Size,
+                                                           &outFootprints[i].Offset,
+                                                           &outFootprints[i].Padding,
+                                                           &outFootprints[i].Alignment);
         }
 
         if (outFootprintCount)
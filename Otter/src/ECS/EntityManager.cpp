@@ -32,10 +32,7 @@ namespace Otter
         OTR_VALIDATE(m_EntityToFingerprint.TryGet(entity.GetId(), &fingerprint),
                      "Entity with id '{0}' must be mapped to an archetype.", entity.GetId())
 
-        if (!m_FingerprintToEntitiesToRemove.ContainsKey(fingerprint))
-            m_FingerprintToEntitiesToRemove.TryAdd(fingerprint, List<EntityId>());
-
-        m_FingerprintToEntitiesToRemove[fingerprint]->Add(entity.GetId());
+        m_FingerprintToEntitiesToRemove.FindOrInsert(fingerprint).Add(entity.GetId());
     }
 
     void EntityManager::RefreshManagerData()
@@ -78,6 +75,8 @@ namespace Otter
     {
         if (!m_EntityToComponentDataToAdd.IsEmpty())
         {
+            m_EntityToFingerprint.Reserve(m_EntityToFingerprint.GetCount() + m_EntityToComponentDataToAdd.GetCount());
+
             for (const auto& [entityId, componentDataContainer]: m_EntityToComponentDataToAdd)
             {
                 ArchetypeFingerprint fingerprint;
@@ -90,43 +89,43 @@ namespace Otter
                     fingerprint.Set(index, true);
                 }
 
-                if (!m_FingerprintToArchetype.ContainsKey(fingerprint))
+                // The fingerprint is looked up in several dictionaries, so it is only hashed once
+                const HashedKey<ArchetypeFingerprint> hashedFingerprint(fingerprint);
+
+                if (!m_FingerprintToArchetype.ContainsKey(hashedFingerprint))
                 {
-                    List<ComponentId> componentIds;
+                    // The component ids are only needed while the entity is being migrated, so they are taken from
+                    // scratch memory that is released at the end of every iteration
+                    StackMemoryScope scratch;
+
+                    const UInt64 componentCount = componentDataContainer.GetCount();
+                    ComponentId* componentIds = componentCount > 0 ? scratch.New<ComponentId>(componentCount) : nullptr;
+
+                    UInt64 i = 0;
                     for (const auto& [componentId, _a, _b]: componentDataContainer)
                     {
-                        OTR_ASSERT(m_ComponentToFingerprints.ContainsKey(componentId), "Component must be registered.")
+                        List<ArchetypeFingerprint>* fingerprints = m_ComponentToFingerprints[componentId];
+                        OTR_ASSERT(fingerprints, "Component must be registered.")
 
-                        componentIds.Add(componentId);
+                        componentIds[i++] = componentId;
 
-                        if (!m_ComponentToFingerprints[componentId]->Contains(fingerprint))
-                            m_ComponentToFingerprints[componentId]->Add(fingerprint);
+                        if (!fingerprints->Contains(fingerprint))
+                            fingerprints->Add(fingerprint);
                     }
 
-                    if (!m_FingerprintToArchetypeToAdd.ContainsKey(fingerprint))
-                    {
-                        Archetype archetype{ fingerprint, componentIds };
-                        archetype.TryAddComponentDataUnsafe(entityId,
-                                                            componentIds.GetData(),
-                                                            componentDataContainer.GetComponentSizes(),
-                                                            componentDataContainer.GetComponentData());
+                    bool isNewArchetype;
+                    Archetype& archetype = m_FingerprintToArchetypeToAdd.FindOrInsert(hashedFingerprint,
+                                                                                      &isNewArchetype);
+                    if (isNewArchetype)
+                        archetype = Archetype{ fingerprint, componentIds, componentCount };
 
-                        m_FingerprintToArchetypeToAdd.TryAdd(fingerprint, archetype);
-                    }
-                    else
-                    {
-                        m_FingerprintToArchetypeToAdd[fingerprint]->TryAddComponentDataUnsafe(
-                            entityId,
-                            componentIds.GetData(),
-                            componentDataContainer.GetComponentSizes(),
-                            componentDataContainer.GetComponentData());
-                    }
+                    archetype.TryAddComponentDataUnsafe(entityId,
+                                                        componentIds,
+                                                        componentDataContainer.GetComponentSizes(),
+                                                        componentDataContainer.GetComponentData());
                 }
 
-                if (!m_EntityToFingerprint.ContainsKey(entityId))
-                    m_EntityToFingerprint.TryAdd(entityId, fingerprint);
-                else
-                    *m_EntityToFingerprint[entityId] = std::move(fingerprint);
+                m_EntityToFingerprint.FindOrInsert(entityId) = std::move(fingerprint);
             }
 
             m_EntityToComponentDataToAdd.ClearDestructive();
@@ -134,6 +133,9 @@ namespace Otter
 
         if (!m_FingerprintToArchetypeToAdd.IsEmpty())
         {
+            m_FingerprintToArchetype.Reserve(m_FingerprintToArchetype.GetCount()
+                                             + m_FingerprintToArchetypeToAdd.GetCount());
+
             for (const auto& [fingerprint, archetype]: m_FingerprintToArchetypeToAdd)
                 m_FingerprintToArchetype.TryAdd(fingerprint, archetype);
 
@@ -144,11 +146,12 @@ namespace Otter
         {
             for (const auto& [fingerprint, entities]: m_FingerprintToEntitiesToRemove)
             {
-                if (!m_FingerprintToArchetype.ContainsKey(fingerprint))
+                Archetype* archetype = m_FingerprintToArchetype[fingerprint];
+                if (!archetype)
                     continue;
 
                 for (const auto& entity: entities)
-                    m_FingerprintToArchetype[fingerprint]->TryRemoveComponentData(entity);
+                    archetype->TryRemoveComponentData(entity);
             }
 
             m_FingerprintToEntitiesToRemove.ClearDestructive();
@@ -159,6 +162,8 @@ namespace Otter
     {
         if (!m_EntitiesToAdd.IsEmpty())
         {
+            m_EntityToIndex.Reserve(m_EntityToIndex.GetCount() + m_EntitiesToAdd.GetCount());
+
             Entity e;
             while (m_EntitiesToAdd.TryPop(&e))
             {
@@ -204,58 +209,56 @@ namespace Otter
                                         UInt64 componentSize,
                                         const Byte* componentData)
     {
-        if (m_EntityToComponentDataToAdd.ContainsKey(entityId))
+        if (ComponentData* pendingComponentData = m_EntityToComponentDataToAdd[entityId])
         {
-            m_EntityToComponentDataToAdd[entityId]->Add(componentId, componentSize, componentData);
+            pendingComponentData->Add(componentId, componentSize, componentData);
 
             return true;
         }
 
-        ArchetypeFingerprint fingerprint;
-        if (!m_EntityToFingerprint.TryGet(entityId, &fingerprint))
+        const ArchetypeFingerprint* fingerprint = m_EntityToFingerprint[entityId];
+        if (!fingerprint)
             return false;
 
-        OTR_ASSERT(m_FingerprintToArchetype.ContainsKey(fingerprint), "Fingerprint must be mapped to an archetype.")
+        const HashedKey<ArchetypeFingerprint> hashedFingerprint(*fingerprint);
+
+        Archetype* archetype = m_FingerprintToArchetype[hashedFingerprint];
+        OTR_ASSERT(archetype, "Fingerprint must be mapped to an archetype.")
 
         ComponentData componentDataContainer;
-        m_FingerprintToArchetype[fingerprint]->GetComponentDataForEntityUnsafe(entityId, &componentDataContainer);
+        archetype->GetComponentDataForEntityUnsafe(entityId, &componentDataContainer);
         componentDataContainer.Add(componentId, componentSize, componentData);
 
         m_EntityToComponentDataToAdd.TryAdd(entityId, componentDataContainer);
-
-        if (!m_FingerprintToEntitiesToRemove.ContainsKey(fingerprint))
-            m_FingerprintToEntitiesToRemove.TryAdd(fingerprint, List<EntityId>());
-
-        m_FingerprintToEntitiesToRemove[fingerprint]->Add(entityId);
+        m_FingerprintToEntitiesToRemove.FindOrInsert(hashedFingerprint).Add(entityId);
 
         return true;
     }
 
     bool EntityManager::TryRemoveComponent(EntityId entityId, ComponentId componentId)
     {
-        ArchetypeFingerprint fingerprint;
-        if (!m_EntityToFingerprint.TryGet(entityId, &fingerprint))
+        const ArchetypeFingerprint* fingerprint = m_EntityToFingerprint[entityId];
+        if (!fingerprint)
             return false;
 
-        OTR_ASSERT(m_FingerprintToArchetype.ContainsKey(fingerprint), "Fingerprint must be mapped to an archetype.")
-
-        if (!m_EntityToComponentDataToAdd.ContainsKey(entityId))
+        if (ComponentData* pendingComponentData = m_EntityToComponentDataToAdd[entityId])
         {
-            ComponentData componentDataContainer;
-            m_FingerprintToArchetype[fingerprint]->GetComponentDataForEntityUnsafe(entityId, &componentDataContainer);
-            componentDataContainer.Remove(componentId);
+            pendingComponentData->Remove(componentId);
 
-            m_EntityToComponentDataToAdd.TryAdd(entityId, componentDataContainer);
+            return true;
+        }
 
-            if (!m_FingerprintToEntitiesToRemove.ContainsKey(fingerprint))
-                m_FingerprintToEntitiesToRemove.TryAdd(fingerprint, List<EntityId>());
+        const HashedKey<ArchetypeFingerprint> hashedFingerprint(*fingerprint);
 
-            m_FingerprintToEntitiesToRemove[fingerprint]->Add(entityId);
-        }
-        else
-        {
-            m_EntityToComponentDataToAdd[entityId]->Remove(componentId);
-        }
+        Archetype* archetype = m_FingerprintToArchetype[hashedFingerprint];
+        OTR_ASSERT(archetype, "Fingerprint must be mapped to an archetype.")
+
+        ComponentData componentDataContainer;
+        archetype->GetComponentDataForEntityUnsafe(entityId, &componentDataContainer);
+        componentDataContainer.Remove(componentId);
+
+        m_EntityToComponentDataToAdd.TryAdd(entityId, componentDataContainer);
+        m_FingerprintToEntitiesToRemove.FindOrInsert(hashedFingerprint).Add(entityId);
 
         return true;
     }
@@ -266,11 +269,13 @@ namespace Otter
         OTR_VALIDATE(m_ComponentToFingerprintIndex.TryGet(componentId, &index),
                      "Component with id '{0}'must be registered.", componentId)
 
-        ArchetypeFingerprint fingerprint;
-        OTR_VALIDATE(m_EntityToFingerprint.TryGet(entityId, &fingerprint),
-                     "Entity with id '{0}' must be mapped to an archetype.", entityId)
+        const ArchetypeFingerprint* fingerprint = m_EntityToFingerprint[entityId];
+        OTR_ASSERT(fingerprint, "Entity with id '{0}' must be mapped to an archetype.", entityId)
+
+        if (!fingerprint)
+            return false;
 
-        return fingerprint.Get(index);
+        return fingerprint->Get(index);
     }
 
     EntityManager::ArchetypeBuilder::ArchetypeBuilder(EntityManager* entityManager)
@@ -281,21 +286,18 @@ namespace Otter
     EntityManager::ArchetypeBuilder::~ArchetypeBuilder()
     {
         m_EntityManager = nullptr;
-        m_Fingerprint.ClearDestructive();
+        m_Fingerprint.Clear();
         m_ComponentIds.ClearDestructive();
     }
 
     Archetype EntityManager::ArchetypeBuilder::Build()
     {
-        Archetype archetype(m_Fingerprint, m_ComponentIds);
+        Archetype archetype(m_Fingerprint, m_ComponentIds.GetData(), m_ComponentIds.GetCount());
 
-        if (!m_EntityManager->m_FingerprintToArchetype.ContainsKey(m_Fingerprint))
-        {
-            if (!m_EntityManager->m_FingerprintToArchetypeToAdd.ContainsKey(m_Fingerprint))
-                m_EntityManager->m_FingerprintToArchetypeToAdd.TryAdd(m_Fingerprint, archetype);
-            else
-                *m_EntityManager->m_FingerprintToArchetypeToAdd[m_Fingerprint] = archetype;
-        }
+        const HashedKey<ArchetypeFingerprint> hashedFingerprint(m_Fingerprint);
+
+        if (!m_EntityManager->m_FingerprintToArchetype.ContainsKey(hashedFingerprint))
+            m_EntityManager->m_FingerprintToArchetypeToAdd.TryAdd(hashedFingerprint, archetype);
 
         return archetype;
     }
@@ -322,7 +324,7 @@ namespace Otter
     EntityManager::EntityBuilder::~EntityBuilder()
     {
         m_EntityManager = nullptr;
-        m_Fingerprint.ClearDestructive();
+        m_Fingerprint.Clear();
     }
 
     Entity EntityManager::EntityBuilder::Build()
@@ -371,7 +373,7 @@ namespace Otter
     EntityManager::EntityBuilderFromArchetype::~EntityBuilderFromArchetype()
     {
         m_EntityManager = nullptr;
-        m_FingerprintTrack.ClearDestructive();
+        m_FingerprintTrack.Clear();
     }
 
     Entity EntityManager::EntityBuilderFromArchetype::Build()
@@ -24,7 +24,7 @@ namespace Otter::Graphics::Vulkan
 
         UInt32 availableExtensionCount = 0;
         OTR_VULKAN_VALIDATE(vkEnumerateInstanceExtensionProperties(nullptr, &availableExtensionCount, nullptr))
-        auto* availableExtensions = Buffer::New<VkExtensionProperties>(availableExtensionCount);
+        auto* availableExtensions = Buffer::New<VkExtensionProperties>(availableExtensionCount, MemoryTag::Graphics);
         OTR_VULKAN_VALIDATE(vkEnumerateInstanceExtensionProperties(nullptr,
                                                                    &availableExtensionCount,
                                                                    availableExtensions))
@@ -46,7 +46,7 @@ namespace Otter::Graphics::Vulkan
             OTR_INTERNAL_ASSERT_MSG(found, "Required extension is missing: {0}", extensions[i])
         }
 
-        Buffer::Delete<VkExtensionProperties>(availableExtensions, availableExtensionCount);
+        Buffer::Delete<VkExtensionProperties>(availableExtensions, availableExtensionCount, MemoryTag::Graphics);
     }
 
     void GetDeviceRequiredExtensions(List<const char*>& requiredExtensions)
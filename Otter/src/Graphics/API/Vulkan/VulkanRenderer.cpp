@@ -189,9 +189,9 @@ namespace Otter::Graphics::Vulkan
 
             gs_Shaders.ClearDestructive();
 
-            Delete<VulkanIndexBuffer>(m_IndexBuffer);
-            Delete<VulkanVertexBuffer>(m_VertexBuffer);
-            Delete<VulkanUniformBuffer>(m_UniformBuffer);
+            m_IndexBuffer.Reset();
+            m_VertexBuffer.Reset();
+            m_UniformBuffer.Reset();
 
             DestroyVulkanDescriptorData();
             DestroyPipeline(m_DevicePair.LogicalDevice, m_Allocator, &m_PipelineLayout, &m_Pipeline);
@@ -895,41 +895,45 @@ namespace Otter::Graphics::Vulkan
     void VulkanRenderer::CreateVertexBuffer()
     {
         List<Vertex> vertices;
-        vertices.Reserve(4);
+        {
+            FrameMemoryScope frameMemory;
 
-        // TEMP: Update vertices
-        World::GetEntityManager()
-            .ForEach<TransformComponent, SpriteComponent>(
-                {
-                    [&](TransformComponent* transform, SpriteComponent* sprite)
+            vertices.Reserve(4);
+
+            // TEMP: Update vertices
+            World::GetEntityManager()
+                .ForEach<TransformComponent, SpriteComponent>(
                     {
-                        vertices.Add({
-                                         { -1.5f, 1.5f, 0.0f },
-                                         sprite->Color,
-                                         { 0.0f, 1.0f }
-                                     });
-                        vertices.Add({
-                                         { 1.5f, 1.5f, 0.0f },
-                                         sprite->Color,
-                                         { 1.0f, 1.0f }
-                                     });
-                        vertices.Add({
-                                         { 1.5f, -1.5f, 0.0f },
-                                         sprite->Color,
-                                         { 1.0f, 0.0f }
-                                     });
-                        vertices.Add({
-                                         { -1.5f, -1.5f, 0.0f },
-                                         sprite->Color,
-                                         { 0.0f, 0.0f }
-                                     });
-                    }
-                });
-        // TEMP: End temp code
+                        [&](TransformComponent* transform, SpriteComponent* sprite)
+                        {
+                            vertices.Add({
+                                             { -1.5f, 1.5f, 0.0f },
+                                             sprite->Color,
+                                             { 0.0f, 1.0f }
+                                         });
+                            vertices.Add({
+                                             { 1.5f, 1.5f, 0.0f },
+                                             sprite->Color,
+                                             { 1.0f, 1.0f }
+                                         });
+                            vertices.Add({
+                                             { 1.5f, -1.5f, 0.0f },
+                                             sprite->Color,
+                                             { 1.0f, 0.0f }
+                                         });
+                            vertices.Add({
+                                             { -1.5f, -1.5f, 0.0f },
+                                             sprite->Color,
+                                             { 0.0f, 0.0f }
+                                         });
+                        }
+                    });
+            // TEMP: End temp code
+        }
 
         VkDeviceSize bufferSize = sizeof(Vertex) * vertices.GetCount();
 
-        m_VertexBuffer = New<VulkanVertexBuffer>();
+        m_VertexBuffer = MakeUnique<VulkanVertexBuffer, MemoryTag::Graphics>();
         m_VertexBuffer->SetDevicePair(&m_DevicePair);
         m_VertexBuffer->SetAllocator(m_Allocator);
         m_VertexBuffer->SetAttributeLayout({{ ShaderAttributeType::Float3, ShaderAttributeSize::Bit32, 0 },
@@ -945,7 +949,7 @@ namespace Otter::Graphics::Vulkan
 
         VkDeviceSize bufferSize = sizeof(triangles[0]) * triangles.GetCount();
 
-        m_IndexBuffer = New<VulkanIndexBuffer>();
+        m_IndexBuffer = MakeUnique<VulkanIndexBuffer, MemoryTag::Graphics>();
         m_IndexBuffer->SetDevicePair(&m_DevicePair);
         m_IndexBuffer->SetAllocator(m_Allocator);
         m_IndexBuffer->Write(triangles.GetData(), bufferSize);
@@ -953,7 +957,7 @@ namespace Otter::Graphics::Vulkan
 
     void VulkanRenderer::CreateUniformBuffer()
     {
-        m_UniformBuffer = New<VulkanUniformBuffer>();
+        m_UniformBuffer = MakeUnique<VulkanUniformBuffer, MemoryTag::Graphics>();
         m_UniformBuffer->SetDevicePair(&m_DevicePair);
         m_UniformBuffer->SetAllocator(m_Allocator);
         m_UniformBuffer->Write(nullptr, sizeof(GlobalUniformBufferObject));
@@ -1213,7 +1217,7 @@ namespace Otter::Graphics::Vulkan
 
         UInt32 availableLayerCount = 0;
         OTR_VULKAN_VALIDATE(vkEnumerateInstanceLayerProperties(&availableLayerCount, VK_NULL_HANDLE))
-        auto* availableLayers = Buffer::New<VkLayerProperties>(availableLayerCount);
+        auto* availableLayers = Buffer::New<VkLayerProperties>(availableLayerCount, MemoryTag::Graphics);
         OTR_VULKAN_VALIDATE(vkEnumerateInstanceLayerProperties(&availableLayerCount, availableLayers))
 
         for (UInt32 i = 0; i < layers.GetCount(); ++i)
@@ -1232,7 +1236,7 @@ namespace Otter::Graphics::Vulkan
             OTR_INTERNAL_ASSERT_MSG(found, "Required layer is missing: {0}", layers[i])
         }
 
-        Buffer::Delete<VkLayerProperties>(availableLayers, availableLayerCount);
+        Buffer::Delete<VkLayerProperties>(availableLayers, availableLayerCount, MemoryTag::Graphics);
     }
 #endif
 
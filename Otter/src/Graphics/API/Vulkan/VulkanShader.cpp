@@ -78,10 +78,10 @@ namespace Otter::Graphics::Vulkan
             return false;
         }
 
-        auto* buffer = Buffer::New<UInt32>(fileSize / sizeof(UInt32));
+        auto* buffer = Buffer::New<UInt32>(fileSize / sizeof(UInt32), MemoryTag::Graphics);
         if (!FileSystem::TryReadAllBytes(&file, buffer, &fileSize))
         {
-            Buffer::Delete<UInt32>(buffer, fileSize / sizeof(UInt32));
+            Buffer::Delete<UInt32>(buffer, fileSize / sizeof(UInt32), MemoryTag::Graphics);
             FileSystem::CloseFile(&file);
             return false;
         }
@@ -94,7 +94,7 @@ namespace Otter::Graphics::Vulkan
 
         OTR_VULKAN_VALIDATE(vkCreateShaderModule(m_LogicalDevice, &createInfo, m_Allocator, outShaderModule))
 
-        Buffer::Delete<UInt32>(buffer, fileSize / sizeof(UInt32));
+        Buffer::Delete<UInt32>(buffer, fileSize / sizeof(UInt32), MemoryTag::Graphics);
         FileSystem::CloseFile(&file);
 
         return true;
@@ -3,7 +3,12 @@
 #if OTR_PLATFORM_WINDOWS
 #include "Platform/Windows/Platform.Win32.h"
 #elif OTR_PLATFORM_LINUX
-#include "Platform/Linux/PlatformLinux.h"
+#include <cstdio>
+#include <ctime>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Platform/Linux/Platform.Linux.h"
 #else
 #error "Unsupported platform"
 #endif
@@ -84,6 +89,14 @@ namespace Otter
         ZeroMemory(block, size);
     }
 
+    void Platform::MemorySet(void* block, const Byte value, UInt64 size)
+    {
+        OTR_INTERNAL_ASSERT(block != nullptr)
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Set size must be greater than 0")
+
+        FillMemory(block, size, value);
+    }
+
     void Platform::SleepForMilliseconds(UInt64 value)
     {
         if (value == 0)
@@ -114,9 +127,162 @@ namespace Otter
 
 #elif OTR_PLATFORM_LINUX
 
+    /**
+     * @brief Header stored right below every block mapped from the OS. It keeps the start and the size of the whole
+     * mapping, so that it can be remapped or unmapped later, and whether the block is backed by explicit huge pages.
+     *
+     * @note The header takes up a whole cache line, so that the block handed out right after it stays cache line
+     * aligned.
+     */
+    struct alignas(64) LinuxMappingHeader final
+    {
+        void*  Mapping;
+        UInt64 MappedSize;
+        bool   IsHugePageAligned;
+        bool   IsHugeTlb;
+    };
+
+    /// @brief The size of a (default) huge page, 2 MiB on both x86-64 and AArch64.
+    constexpr UInt64 g_HugePageSize = 2 * 1024 * 1024;
+
+    /**
+     * @brief Gets the header of a block that was mapped from the OS.
+     *
+     * @param block The block.
+     *
+     * @return The header of the block.
+     */
+    OTR_INLINE LinuxMappingHeader* GetMappingHeader(void* const block)
+    {
+        return (LinuxMappingHeader*) ((UIntPtr) block - sizeof(LinuxMappingHeader));
+    }
+
+    /**
+     * @brief Gets the size of the part of a mapping that belongs to its block.
+     *
+     * @param header The header of the block.
+     *
+     * @return The size of the block in bytes.
+     */
+    OTR_INLINE UInt64 GetMappedBlockSize(const LinuxMappingHeader* const header)
+    {
+        return header->MappedSize - ((UIntPtr) header + sizeof(LinuxMappingHeader) - (UIntPtr) header->Mapping);
+    }
+
+    /**
+     * @brief Reserves a block of virtual memory from the OS. Physical pages are only committed when they are first
+     * touched. Blocks of at least one huge page start on a huge page boundary and are either backed by explicit huge
+     * pages (when `OTR_PLATFORM_LINUX_HUGETLB` is enabled and the pool has enough pages) or marked as eligible for
+     * transparent huge pages. Their header lives at the end of a regular page that is mapped right below them, so
+     * that it costs neither a huge page of its own nor the alignment of the block.
+     *
+     * @param size The size of the block, not including its header.
+     *
+     * @return A pointer to the block, or nullptr if the mapping failed.
+     */
+    void* MapMemory(const UInt64 size)
+    {
+        const UInt64 pageSize = sysconf(_SC_PAGESIZE);
+
+        if (size < g_HugePageSize)
+        {
+            const UInt64 mappedSize = OTR_ALIGNED_OFFSET(size + sizeof(LinuxMappingHeader), pageSize);
+            void* mapping = mmap(nullptr,
+                                 mappedSize,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                                 -1,
+                                 0);
+            if (mapping == MAP_FAILED)
+                return nullptr;
+
+            auto* header = (LinuxMappingHeader*) mapping;
+            header->Mapping           = mapping;
+            header->MappedSize        = mappedSize;
+            header->IsHugePageAligned = false;
+            header->IsHugeTlb         = false;
+
+            return (void*) ((UIntPtr) mapping + sizeof(LinuxMappingHeader));
+        }
+
+        const UInt64 blockSize = OTR_ALIGNED_OFFSET(size, g_HugePageSize);
+
+#if OTR_PLATFORM_LINUX_HUGETLB
+        // Explicit huge page mappings always start on a huge page boundary, the header page is mapped below them
+        void* hugeTlbBlock = mmap(nullptr,
+                                  blockSize,
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                                  -1,
+                                  0);
+
+        if (hugeTlbBlock != MAP_FAILED)
+        {
+            void* const headerPage = (void*) ((UIntPtr) hugeTlbBlock - pageSize);
+            void* mapping = mmap(headerPage,
+                                 pageSize,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                                 -1,
+                                 0);
+
+            if (mapping == headerPage)
+            {
+                auto* header = GetMappingHeader(hugeTlbBlock);
+                header->Mapping           = mapping;
+                header->MappedSize        = pageSize + blockSize;
+                header->IsHugePageAligned = true;
+                header->IsHugeTlb         = true;
+
+                return hugeTlbBlock;
+            }
+
+            if (mapping != MAP_FAILED)
+                munmap(mapping, pageSize);
+            munmap(hugeTlbBlock, blockSize);
+        }
+
+        OTR_LOG_WARNING("Failed to map {0} bytes of explicit huge pages, falling back to regular pages", blockSize)
+#endif
+
+        // Over-reserve by a huge page, so that the block can be moved to a huge page boundary with the header page
+        // still in front of it
+        const UInt64 reservedSize = pageSize + blockSize + g_HugePageSize;
+
+        void* reservation = mmap(nullptr,
+                                 reservedSize,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                                 -1,
+                                 0);
+        if (reservation == MAP_FAILED)
+            return nullptr;
+
+        const UIntPtr start    = (UIntPtr) reservation;
+        const UIntPtr block    = OTR_ALIGNED_OFFSET(start + pageSize, g_HugePageSize);
+        const UIntPtr mapping  = block - pageSize;
+        const UInt64  headSize = mapping - start;
+        const UInt64  tailSize = start + reservedSize - (block + blockSize);
+
+        if (headSize > 0)
+            munmap(reservation, headSize);
+        if (tailSize > 0)
+            munmap((void*) (block + blockSize), tailSize);
+
+        madvise((void*) block, blockSize, MADV_HUGEPAGE);
+
+        auto* header = GetMappingHeader((void*) block);
+        header->Mapping           = (void*) mapping;
+        header->MappedSize        = pageSize + blockSize;
+        header->IsHugePageAligned = true;
+        header->IsHugeTlb         = false;
+
+        return (void*) block;
+    }
+
     Platform* Platform::CreatePlatform(const PlatformConfiguration& configuration)
     {
-        return New<Internal::LinuxPlatform>();
+        return New<Internal::LinuxPlatform>(configuration);
     }
 
     void Platform::DestroyPlatform(Platform* platform)
@@ -126,45 +292,111 @@ namespace Otter
 
     void* Platform::Allocate(UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::Allocate' not supported for this platform")
-
+        OTR_LOG_TRACE("Requested allocation of {0} bytes from OS", size)
         OTR_INTERNAL_ASSERT_MSG(size > 0, "Allocation size must be greater than 0")
 
-        void* block = malloc(size);
-
+        void* block = MapMemory(size);
         OTR_INTERNAL_ASSERT_MSG(block != nullptr, "Failed to allocate memory")
 
-        return nullptr;
+        return block;
     }
 
     void* Platform::Reallocate(void* block, UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::Reallocate' not supported for this platform")
-
+        OTR_LOG_TRACE("Requested re-allocation of {0} bytes from OS", size)
         OTR_INTERNAL_ASSERT_MSG(size > 0, "Reallocation size must be greater than 0")
 
         if (!block)
             return Allocate(size);
 
-//        void* newBlock = realloc(block, size);
-//        OTR_INTERNAL_ASSERT_MSG(newBlock != nullptr, "Failed to reallocate memory")
+        auto* header = GetMappingHeader(block);
 
-        return nullptr;
+        // Small blocks only need page alignment, so the kernel may move the whole mapping wherever it fits
+        if (!header->IsHugePageAligned && size < g_HugePageSize)
+        {
+            const UInt64 mappedSize = OTR_ALIGNED_OFFSET(size + sizeof(LinuxMappingHeader),
+                                                         (UInt64) sysconf(_SC_PAGESIZE));
+            if (mappedSize == header->MappedSize)
+                return block;
+
+            // The kernel moves the page table entries, so the contents are never copied.
+            void* mapping = mremap(header->Mapping, header->MappedSize, mappedSize, MREMAP_MAYMOVE);
+            OTR_INTERNAL_ASSERT_MSG(mapping != MAP_FAILED, "Failed to reallocate memory")
+
+            if (mapping == MAP_FAILED)
+                return nullptr;
+
+            header = (LinuxMappingHeader*) mapping;
+            header->Mapping    = mapping;
+            header->MappedSize = mappedSize;
+
+            return (void*) ((UIntPtr) mapping + sizeof(LinuxMappingHeader));
+        }
+
+        const UInt64 blockSize = GetMappedBlockSize(header);
+
+        // Huge page aligned blocks are resized without moving, so that they keep their alignment
+        if (header->IsHugePageAligned)
+        {
+            const UInt64 newBlockSize = OTR_ALIGNED_OFFSET(size, g_HugePageSize);
+            if (newBlockSize == blockSize)
+                return block;
+
+            if (mremap(block, blockSize, newBlockSize, 0) != MAP_FAILED)
+            {
+                if (!header->IsHugeTlb && newBlockSize > blockSize)
+                    madvise((Byte*) block + blockSize, newBlockSize - blockSize, MADV_HUGEPAGE);
+
+                header->MappedSize = header->MappedSize - blockSize + newBlockSize;
+                return block;
+            }
+        }
+
+        // Otherwise the block moves to a fresh mapping that is aligned again
+        void* newBlock = MapMemory(size);
+        OTR_INTERNAL_ASSERT_MSG(newBlock != nullptr, "Failed to reallocate memory")
+
+        if (!newBlock)
+            return nullptr;
+
+        const UInt64 keptSize = blockSize < size ? blockSize : size;
+        const LinuxMappingHeader* newHeader = GetMappingHeader(newBlock);
+
+        // Page table entries of regular pages are moved over the fresh ones, only the rest has to be copied
+        const bool canMovePages = header->IsHugePageAligned && newHeader->IsHugePageAligned
+                                  && !header->IsHugeTlb && !newHeader->IsHugeTlb;
+
+        if (canMovePages
+            && mremap(block, blockSize, keptSize, MREMAP_MAYMOVE | MREMAP_FIXED, newBlock) != MAP_FAILED)
+        {
+            // The kernel has already unmapped the moved range, so only the pages around it are still mapped
+            const UIntPtr mappingEnd = (UIntPtr) header->Mapping + header->MappedSize;
+            const UIntPtr movedEnd   = (UIntPtr) block + blockSize;
+
+            munmap(header->Mapping, (UIntPtr) block - (UIntPtr) header->Mapping);
+            if (movedEnd < mappingEnd)
+                munmap((void*) movedEnd, mappingEnd - movedEnd);
+
+            return newBlock;
+        }
+
+        memcpy(newBlock, block, keptSize);
+        munmap(header->Mapping, header->MappedSize);
+
+        return newBlock;
     }
 
     void Platform::Free(void* block)
     {
-        OTR_LOG_FATAL("'Platform::Free' not supported for this platform")
-
+        OTR_LOG_TRACE("Requested de-allocation of memory from OS")
         OTR_INTERNAL_ASSERT(block != nullptr)
 
-        free(block);
+        const LinuxMappingHeader* header = GetMappingHeader(block);
+        munmap(header->Mapping, header->MappedSize);
     }
 
     void Platform::MemoryCopy(void* destination, const void* source, UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::MemoryCopy' not supported for this platform")
-
         OTR_INTERNAL_ASSERT(source != nullptr)
         OTR_INTERNAL_ASSERT_MSG(size > 0, "Copy size must be greater than 0")
 
@@ -173,8 +405,6 @@ namespace Otter
 
     void Platform::MemoryMove(void* destination, const void* source, UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::MemoryMove' not supported for this platform")
-
         OTR_INTERNAL_ASSERT(source != nullptr)
         OTR_INTERNAL_ASSERT_MSG(size > 0, "Move size must be greater than 0")
 
@@ -183,28 +413,37 @@ namespace Otter
 
     void Platform::MemoryClear(void* block, UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::MemoryClear' not supported for this platform")
-
         OTR_INTERNAL_ASSERT(block != nullptr)
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Clear size must be greater than 0")
 
         memset(block, 0, size);
     }
 
-    void Platform::SleepForMilliseconds(UInt64 value)
+    void Platform::MemorySet(void* block, const Byte value, UInt64 size)
     {
-        OTR_LOG_FATAL("'Platform::Log' not supported for this platform")
+        OTR_INTERNAL_ASSERT(block != nullptr)
+        OTR_INTERNAL_ASSERT_MSG(size > 0, "Set size must be greater than 0")
+
+        memset(block, value, size);
+    }
 
+    void Platform::SleepForMilliseconds(UInt64 value)
+    {
         if (value == 0)
             return;
 
-        usleep(value * 1000);
+        timespec duration{ (time_t) (value / 1000), (long) ((value % 1000) * 1000 * 1000) };
+        nanosleep(&duration, nullptr);
     }
 
     void Platform::Log(const char* message, UInt8 level)
     {
-        OTR_LOG_FATAL("'Platform::Log' not supported for this platform")
+        OTR_INTERNAL_ASSERT(level < 6)
 
-//        OTR_INTERNAL_ASSERT(level < 6)
+        // TRACE, DEBUG, INFO, WARN, ERROR, FATAL
+        static const char* levels[6] = { "1;30", "0;37", "0;32", "0;33", "0;31", "0;41" };
+        FILE* stream = level >= 4 ? stderr : stdout;
+        fprintf(stream, "\033[%sm%s\033[0m", levels[level], message);
     }
 
 #else
@@ -255,6 +494,11 @@ namespace Otter
         OTR_LOG_FATAL("'Platform::MemoryClear' not supported for this platform")
     }
 
+    void Platform::MemorySet(void* block, const Byte value, UInt64 size)
+    {
+        OTR_LOG_FATAL("'Platform::MemorySet' not supported for this platform")
+    }
+
     void Platform::SleepForMilliseconds(UInt64 value)
     {
         OTR_LOG_FATAL("'Platform::Log' not supported for this platform")
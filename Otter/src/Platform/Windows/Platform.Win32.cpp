@@ -27,7 +27,7 @@ namespace Otter::Internal
         constexpr UInt64 platformWindowDataSize = OTR_ALIGNED_OFFSET(sizeof(WindowsPlatformWindowData),
                                                                      OTR_PLATFORM_MEMORY_ALIGNMENT);
 
-        g_PlatformMemoryHandle = Unsafe::New(platformContextSize + platformWindowDataSize);
+        g_PlatformMemoryHandle = Unsafe::New(platformContextSize + platformWindowDataSize, AllocationFlags::Zeroed);
 
         m_Context = (PlatformContext*) g_PlatformMemoryHandle.Pointer;
         m_Context->Data = (WindowsPlatformWindowData*) ((UIntPtr*) g_PlatformMemoryHandle.Pointer + 1);
@@ -33,5 +33,5 @@ namespace Sandbox
 
 Otter::Application* Otter::CreateApplication()
 {
-    return new Sandbox::SandboxApplication({ "Sandbox", 1280, 720, 20_KiB });
+    return new Sandbox::SandboxApplication({ "Sandbox", 1280, 720, 1_MiB, 8_KiB, 16_KiB, 64_MiB });
 }